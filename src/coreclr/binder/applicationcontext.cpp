@@ -98,6 +98,20 @@ namespace BINDER_SPACE
 
         sTrustedPlatformAssemblies.Normalize();
 
+        // Hosts pass hundreds of paths here. Size the map for all of them up front
+        // instead of rehashing it repeatedly while it grows.
+        {
+            COUNT_T cPaths = 1;
+            for (LPCWSTR pwzTpa = sTrustedPlatformAssemblies.GetUnicode(); *pwzTpa != W('\0'); pwzTpa++)
+            {
+                if (*pwzTpa == PATH_SEPARATOR_CHAR_W)
+                {
+                    cPaths++;
+                }
+            }
+            m_pTrustedPlatformAssemblyMap->Reallocate(cPaths * 2);
+        }
+
         for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
         {
             SString fileName;
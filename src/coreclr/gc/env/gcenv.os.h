@@ -419,6 +419,20 @@ public:
     //  specified, it returns amount of actual physical memory.
     static uint64_t GetPhysicalMemoryLimit(bool* is_restricted=NULL);
 
+    // Re-read the restricted physical memory limit, which can change while the process is running
+    // (e.g. when the memory limit of the container it runs in is adjusted).
+    // Return:
+    //  the current restricted limit, 0 if the process doesn't run with a restricted limit.
+    static uint64_t RefreshRestrictedPhysicalMemoryLimit();
+
+    // Get how much the process is stalled waiting on memory.
+    // Parameters:
+    //  pressure - A number between 0 and 100 that specifies the percentage of time in the last 10 seconds
+    //      some threads were stalled because there wasn't enough physical memory.
+    // Return:
+    //  true if it has succeeded, false if the OS doesn't provide this information
+    static bool GetMemoryPressure(uint32_t* pressure);
+
     // Get memory status
     // Parameters:
     //  restricted_limit - The amount of physical memory in bytes that the current process is being restricted to. If non-zero, it used to calculate
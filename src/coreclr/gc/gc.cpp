@@ -18,7 +18,7 @@
 
 #include "gcpriv.h"
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -76,6 +76,15 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 // If the survived due to cards from old generations / region_size is 90+%,
 // we don't compact this region, also we immediately promote it to gen2.
 #define sip_old_card_surv_ratio_th (90)
+// In full compacting GCs, if the survived / region_size of a gen2 region is at
+// least GCGen2SIPSurvRatio%, we don't compact it - only the sparser gen2 regions
+// get evacuated, and the dense ones keep their free space on the free list. This
+// is opt in, by default gen2 regions use the same cutoff as the others.
+#define sip_gen2_surv_ratio_default_th (sip_surv_ratio_th)
+// If a region has kept pinned survivors for this many GCs in a row, we don't
+// compact it, also we immediately promote it to gen2. This is opt in, it's off
+// (0) unless GCSIPPinnedGCCount is set since it makes pinned objects live in gen2.
+#define sip_pinned_gcs_th (0)
 #else
 #define demotion_plug_len_th (6*1024*1024)
 #endif //USE_REGIONS
@@ -1272,14 +1281,23 @@ void reset_memory (uint8_t* o, size_t sizeo);
 
 #ifdef WRITE_WATCH
 
-#ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+// When software write watch is compiled in, this is only set if GCHardwareWriteWatch is
+// enabled and the OS supports write watch; the GC heap is then tracked by the OS and the
+// write barrier never needs to update the software write watch table.
 static bool virtual_alloc_hardware_write_watch = false;
-#endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 static bool hardware_write_watch_capability = false;
 
 void hardware_write_watch_api_supported()
 {
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    if (!GCConfig::GetGCHardwareWriteWatch())
+    {
+        dprintf (2, ("WriteWatch not requested"));
+        return;
+    }
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+
     if (GCToOSInterface::SupportsWriteWatch())
     {
         hardware_write_watch_capability = true;
@@ -2015,7 +2033,8 @@ void stomp_write_barrier_ephemeral(uint8_t* ephemeral_low, uint8_t* ephemeral_hi
     GCToEEInterface::StompWriteBarrier(&args);
 }
 
-void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_high)
+void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_high,
+                                    uint8_t* region_to_generation_table, uint8_t region_shr)
 {
     WriteBarrierParameters args = {};
     args.operation = WriteBarrierOp::Initialize;
@@ -2031,6 +2050,8 @@ void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_h
     args.highest_address = g_gc_highest_address;
     args.ephemeral_low = ephemeral_low;
     args.ephemeral_high = ephemeral_high;
+    args.region_to_generation_table = region_to_generation_table;
+    args.region_shr = region_shr;
     GCToEEInterface::StompWriteBarrier(&args);
 }
 
@@ -2145,6 +2166,8 @@ uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;
 
+int         gc_heap::n_active_heaps;
+
 gc_heap**   gc_heap::g_heaps;
 
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -2153,6 +2176,7 @@ size_t*     gc_heap::g_promoted;
 
 #ifdef MH_SC_MARK
 int*        gc_heap::g_mark_stack_busy;
+int         gc_heap::mark_steal_busiest_heap = 0;
 #endif //MH_SC_MARK
 
 #ifdef BACKGROUND_GC
@@ -2176,6 +2200,7 @@ size_t      gc_heap::g_bpromoted;
 size_t      gc_heap::card_table_element_layout[total_bookkeeping_elements + 1];
 #ifdef USE_REGIONS
 uint8_t*    gc_heap::bookkeeping_covered_start = nullptr;
+uint8_t*    gc_heap::map_region_to_generation_skewed = nullptr;
 uint8_t*    gc_heap::bookkeeping_covered_committed = nullptr;
 size_t      gc_heap::bookkeeping_sizes[total_bookkeeping_elements];
 #endif //USE_REGIONS
@@ -2235,6 +2260,25 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
 
+uint64_t    gc_heap::pause_time_target = 0;
+
+uint64_t    gc_heap::recent_ephemeral_pause = 0;
+
+float       gc_heap::pause_budget_factor = 1.0f;
+
+uint64_t    gc_heap::memory_limit_poll_interval = 0;
+
+uint64_t    gc_heap::last_memory_limit_poll_time = 0;
+
+uint32_t    gc_heap::memory_pressure_decommit_th = 0;
+
+bool        gc_heap::physical_mem_from_os_p = false;
+
+#ifdef DYNAMIC_HEAP_COUNT
+int         gc_heap::dynamic_adaptation_mode = dynamic_adaptation_default;
+gc_heap::dynamic_heap_count_data_t gc_heap::dynamic_heap_count_data;
+#endif //DYNAMIC_HEAP_COUNT
+
 uint64_t    gc_heap::suspended_start_time = 0;
 uint64_t    gc_heap::end_gc_time = 0;
 uint64_t    gc_heap::total_suspended_time = 0;
@@ -2311,6 +2355,12 @@ BOOL        gc_heap::dont_restart_ee_p = FALSE;
 
 BOOL        gc_heap::keep_bgc_threads_p = FALSE;
 
+uint32_t    gc_heap::bgc_max_cpu_percent = 0;
+
+AffinitySet gc_heap::bgc_affinity_set;
+
+size_t      gc_heap::bgc_affinity_set_count = 0;
+
 GCEvent     gc_heap::bgc_threads_sync_event;
 
 BOOL        gc_heap::do_ephemeral_gc_p = FALSE;
@@ -2324,6 +2374,14 @@ BOOL        gc_heap::alloc_wait_event_p = FALSE;
 VOLATILE(c_gc_state) gc_heap::current_c_gc_state = c_gc_state_free;
 
 VOLATILE(BOOL) gc_heap::gc_background_running = FALSE;
+
+bgc_mark_walk_fn gc_heap::bgc_mark_walk_requested_callback = nullptr;
+
+void*       gc_heap::bgc_mark_walk_requested_context = nullptr;
+
+bgc_mark_walk_fn gc_heap::bgc_mark_walk_callback = nullptr;
+
+void*       gc_heap::bgc_mark_walk_context = nullptr;
 #endif //BACKGROUND_GC
 
 #ifndef MULTIPLE_HEAPS
@@ -2565,12 +2623,20 @@ size_t      gc_heap::c_mark_list_length = 0;
 
 size_t      gc_heap::c_mark_list_index = 0;
 
+uint8_t*    gc_heap::bgc_marked_objects[bgc_marked_objects_chunk];
+
+size_t      gc_heap::bgc_marked_objects_count = 0;
+
 gc_history_per_heap gc_heap::bgc_data_per_heap;
 
 BOOL    gc_heap::bgc_thread_running;
 
 CLRCriticalSection gc_heap::bgc_threads_timeout_cs;
 
+uint64_t    gc_heap::bgc_duty_cycle_start = 0;
+
+uint32_t    gc_heap::bgc_duty_cycle_check_count = 0;
+
 #endif //BACKGROUND_GC
 
 uint8_t**   gc_heap::mark_list;
@@ -2691,6 +2757,12 @@ VOLATILE(bool) gc_heap::full_gc_approach_event_set;
 
 bool gc_heap::special_sweep_p = false;
 
+#ifdef USE_REGIONS
+int  gc_heap::sip_gen2_surv_ratio_th = sip_gen2_surv_ratio_default_th;
+
+int  gc_heap::sip_pinned_gcs_count_th = sip_pinned_gcs_th;
+#endif //USE_REGIONS
+
 size_t gc_heap::full_gc_counts[gc_type_max];
 
 bool gc_heap::maxgen_size_inc_p = false;
@@ -5375,12 +5447,10 @@ void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node)
     }
 
     uint32_t flags = VirtualReserveFlags::None;
-#ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     if (virtual_alloc_hardware_write_watch)
     {
         flags = VirtualReserveFlags::WriteWatch;
     }
-#endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
     void* prgmem = use_large_pages_p ?
         GCToOSInterface::VirtualReserveAndCommitLargePages(requested_size, numa_node) :
@@ -5956,6 +6026,8 @@ public:
     // more on the machine if GC threads aren't using all of them.
     static uint16_t total_numa_nodes;
     static node_heap_count heaps_on_node[MAX_SUPPORTED_NODES];
+    // the index into heaps_on_node for each heap, ie, which of the total_numa_nodes nodes in use it's on
+    static uint16_t heap_no_to_numa_node_index[MAX_SUPPORTED_CPUS];
 
     static int access_time(uint8_t *sniff_buffer, int heap_number, unsigned sniff_index, unsigned n_sniff_buffers)
     {
@@ -6058,7 +6130,13 @@ public:
         if (GCToOSInterface::CanGetCurrentProcessorNumber())
         {
             uint32_t proc_no = GCToOSInterface::GetCurrentProcessorNumber();
-            return proc_no_to_heap_no[proc_no];
+            int adjusted_heap = proc_no_to_heap_no[proc_no];
+            // with fewer active heaps, fold the heap this processor maps to onto an active one
+            if (adjusted_heap >= gc_heap::n_active_heaps)
+            {
+                adjusted_heap %= gc_heap::n_active_heaps;
+            }
+            return adjusted_heap;
         }
 
         unsigned sniff_index = Interlocked::Increment(&cur_sniff_index);
@@ -6070,7 +6148,7 @@ public:
 
         uint8_t *l_sniff_buffer = sniff_buffer;
         unsigned l_n_sniff_buffers = n_sniff_buffers;
-        for (int heap_number = 0; heap_number < gc_heap::n_heaps; heap_number++)
+        for (int heap_number = 0; heap_number < gc_heap::n_active_heaps; heap_number++)
         {
             int this_access_time = access_time(l_sniff_buffer, heap_number, sniff_index, l_n_sniff_buffers);
             if (this_access_time < best_access_time)
@@ -6147,6 +6225,7 @@ public:
         memset (heaps_on_node, 0, sizeof (heaps_on_node));
         heaps_on_node[0].node_no = heap_no_to_numa_node[0];
         heaps_on_node[0].heap_count = 1;
+        heap_no_to_numa_node_index[0] = 0;
 
         for (int i=1; i < nheaps; i++)
         {
@@ -6161,6 +6240,7 @@ public:
                 numa_node_to_heap_map[heap_no_to_numa_node[i]] = (uint16_t)i;
             }
             (heaps_on_node[total_numa_nodes].heap_count)++;
+            heap_no_to_numa_node_index[i] = total_numa_nodes;
         }
 
         // Set the end of the heap range for the last NUMA node
@@ -6227,6 +6307,9 @@ public:
         uint16_t numa_node = heap_no_to_numa_node[hn];
         *start = (int)numa_node_to_heap_map[numa_node];
         *end   = (int)(numa_node_to_heap_map[numa_node+1]);
+        // only balance within the active heaps - hn itself is always active so this range is never empty
+        assert (hn < gc_heap::n_active_heaps);
+        *end   = min (*end, gc_heap::n_active_heaps);
 #ifdef HEAP_BALANCE_INSTRUMENTATION
         dprintf(HEAP_BALANCE_TEMP_LOG, ("TEMPget_heap_range: %d is in numa node %d, start = %d, end = %d", hn, numa_node, *start, *end));
 #endif //HEAP_BALANCE_INSTRUMENTATION
@@ -6279,6 +6362,7 @@ uint16_t heap_select::proc_no_to_numa_node[MAX_SUPPORTED_CPUS];
 uint16_t heap_select::numa_node_to_heap_map[MAX_SUPPORTED_CPUS+4];
 uint16_t  heap_select::total_numa_nodes;
 node_heap_count heap_select::heaps_on_node[MAX_SUPPORTED_NODES];
+uint16_t  heap_select::heap_no_to_numa_node_index[MAX_SUPPORTED_CPUS];
 
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 // This records info we use to look at effect of different strategies
@@ -6664,10 +6748,32 @@ void gc_heap::gc_thread_function ()
 
         if (heap_number == 0)
         {
-            uint32_t wait_result = gc_heap::ee_suspend_event.Wait(gradual_decommit_in_progress_p ? DECOMMIT_TIME_STEP_MILLISECONDS : INFINITE, FALSE);
+            uint32_t wait_time = INFINITE;
+            if (gradual_decommit_in_progress_p)
+            {
+                wait_time = DECOMMIT_TIME_STEP_MILLISECONDS;
+            }
+            else if (memory_limit_poll_interval != 0)
+            {
+                wait_time = (uint32_t)min ((uint64_t)(INFINITE - 1), (memory_limit_poll_interval / 1000));
+            }
+
+            uint32_t wait_result = gc_heap::ee_suspend_event.Wait(wait_time, FALSE);
             if (wait_result == WAIT_TIMEOUT)
             {
-                gradual_decommit_in_progress_p = decommit_step ();
+                if (gradual_decommit_in_progress_p)
+                {
+                    gradual_decommit_in_progress_p = decommit_step ();
+                }
+                if (check_memory_limit_change())
+                {
+#ifdef USE_REGIONS
+                    if (decommit_free_regions_on_memory_pressure())
+                    {
+                        gradual_decommit_in_progress_p = TRUE;
+                    }
+#endif //USE_REGIONS
+                }
                 continue;
             }
 
@@ -6675,6 +6781,7 @@ void gc_heap::gc_thread_function ()
             BEGIN_TIMING(suspend_ee_during_log);
             GCToEEInterface::SuspendEE(SUSPEND_FOR_GC);
             END_TIMING(suspend_ee_during_log);
+            check_memory_limit_change();
 
             proceed_with_gc_p = TRUE;
             gradual_decommit_in_progress_p = FALSE;
@@ -7257,6 +7364,11 @@ void gc_heap::fix_allocation_context (alloc_context* acontext, BOOL for_gc_p,
                  (size_t)acontext,
                  (size_t)acontext->alloc_ptr, (size_t)acontext->alloc_limit));
 
+    if (for_gc_p)
+    {
+        update_alloc_context_quantum_level (acontext);
+    }
+
     if (acontext->alloc_ptr == 0)
     {
         return;
@@ -9694,6 +9806,20 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+    if (item_count <= 1)
+        return;
+
+#ifdef TARGET_ARM64
+    // there's no downclocking to worry about with NEON, this is just where the
+    // vectorized partitioning starts paying for its setup
+    const size_t NEON_THRESHOLD_SIZE = 1024;
+
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const size_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -9702,9 +9828,6 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // despite possible downclocking on current devices
     const size_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
 
-    if (item_count <= 1)
-        return;
-
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -9719,6 +9842,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
             do_vxsort_avx2 (item_array, &item_array[item_count - 1], range_low, range_high);
         }
     }
+#endif //TARGET_ARM64
     else
     {
         dprintf (3, ("Sorting mark lists"));
@@ -10337,11 +10461,16 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::NEON);
+#else //TARGET_ARM64
+    bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::AVX2);
+#endif //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -11266,6 +11395,22 @@ void gc_heap::set_region_gen_num (heap_segment* region, int gen_num)
     assert (gen_num < (1 << (sizeof (uint8_t) * 8)));
     assert (gen_num >= 0);
     heap_segment_gen_num (region) = (uint8_t)gen_num;
+    update_region_to_generation_map (get_region_start (region), heap_segment_reserved (region), gen_num);
+}
+
+// The write barrier compares the entries of the source and the destination, so this needs
+// to be kept in sync with heap_segment_gen_num for all the basic regions a region covers.
+inline
+void gc_heap::update_region_to_generation_map (uint8_t* start, uint8_t* end, int gen_num)
+{
+    if (map_region_to_generation_skewed)
+    {
+        size_t end_index = (size_t)end >> min_segment_size_shr;
+        for (size_t index = (size_t)start >> min_segment_size_shr; index < end_index; index++)
+        {
+            map_region_to_generation_skewed[index] = (uint8_t)gen_num;
+        }
+    }
 }
 
 inline
@@ -11445,6 +11590,8 @@ void gc_heap::init_heap_segment (heap_segment* seg, gc_heap* hp
     heap_segment_gen_num (seg) = (uint8_t)gen_num_for_region;
     heap_segment_plan_gen_num (seg) = gen_num_for_region;
     heap_segment_swept_in_plan (seg) = false;
+    heap_segment_pinned_survived_gcs (seg) = 0;
+    update_region_to_generation_map (start, (start + size), gen_num_for_region);
 #endif //USE_REGIONS
 
 #ifdef USE_REGIONS
@@ -11783,8 +11930,36 @@ void gc_heap::rearrange_heap_segments(BOOL compacting)
 #endif //!USE_REGIONS
 
 #if defined(USE_REGIONS)
-// trim down the list of free regions pointed at by free_list down to target_count, moving the extra ones to surplus_list
-static void remove_surplus_regions (region_free_list* free_list, region_free_list* surplus_list, size_t target_count)
+int gc_heap::get_numa_node_index_of_heap (int hn)
+{
+#ifdef MULTIPLE_HEAPS
+    return heap_select::heap_no_to_numa_node_index[hn];
+#else //MULTIPLE_HEAPS
+    UNREFERENCED_PARAMETER(hn);
+    return 0;
+#endif //MULTIPLE_HEAPS
+}
+
+// A free region's memory was committed by the heap that last used it (and is on that heap's NUMA
+// node if we committed it with node affinity) - heap_segment_heap stays the same while the region
+// is just moved between free lists.
+int gc_heap::get_region_numa_node_index (heap_segment* region)
+{
+#ifdef MULTIPLE_HEAPS
+    gc_heap* hp = heap_segment_heap (region);
+    if (hp != nullptr)
+    {
+        return get_numa_node_index_of_heap (hp->heap_number);
+    }
+#else //MULTIPLE_HEAPS
+    UNREFERENCED_PARAMETER(region);
+#endif //MULTIPLE_HEAPS
+    return 0;
+}
+
+// trim down the list of free regions pointed at by free_list down to target_count, moving the extra ones
+// to the surplus list for the NUMA node they are on
+void gc_heap::remove_surplus_regions (region_free_list* free_list, region_free_list* node_surplus_lists, size_t target_count)
 {
     while (free_list->get_num_free_regions() > target_count)
     {
@@ -11792,7 +11967,7 @@ static void remove_surplus_regions (region_free_list* free_list, region_free_lis
         heap_segment* region = free_list->unlink_region_front();
 
         // and put it on the surplus list
-        surplus_list->add_region_front (region);
+        node_surplus_lists[get_region_numa_node_index (region)].add_region_front (region);
     }
 }
 
@@ -12359,12 +12534,18 @@ void gc_heap::distribute_free_regions()
     size_t size_decommit_regions_by_time = 0;
     size_t heap_budget_in_region_units[MAX_SUPPORTED_CPUS][kind_count];
     size_t region_size[kind_count] = { global_region_allocator.get_region_alignment(), global_region_allocator.get_large_region_alignment() };
-    region_free_list surplus_regions[kind_count];
+#ifdef MULTIPLE_HEAPS
+    const int num_numa_nodes = heap_select::total_numa_nodes;
+#else //MULTIPLE_HEAPS
+    const int num_numa_nodes = 1;
+#endif //MULTIPLE_HEAPS
+    // surplus regions are kept per NUMA node so we can hand heaps regions whose memory is local to them
+    region_free_list surplus_regions[kind_count][MAX_SUPPORTED_NODES];
     for (int kind = basic_free_region; kind < kind_count; kind++)
     {
         // we may still have regions left on the regions_to_decommit list -
         // use these to fill the budget as well
-        surplus_regions[kind].transfer_regions (&global_regions_to_decommit[kind]);
+        remove_surplus_regions (&global_regions_to_decommit[kind], surplus_regions[kind], 0);
     }
 #ifdef MULTIPLE_HEAPS
     for (int i = 0; i < n_heaps; i++)
@@ -12403,6 +12584,14 @@ void gc_heap::distribute_free_regions()
 
         heap_budget_in_region_units[i][basic_free_region] = 0;
         heap_budget_in_region_units[i][large_free_region] = 0;
+#ifdef MULTIPLE_HEAPS
+        // heaps that are not active don't get allocated on so they don't need any free regions -
+        // whatever they have goes to the active heaps or gets decommitted.
+        if (i >= n_active_heaps)
+        {
+            continue;
+        }
+#endif //MULTIPLE_HEAPS
         for (int gen = soh_gen0; gen < total_generation_count; gen++)
         {
             ptrdiff_t budget_gen = max (hp->estimate_gen_growth (gen), 0);
@@ -12428,14 +12617,18 @@ void gc_heap::distribute_free_regions()
 
 #ifndef MULTIPLE_HEAPS
     // just to reduce the number of #ifdefs in the code below
-    const int n_heaps = 1;
+    const int n_active_heaps = 1;
 #endif //!MULTIPLE_HEAPS
 
     size_t num_huge_region_units_to_consider[kind_count] = { 0, free_space_in_huge_regions / region_size[large_free_region] };
 
     for (int kind = basic_free_region; kind < kind_count; kind++)
     {
-        num_regions_to_decommit[kind] = surplus_regions[kind].get_num_free_regions();
+        num_regions_to_decommit[kind] = 0;
+        for (int node_index = 0; node_index < num_numa_nodes; node_index++)
+        {
+            num_regions_to_decommit[kind] += surplus_regions[kind][node_index].get_num_free_regions();
+        }
 
         dprintf(REGIONS_LOG, ("%Id %s free regions, %Id regions budget, %Id regions on decommit list, %Id huge regions to consider",
             total_num_free_regions[kind],
@@ -12460,10 +12653,10 @@ void gc_heap::distribute_free_regions()
 
             // we may have a deficit or  - if background GC is going on - a surplus.
             // adjust the budget per heap accordingly
-            ptrdiff_t adjustment_per_heap = (balance + (n_heaps - 1)) / n_heaps;
+            ptrdiff_t adjustment_per_heap = (balance + (n_active_heaps - 1)) / n_active_heaps;
 
 #ifdef MULTIPLE_HEAPS
-            for (int i = 0; i < n_heaps; i++)
+            for (int i = 0; i < n_active_heaps; i++)
             {
                 ptrdiff_t new_budget = (ptrdiff_t)heap_budget_in_region_units[i][kind] + adjustment_per_heap;
                 heap_budget_in_region_units[i][kind] = max (0, new_budget);
@@ -12524,35 +12717,67 @@ void gc_heap::distribute_free_regions()
                     i,
                     hp->free_regions[kind].get_num_free_regions()));
 
-                remove_surplus_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind]);
+                remove_surplus_regions (&hp->free_regions[kind], surplus_regions[kind], heap_budget_in_region_units[i][kind]);
+            }
+        }
+#endif //MULTIPLE_HEAPS
+
+        // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions.
+        // In the first pass a heap only gets regions from its own NUMA node; only if that node's surplus
+        // is exhausted does the second pass take regions from the other nodes.
+        for (int pass = 0; pass < 2; pass++)
+        {
+#ifdef MULTIPLE_HEAPS
+            for (int i = 0; i < n_heaps; i++)
+            {
+                gc_heap* hp = g_heaps[i];
+#else //MULTIPLE_HEAPS
+            {
+                gc_heap* hp = pGenGCHeap;
+                const int i = 0;
+#endif //MULTIPLE_HEAPS
+                int home_node_index = get_numa_node_index_of_heap (i);
+                int first_node_offset = ((pass == 0) ? 0 : 1);
+                int last_node_offset = ((pass == 0) ? 1 : num_numa_nodes);
+
+                for (int node_offset = first_node_offset; node_offset < last_node_offset; node_offset++)
+                {
+                    if (hp->free_regions[kind].get_num_free_regions() >= heap_budget_in_region_units[i][kind])
+                    {
+                        break;
+                    }
+
+                    int node_index = (home_node_index + node_offset) % num_numa_nodes;
+                    int64_t num_added_regions = add_regions (&hp->free_regions[kind], &surplus_regions[kind][node_index], heap_budget_in_region_units[i][kind]);
+                    dprintf (REGIONS_LOG, ("added %Id %s regions from node %d to heap %d (node %d) - now has %Id",
+                        num_added_regions,
+                        kind_name[kind],
+                        node_index,
+                        i,
+                        home_node_index,
+                        hp->free_regions[kind].get_num_free_regions()));
+                }
             }
         }
-        // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions
+
+#ifdef MULTIPLE_HEAPS
         for (int i = 0; i < n_heaps; i++)
         {
             gc_heap* hp = g_heaps[i];
 #else //MULTIPLE_HEAPS
         {
             gc_heap* hp = pGenGCHeap;
-            const int i = 0;
 #endif //MULTIPLE_HEAPS
-
-            if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[i][kind])
-            {
-                int64_t num_added_regions = add_regions (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[i][kind]);
-                dprintf (REGIONS_LOG, ("added %Id %s regions to heap %d - now has %Id",
-                    num_added_regions,
-                    kind_name[kind],
-                    i,
-                    hp->free_regions[kind].get_num_free_regions()));
-            }
             hp->free_regions[kind].sort_by_committed_and_age();
         }
 
-        if (surplus_regions[kind].get_num_free_regions() > 0)
+        for (int node_index = 0; node_index < num_numa_nodes; node_index++)
         {
-            assert (!"should have exhausted the surplus_regions");
-            global_regions_to_decommit[kind].transfer_regions (&surplus_regions[kind]);
+            if (surplus_regions[kind][node_index].get_num_free_regions() > 0)
+            {
+                assert (!"should have exhausted the surplus_regions");
+                global_regions_to_decommit[kind].transfer_regions (&surplus_regions[kind][node_index]);
+            }
         }
     }
 
@@ -12573,6 +12798,123 @@ void gc_heap::distribute_free_regions()
 #endif //USE_REGIONS
 }
 
+#ifdef DYNAMIC_HEAP_COUNT
+// This is called by the thread that joined last at the end of a blocking GC, before
+// free regions get distributed. It records how long this GC took compared to the time
+// the application ran since the last one and how much was allocated, and based on the
+// last few samples decides how many heaps allocation contexts should be balanced over.
+//
+// All heaps keep participating in GCs; what changes is which heaps get allocated on
+// (see heap_select and balance_heaps) and which heaps get free regions in
+// distribute_free_regions, so the inactive heaps' free regions get decommitted.
+void gc_heap::update_dynamic_heap_count()
+{
+    dynamic_heap_count_data_t& data = dynamic_heap_count_data;
+
+    uint64_t now = GetHighPrecisionTimeStamp();
+    uint64_t gc_start_ts = dd_time_clock (g_heaps[0]->dynamic_data_of (0));
+
+    uint64_t total_alloc_bytes_soh = 0;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        total_alloc_bytes_soh += g_heaps[i]->total_alloc_bytes_soh;
+    }
+
+    if (data.last_gc_end_ts == 0)
+    {
+        // first GC - we don't know how long the application ran before it.
+        data.last_gc_end_ts = now;
+        data.last_total_alloc_bytes_soh = total_alloc_bytes_soh;
+        return;
+    }
+
+    dynamic_heap_count_data_t::sample& sample = data.samples[data.sample_index];
+    sample.elapsed_between_gcs = (gc_start_ts > data.last_gc_end_ts) ? (gc_start_ts - data.last_gc_end_ts) : 0;
+    sample.gc_elapsed_time = now - gc_start_ts;
+    sample.allocated = (size_t)(total_alloc_bytes_soh - data.last_total_alloc_bytes_soh);
+    data.sample_index = (data.sample_index + 1) % dynamic_heap_count_data_t::sample_size;
+    data.samples_since_change++;
+
+    data.last_gc_end_ts = now;
+    data.last_total_alloc_bytes_soh = total_alloc_bytes_soh;
+
+    dprintf (DYNAMIC_HEAP_COUNT_LOG, ("[DHC] GC#%Id: %I64dus in GC, %I64dus between GCs, %Id bytes allocated, %d active heaps",
+        settings.gc_index, sample.gc_elapsed_time, sample.elapsed_between_gcs,
+        sample.allocated, n_active_heaps));
+
+    // don't decide on a partial window - all samples should reflect the current heap count.
+    if (data.samples_since_change < (size_t)dynamic_heap_count_data_t::sample_size)
+    {
+        return;
+    }
+
+    // the % of the elapsed time spent in GC for each sample - take the median so a single
+    // unusually long or short GC doesn't make us change the heap count.
+    float gc_percents[dynamic_heap_count_data_t::sample_size];
+    size_t total_allocated = 0;
+    uint64_t total_elapsed = 0;
+    for (int i = 0; i < dynamic_heap_count_data_t::sample_size; i++)
+    {
+        dynamic_heap_count_data_t::sample& s = data.samples[i];
+        uint64_t elapsed = s.elapsed_between_gcs + s.gc_elapsed_time;
+        gc_percents[i] = (elapsed == 0) ? 0.0f : (float)s.gc_elapsed_time * 100.0f / (float)elapsed;
+        total_allocated += s.allocated;
+        total_elapsed += elapsed;
+    }
+    for (int i = 1; i < dynamic_heap_count_data_t::sample_size; i++)
+    {
+        for (int j = i; (j > 0) && (gc_percents[j - 1] > gc_percents[j]); j--)
+        {
+            float temp = gc_percents[j];
+            gc_percents[j] = gc_percents[j - 1];
+            gc_percents[j - 1] = temp;
+        }
+    }
+    float median_gc_percent = gc_percents[dynamic_heap_count_data_t::sample_size / 2];
+
+    // if the most recent sample allocated at a much higher rate than the window as a whole,
+    // the application is ramping up and we should not be giving up heaps.
+    uint64_t latest_elapsed = sample.elapsed_between_gcs + sample.gc_elapsed_time;
+    bool allocation_ramping_up_p = (latest_elapsed != 0) && (total_elapsed != 0) &&
+        (((double)sample.allocated / (double)latest_elapsed) > (2.0 * (double)total_allocated / (double)total_elapsed));
+
+    const float target_tcp = (float)dynamic_heap_count_data_t::target_tcp;
+    int new_n_active_heaps = n_active_heaps;
+
+    if (median_gc_percent > target_tcp)
+    {
+        // grow proportionally to how far above the target we are, but at most double each time.
+        float overshoot = (median_gc_percent - target_tcp) / target_tcp;
+        int step = max (1, (int)((float)n_active_heaps * overshoot + 0.5f));
+        step = min (step, n_active_heaps);
+        new_n_active_heaps = min (n_heaps, n_active_heaps + step);
+    }
+    else if ((median_gc_percent < (target_tcp / 4)) && !allocation_ramping_up_p && (n_active_heaps > 1))
+    {
+        // with fewer heaps the same allocation volume exhausts the budgets proportionally
+        // faster - only shrink if the GC cost we'd get with the smaller count stays well
+        // below the target, otherwise we'd just end up growing again.
+        int smaller_n_heaps = n_active_heaps - max (1, n_active_heaps / 4);
+        float projected_gc_percent = median_gc_percent * (float)n_active_heaps / (float)smaller_n_heaps;
+        if (projected_gc_percent < (target_tcp / 2))
+        {
+            new_n_active_heaps = smaller_n_heaps;
+        }
+    }
+
+    dprintf (DYNAMIC_HEAP_COUNT_LOG, ("[DHC] median GC %%: %d.%02d, ramping up: %d, %d->%d active heaps",
+        (int)median_gc_percent, (int)(median_gc_percent * 100) % 100, allocation_ramping_up_p,
+        n_active_heaps, new_n_active_heaps));
+
+    if (new_n_active_heaps != n_active_heaps)
+    {
+        assert ((new_n_active_heaps >= 1) && (new_n_active_heaps <= n_heaps));
+        n_active_heaps = new_n_active_heaps;
+        data.samples_since_change = 0;
+    }
+}
+#endif //DYNAMIC_HEAP_COUNT
+
 #ifdef WRITE_WATCH
 uint8_t* g_addresses [array_size+2]; // to get around the bug in GetWriteWatch
 
@@ -12707,10 +13049,13 @@ void gc_heap::update_card_table_bundle()
 void gc_heap::reset_write_watch_for_gc_heap(void* base_address, size_t region_size)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    SoftwareWriteWatch::ClearDirty(base_address, region_size);
-#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    GCToOSInterface::ResetWriteWatch(base_address, region_size);
+    if (!virtual_alloc_hardware_write_watch)
+    {
+        SoftwareWriteWatch::ClearDirty(base_address, region_size);
+        return;
+    }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    GCToOSInterface::ResetWriteWatch(base_address, region_size);
 }
 
 // static
@@ -12719,14 +13064,17 @@ void gc_heap::get_write_watch_for_gc_heap(bool reset, void *base_address, size_t
                                           bool is_runtime_suspended)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    SoftwareWriteWatch::GetDirty(base_address, region_size, dirty_pages, dirty_page_count_ref,
-                                 reset, is_runtime_suspended);
-#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    if (!virtual_alloc_hardware_write_watch)
+    {
+        SoftwareWriteWatch::GetDirty(base_address, region_size, dirty_pages, dirty_page_count_ref,
+                                     reset, is_runtime_suspended);
+        return;
+    }
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     UNREFERENCED_PARAMETER(is_runtime_suspended);
     bool success = GCToOSInterface::GetWriteWatch(reset, base_address, region_size, dirty_pages,
                                                   dirty_page_count_ref);
     assert(success);
-#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 }
 
 const size_t ww_reset_quantum = 128*1024*1024;
@@ -12786,7 +13134,7 @@ void gc_heap::reset_write_watch (BOOL concurrent_p)
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     // Software write watch currently requires the runtime to be suspended during reset.
     // See SoftwareWriteWatch::ClearDirty().
-    assert(!concurrent_p);
+    assert(!concurrent_p || virtual_alloc_hardware_write_watch);
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
     dprintf (2, ("bgc lowest: %Ix, bgc highest: %Ix",
@@ -13107,9 +13455,11 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
     if (can_use_write_watch_for_gc_heap() && GCConfig::GetConcurrentGC())
     {
         gc_can_use_concurrent = true;
-#ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+        virtual_alloc_hardware_write_watch = can_use_hardware_write_watch();
+#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         virtual_alloc_hardware_write_watch = true;
-#endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     }
     else
     {
@@ -13171,6 +13521,18 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 
         bookkeeping_covered_start = global_region_allocator.get_start();
 
+        if (GCConfig::GetGCRegionWriteBarrier())
+        {
+            size_t map_region_to_generation_size = (size_t)(g_gc_highest_address - g_gc_lowest_address) >> min_segment_size_shr;
+            uint8_t* map_region_to_generation = new (nothrow) uint8_t[map_region_to_generation_size];
+            // This is only an optimization for the write barrier so we can do without it.
+            if (map_region_to_generation)
+            {
+                memset (map_region_to_generation, 0, map_region_to_generation_size);
+                map_region_to_generation_skewed = map_region_to_generation - ((size_t)g_gc_lowest_address >> min_segment_size_shr);
+            }
+        }
+
         if (!allocate_initial_regions(number_of_heaps))
             return E_OUTOFMEMORY;
     }
@@ -13469,6 +13831,25 @@ gc_heap::init_semi_shared()
     bgc_alloc_spin_count = static_cast<uint32_t>(GCConfig::GetBGCSpinCount());
     bgc_alloc_spin = static_cast<uint32_t>(GCConfig::GetBGCSpin());
 
+    bgc_max_cpu_percent = static_cast<uint32_t>(GCConfig::GetBGCMaxCPUPercent());
+    if (bgc_max_cpu_percent >= 100)
+    {
+        bgc_max_cpu_percent = 0;
+    }
+
+    {
+        GCConfigStringHolder bgc_cpu_index_ranges_holder(GCConfig::GetBGCAffinitizeRanges());
+        uintptr_t bgc_affinity_mask = 0;
+        if (ParseGCHeapAffinitizeRanges (bgc_cpu_index_ranges_holder.Get(), &bgc_affinity_set, bgc_affinity_mask))
+        {
+            bgc_affinity_set_count = bgc_affinity_set.Count();
+        }
+        else
+        {
+            dprintf (1, ("GCBGCAffinitizeRanges is malformed, BGC threads will not be affinitized"));
+        }
+    }
+
     {
         int number_bgc_threads = get_num_heaps();
         if (!create_bgc_threads_support (number_bgc_threads))
@@ -13522,6 +13903,54 @@ gc_heap::init_semi_shared()
 
     dprintf (1, ("conserve_mem_setting = %d", conserve_mem_setting));
 
+    if (GCConfig::GetGCPauseTimeTarget() > 0)
+    {
+        pause_time_target = (uint64_t)GCConfig::GetGCPauseTimeTarget() * 1000;
+    }
+
+    dprintf (1, ("pause_time_target = %I64dus", pause_time_target));
+
+    if (GCConfig::GetGCMemoryLimitPollInterval() > 0)
+    {
+        memory_limit_poll_interval = (uint64_t)GCConfig::GetGCMemoryLimitPollInterval() * 1000;
+        memory_pressure_decommit_th = (uint32_t)min (100, max (1, (int)GCConfig::GetGCMemoryPressureDecommitTh()));
+    }
+
+    dprintf (1, ("memory_limit_poll_interval = %I64dus, memory_pressure_decommit_th = %d%%",
+        memory_limit_poll_interval, memory_pressure_decommit_th));
+
+#ifdef USE_REGIONS
+    if ((GCConfig::GetGCGen2SIPSurvRatio() > 0) && (GCConfig::GetGCGen2SIPSurvRatio() <= 100))
+    {
+        sip_gen2_surv_ratio_th = (int)GCConfig::GetGCGen2SIPSurvRatio();
+    }
+    dprintf (1, ("gen2 regions with %d%%+ survival are swept in plan", sip_gen2_surv_ratio_th));
+
+    if (GCConfig::GetGCSIPPinnedGCCount() >= 0)
+    {
+        sip_pinned_gcs_count_th = (int)GCConfig::GetGCSIPPinnedGCCount();
+    }
+    dprintf (1, ("ephemeral regions that keep pins for %d GCs in a row are swept in plan", sip_pinned_gcs_count_th));
+#endif //USE_REGIONS
+
+#ifdef DYNAMIC_HEAP_COUNT
+    dynamic_adaptation_mode = (int)GCConfig::GetGCDynamicAdaptationMode();
+    if ((dynamic_adaptation_mode != dynamic_adaptation_to_application_sizes) || (n_heaps == 1))
+    {
+        dynamic_adaptation_mode = dynamic_adaptation_default;
+    }
+
+    memset (&dynamic_heap_count_data, 0, sizeof (dynamic_heap_count_data));
+    if (dynamic_adaptation_mode == dynamic_adaptation_to_application_sizes)
+    {
+        // start out like workstation GC and let update_dynamic_heap_count grow
+        // the heap count once GCs become expensive.
+        n_active_heaps = 1;
+    }
+
+    dprintf (1, ("dynamic_adaptation_mode = %d, %d active heaps", dynamic_adaptation_mode, n_active_heaps));
+#endif //DYNAMIC_HEAP_COUNT
+
     ret = 1;
 
 cleanup:
@@ -14034,10 +14463,15 @@ gc_heap::init_gc_heap (int  h_number)
     {
         stomp_write_barrier_initialize(
 #if defined(MULTIPLE_HEAPS) || defined(USE_REGIONS)
-            reinterpret_cast<uint8_t*>(1), reinterpret_cast<uint8_t*>(~0)
+            reinterpret_cast<uint8_t*>(1), reinterpret_cast<uint8_t*>(~0),
 #else
-            ephemeral_low, ephemeral_high
+            ephemeral_low, ephemeral_high,
 #endif //!MULTIPLE_HEAPS || USE_REGIONS
+#ifdef USE_REGIONS
+            map_region_to_generation_skewed, (uint8_t)min_segment_size_shr
+#else
+            nullptr, 0
+#endif //USE_REGIONS
         );
     }
 
@@ -15562,8 +15996,45 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
+// The allocation quantum is what we give an alloc context at a minimum when it needs more space.
+// Contexts that keep coming back for more between GCs get a bigger one so they take the slow
+// path less often, while contexts that barely allocate get a smaller one so they don't leave
+// as much unused space in gen0 when their context gets fixed at the next GC.
+size_t gc_heap::get_alloc_context_quantum (alloc_context* acontext)
+{
+    if (acontext->alloc_refill_count < UINT16_MAX)
+    {
+        acontext->alloc_refill_count++;
+    }
+
+    int level = acontext->alloc_quantum_level;
+    size_t quantum = ((level >= 0) ? (allocation_quantum << level) : (allocation_quantum >> -level));
+    return Align (max (quantum, (size_t)1024), get_alignment_constant (TRUE));
+}
+
+// Called for each alloc context when it's fixed for a GC to move its quantum a
+// step up or down, depending on how many times it needed more space since the last GC.
+void gc_heap::update_alloc_context_quantum_level (alloc_context* acontext)
+{
+    const int min_quantum_level = -2;
+    const int max_quantum_level = 3;
+    const uint16_t hot_refill_count = 16;
+    const uint16_t cold_refill_count = 1;
+
+    if ((acontext->alloc_refill_count >= hot_refill_count) && (acontext->alloc_quantum_level < max_quantum_level))
+    {
+        acontext->alloc_quantum_level++;
+    }
+    else if ((acontext->alloc_refill_count <= cold_refill_count) && (acontext->alloc_quantum_level > min_quantum_level))
+    {
+        acontext->alloc_quantum_level--;
+    }
+
+    acontext->alloc_refill_count = 0;
+}
+
 size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+                                 int align_const, alloc_context* acontext)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -15572,7 +16043,8 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ?
+        get_alloc_context_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -15933,7 +16405,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 // We ask for more Align (min_obj_size)
                 // to make sure that we can insert a free object
                 // in adjust_limit will set the limit lower
-                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const, acontext);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 uint8_t*  remain = (free_list + limit);
@@ -16073,6 +16545,10 @@ void gc_heap::bgc_uoh_alloc_clr (uint8_t* alloc_start,
 }
 #endif //BACKGROUND_GC
 
+// How many fitting items a_fit_free_list_uoh_p looks at in the first suitable bucket before
+// settling for the smallest of them.
+const int uoh_best_fit_candidates = 8;
+
 BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
                                        alloc_context* acontext,
                                        uint32_t flags,
@@ -16091,10 +16567,16 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
     int cookie = -1;
 #endif //BACKGROUND_GC
 
-    for (unsigned int a_l_idx = allocator->first_suitable_bucket(size); a_l_idx < allocator->number_of_buckets(); a_l_idx++)
+    unsigned int first_bucket = allocator->first_suitable_bucket(size);
+    for (unsigned int a_l_idx = first_bucket; a_l_idx < allocator->number_of_buckets(); a_l_idx++)
     {
         uint8_t* free_list = allocator->alloc_list_head_of (a_l_idx);
         uint8_t* prev_free_item = 0;
+        uint8_t* best_free_item = 0;
+        uint8_t* best_prev_free_item = 0;
+        size_t best_free_item_size = 0;
+        int fits_considered = 0;
+
         while (free_list != 0)
         {
             dprintf (3, ("considering free list %Ix", (size_t)free_list));
@@ -16110,70 +16592,92 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
             // must fit exactly or leave formattable space
             if ((diff == 0) || (diff >= (ptrdiff_t)Align (min_obj_size, align_const)))
             {
+                if ((best_free_item == 0) || (free_list_size < best_free_item_size))
+                {
+                    best_free_item = free_list;
+                    best_prev_free_item = prev_free_item;
+                    best_free_item_size = free_list_size;
+                }
+
+                // Only the first suitable bucket has items smaller than the request, so that's the
+                // only one where looking further pays off; later buckets take the first fit. The
+                // search is bounded since the lists are only ordered by when items were threaded.
+                fits_considered++;
+                if ((diff == 0) || (a_l_idx != first_bucket) || (fits_considered >= uoh_best_fit_candidates))
+                {
+                    break;
+                }
+            }
+            prev_free_item = free_list;
+            free_list = free_list_slot (free_list);
+        }
+
+        if (best_free_item != 0)
+        {
+            free_list = best_free_item;
+            prev_free_item = best_prev_free_item;
+            size_t free_list_size = best_free_item_size;
 #ifdef BACKGROUND_GC
-                cookie = bgc_alloc_lock->uoh_alloc_set (free_list);
-                bgc_track_uoh_alloc();
+            cookie = bgc_alloc_lock->uoh_alloc_set (free_list);
+            bgc_track_uoh_alloc();
 #endif //BACKGROUND_GC
 
-                allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
-                remove_gen_free (gen_number, free_list_size);
+            allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+            remove_gen_free (gen_number, free_list_size);
 
-                // Substract min obj size because limit_from_size adds it. Not needed for LOH
-                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
-                                                gen_number, align_const);
-                dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
+            // Substract min obj size because limit_from_size adds it. Not needed for LOH
+            size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
+                                            gen_number, align_const, acontext);
+            dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
 #ifdef FEATURE_LOH_COMPACTION
-                if (loh_pad)
-                {
-                    make_unused_array (free_list, loh_pad);
-                    generation_free_obj_space (gen) += loh_pad;
-                    limit -= loh_pad;
-                    free_list += loh_pad;
-                    free_list_size -= loh_pad;
-                }
+            if (loh_pad)
+            {
+                make_unused_array (free_list, loh_pad);
+                generation_free_obj_space (gen) += loh_pad;
+                limit -= loh_pad;
+                free_list += loh_pad;
+                free_list_size -= loh_pad;
+            }
 #endif //FEATURE_LOH_COMPACTION
 
-                uint8_t*  remain = (free_list + limit);
-                size_t remain_size = (free_list_size - limit);
-                if (remain_size != 0)
-                {
-                    assert (remain_size >= Align (min_obj_size, align_const));
-                    make_unused_array (remain, remain_size);
-                }
-                if (remain_size >= Align(min_free_list, align_const))
-                {
-                    uoh_thread_gap_front (remain, remain_size, gen);
-                    add_gen_free (gen_number, remain_size);
-                    assert (remain_size >= Align (min_obj_size, align_const));
-                }
-                else
-                {
-                    generation_free_obj_space (gen) += remain_size;
-                }
-                generation_free_list_space (gen) -= free_list_size;
-                assert ((ptrdiff_t)generation_free_list_space (gen) >= 0);
-                generation_free_list_allocated (gen) += limit;
+            uint8_t*  remain = (free_list + limit);
+            size_t remain_size = (free_list_size - limit);
+            if (remain_size != 0)
+            {
+                assert (remain_size >= Align (min_obj_size, align_const));
+                make_unused_array (remain, remain_size);
+            }
+            if (remain_size >= Align(min_free_list, align_const))
+            {
+                uoh_thread_gap_front (remain, remain_size, gen);
+                add_gen_free (gen_number, remain_size);
+                assert (remain_size >= Align (min_obj_size, align_const));
+            }
+            else
+            {
+                generation_free_obj_space (gen) += remain_size;
+            }
+            generation_free_list_space (gen) -= free_list_size;
+            assert ((ptrdiff_t)generation_free_list_space (gen) >= 0);
+            generation_free_list_allocated (gen) += limit;
 
-                dprintf (3, ("found fit on loh at %Ix", free_list));
+            dprintf (3, ("found fit on loh at %Ix", free_list));
 #ifdef BACKGROUND_GC
-                if (cookie != -1)
-                {
-                    bgc_uoh_alloc_clr (free_list, limit, acontext, flags, gen_number, align_const, cookie, FALSE, 0);
-                }
-                else
+            if (cookie != -1)
+            {
+                bgc_uoh_alloc_clr (free_list, limit, acontext, flags, gen_number, align_const, cookie, FALSE, 0);
+            }
+            else
 #endif //BACKGROUND_GC
-                {
-                    adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
-                }
-
-                //fix the limit to compensate for adjust_limit_clr making it too short
-                acontext->alloc_limit += Align (min_obj_size, align_const);
-                can_fit = TRUE;
-                goto exit;
+            {
+                adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
             }
-            prev_free_item = free_list;
-            free_list = free_list_slot (free_list);
+
+            //fix the limit to compensate for adjust_limit_clr making it too short
+            acontext->alloc_limit += Align (min_obj_size, align_const);
+            can_fit = TRUE;
+            goto exit;
         }
     }
 exit:
@@ -16216,7 +16720,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, align_const, acontext);
         goto found_fit;
     }
 
@@ -16227,7 +16731,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, align_const, acontext);
 
         if (grow_heap_segment (seg, (allocated + limit), &hard_limit_short_seg_end_p))
         {
@@ -17553,6 +18057,22 @@ allocation_state gc_heap::try_allocate_more_space (alloc_context* acontext, size
 #ifdef MULTIPLE_HEAPS
 void gc_heap::balance_heaps (alloc_context* acontext)
 {
+    if ((acontext->get_alloc_heap () != NULL) &&
+        (acontext->get_alloc_heap ()->pGenGCHeap->heap_number >= n_active_heaps))
+    {
+        // the heap this context was allocating on is no longer active (the heap count
+        // was reduced during the last GC), move it over to an active heap right away.
+        // alloc_context_count counts the contexts allocating on each heap, so it moves
+        // along with the context - the counts then stay right whichever way the heap
+        // count changes next.
+        int home_hp_num = heap_select::select_heap (acontext);
+        acontext->get_alloc_heap ()->pGenGCHeap->alloc_context_count--;
+        acontext->set_home_heap (GCHeap::GetHeap (home_hp_num));
+        acontext->set_alloc_heap (acontext->get_home_heap ());
+        acontext->get_home_heap ()->pGenGCHeap->alloc_context_count++;
+        dprintf (3, ("moved alloc context %p to active heap %d", (void*)acontext, home_hp_num));
+    }
+
     if (acontext->alloc_count < 4)
     {
         if (acontext->alloc_count == 0)
@@ -17666,7 +18186,7 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                     last_proc_no = proc_no;
                 }
 
-                int new_home_hp_num = heap_select::proc_no_to_heap_no[proc_no];
+                int new_home_hp_num = heap_select::proc_no_to_heap_no[proc_no] % n_active_heaps;
 #else
                 int new_home_hp_num = heap_select::select_heap(acontext);
 #endif //HEAP_BALANCE_INSTRUMENTATION
@@ -17675,7 +18195,7 @@ void gc_heap::balance_heaps (alloc_context* acontext)
 
                 int start, end, finish;
                 heap_select::get_heap_range_for_heap (new_home_hp_num, &start, &end);
-                finish = start + n_heaps;
+                finish = start + n_active_heaps;
 
                 do
                 {
@@ -17749,10 +18269,10 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                             if (heap_num >= end)
                                 heap_num -= count;
                             // wrap around if we hit the end of the heap numbers
-                            if (heap_num >= n_heaps)
-                                heap_num -= n_heaps;
+                            if (heap_num >= n_active_heaps)
+                                heap_num -= n_active_heaps;
 
-                            assert (heap_num < n_heaps);
+                            assert (heap_num < n_active_heaps);
                             gc_heap* hp = gc_heap::g_heaps[heap_num];
                             dd = hp->dynamic_data_of(0);
                             ptrdiff_t size = dd_new_allocation(dd);
@@ -17890,7 +18410,7 @@ gc_heap* gc_heap::balance_heaps_uoh (alloc_context* acontext, size_t alloc_size,
     size_t delta = dd_min_size (dd) / 2;
     int start, end;
     heap_select::get_heap_range_for_heap(home_hp_num, &start, &end);
-    const int finish = start + n_heaps;
+    const int finish = start + n_active_heaps;
 
 try_again:
     gc_heap* max_hp = home_hp;
@@ -17902,7 +18422,7 @@ try_again:
 
     for (int i = start; i < end; i++)
     {
-        gc_heap* hp = GCHeap::GetHeap(i%n_heaps)->pGenGCHeap;
+        gc_heap* hp = GCHeap::GetHeap(i%n_active_heaps)->pGenGCHeap;
         const ptrdiff_t size = hp->get_balance_heaps_uoh_effective_budget (generation_num);
 
         dprintf (3, ("hp: %d, size: %d", hp->heap_number, size));
@@ -17943,7 +18463,7 @@ gc_heap* gc_heap::balance_heaps_uoh_hard_limit_retry (alloc_context* acontext, s
     dprintf (3, ("[h%d] balance_heaps_loh_hard_limit_retry alloc_size: %d", home_heap, alloc_size));
     int start, end;
     heap_select::get_heap_range_for_heap (home_heap, &start, &end);
-    const int finish = start + n_heaps;
+    const int finish = start + n_active_heaps;
 
     gc_heap* max_hp = nullptr;
     size_t max_end_of_seg_space = alloc_size; // Must be more than this much, or return NULL
@@ -17952,7 +18472,7 @@ try_again:
     {
         for (int i = start; i < end; i++)
         {
-            gc_heap* hp = GCHeap::GetHeap (i%n_heaps)->pGenGCHeap;
+            gc_heap* hp = GCHeap::GetHeap (i%n_active_heaps)->pGenGCHeap;
             heap_segment* seg = generation_start_segment (hp->generation_of (generation_num));
             // With a hard limit, there is only one segment.
             assert (heap_segment_next (seg) == nullptr);
@@ -21084,6 +21604,12 @@ void gc_heap::gc1()
                 // compute max of gen0_must_clear_bricks over all heaps
                 max_gen0_must_clear_bricks = max(max_gen0_must_clear_bricks, hp->gen0_must_clear_bricks);
             }
+#ifdef DYNAMIC_HEAP_COUNT
+            if (dynamic_adaptation_mode == dynamic_adaptation_to_application_sizes)
+            {
+                update_dynamic_heap_count();
+            }
+#endif //DYNAMIC_HEAP_COUNT
 #ifdef USE_REGIONS
             distribute_free_regions();
 #endif //USE_REGIONS
@@ -22322,7 +22848,10 @@ void gc_heap::garbage_collect (int n)
             if (do_concurrent_p)
             {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-                SoftwareWriteWatch::EnableForGCHeap();
+                if (!virtual_alloc_hardware_write_watch)
+                {
+                    SoftwareWriteWatch::EnableForGCHeap();
+                }
 #endif //FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 #ifdef MULTIPLE_HEAPS
@@ -23164,12 +23693,57 @@ BOOL gc_heap::background_mark1 (uint8_t* o)
     {
         mark_array_set_marked (o);
         dprintf (4, ("n*%Ix*n", (size_t)o));
+        if (bgc_mark_walk_callback)
+        {
+            record_bgc_marked_object (o);
+        }
         return TRUE;
     }
     else
         return FALSE;
 }
 
+void gc_heap::record_bgc_marked_object (uint8_t* o)
+{
+    // Only objects that can't move before this BGC completes are reported. Foreground GCs
+    // can compact ephemeral objects under us, and they mark with their own settings where
+    // concurrent is not set.
+    if (!settings.concurrent)
+    {
+        return;
+    }
+
+#ifdef USE_REGIONS
+    if (get_region_gen_num (o) < max_generation)
+#else
+    // The object may belong to another heap, whose ephemeral range is not ours.
+#ifdef MULTIPLE_HEAPS
+    gc_heap* hp = heap_of (o);
+#else
+    gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+    if ((o >= hp->ephemeral_low) && (o < hp->ephemeral_high))
+#endif //USE_REGIONS
+    {
+        return;
+    }
+
+    bgc_marked_objects[bgc_marked_objects_count++] = o;
+    if (bgc_marked_objects_count == bgc_marked_objects_chunk)
+    {
+        flush_bgc_marked_objects();
+    }
+}
+
+void gc_heap::flush_bgc_marked_objects()
+{
+    if (bgc_marked_objects_count != 0)
+    {
+        bgc_mark_walk_callback ((Object**)bgc_marked_objects, bgc_marked_objects_count, bgc_mark_walk_context);
+        bgc_marked_objects_count = 0;
+    }
+}
+
 // TODO: we could consider filtering out NULL's here instead of going to
 // look for it on other heaps
 inline
@@ -23762,8 +24336,13 @@ gc_heap::mark_steal()
         ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
     }
 
-    //pick the next heap as our buddy
-    int thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
+    //pick the heap that's likely to have the most marking left to do as our buddy,
+    //otherwise the next heap on our node
+    int thpn = mark_steal_busiest_heap;
+    if ((thpn == heap_number) || !same_numa_node_p (thpn, heap_number))
+    {
+        thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
+    }
 
 #ifdef SNOOP_STATS
         dprintf (SNOOP_LOG, ("(GC%d)heap%d: start snooping %d", settings.gc_index, heap_number, (heap_number+1)%n_heaps));
@@ -23951,6 +24530,58 @@ gc_heap::mark_steal()
     }
 }
 
+// For full GCs, stealing is worth it once the heap is large enough. For ephemeral GCs
+// the amount to mark is usually small and evenly spread, so we only steal when the
+// survivors in the condemned generations were concentrated on a few heaps last time,
+// eg when one heap holds a big object graph that gets promoted through gen0 and gen1.
+BOOL gc_heap::decide_on_mark_steal (int condemned_gen_number)
+{
+    const size_t full_gc_mark_steal_th = 100 * 1024 * 1024;
+    const size_t ephemeral_mark_steal_th = 16 * 1024 * 1024;
+
+    if (n_heaps == 1)
+    {
+        return FALSE;
+    }
+
+    size_t total_promoted = 0;
+    size_t max_promoted = 0;
+    int max_promoted_heap = 0;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        size_t promoted = 0;
+        for (int gen = 0; gen <= condemned_gen_number; gen++)
+        {
+            promoted += dd_promoted_size (hp->dynamic_data_of (gen));
+        }
+        total_promoted += promoted;
+        if (promoted > max_promoted)
+        {
+            max_promoted = promoted;
+            max_promoted_heap = i;
+        }
+    }
+
+    mark_steal_busiest_heap = max_promoted_heap;
+
+    BOOL steal_p = FALSE;
+    if (condemned_gen_number == max_generation)
+    {
+        steal_p = (get_total_heap_size() > full_gc_mark_steal_th);
+    }
+    else
+    {
+        size_t average_promoted = total_promoted / n_heaps;
+        steal_p = ((max_promoted > ephemeral_mark_steal_th) && (max_promoted > (2 * average_promoted)));
+    }
+
+    dprintf (3, ("gen%d GC: most promoted %Id on h%d, total %Id -> mark steal: %d",
+        condemned_gen_number, max_promoted, max_promoted_heap, total_promoted, steal_p));
+
+    return steal_p;
+}
+
 inline
 BOOL gc_heap::check_next_mark_stack (gc_heap* next_heap)
 {
@@ -25568,16 +26199,13 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 #endif //SNOOP_STATS
 
 #ifdef MH_SC_MARK
-    if (full_p)
+    //initialize the mark stack - we don't know yet whether other heaps will steal from it
+    for (int i = 0; i < max_snoop_level; i++)
     {
-        //initialize the mark stack
-        for (int i = 0; i < max_snoop_level; i++)
-        {
-            ((uint8_t**)(mark_stack_array))[i] = 0;
-        }
-
-        mark_stack_busy() = 1;
+        ((uint8_t**)(mark_stack_array))[i] = 0;
     }
+
+    mark_stack_busy() = 1;
 #endif //MH_SC_MARK
 
     static uint32_t num_sizedrefs = 0;
@@ -25661,23 +26289,7 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
 #ifdef MULTIPLE_HEAPS
 #ifdef MH_SC_MARK
-        if (full_p)
-        {
-            size_t total_heap_size = get_total_heap_size();
-
-            if (total_heap_size > (100 * 1024 * 1024))
-            {
-                do_mark_steal_p = TRUE;
-            }
-            else
-            {
-                do_mark_steal_p = FALSE;
-            }
-        }
-        else
-        {
-            do_mark_steal_p = FALSE;
-        }
+        do_mark_steal_p = decide_on_mark_steal (condemned_gen_number);
 #endif //MH_SC_MARK
 
         gc_t_join.restart();
@@ -28616,8 +29228,15 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
 #ifdef USE_REGIONS
             heap_segment_pinned_survived (seg1) = pinned_survived_region;
-            dprintf (REGIONS_LOG, ("h%d setting seg %Ix pin surv: %Ix",
-                heap_number, heap_segment_mem (seg1), pinned_survived_region));
+            // SIP regions don't separate out their pins so we leave their history alone.
+            if (!heap_segment_swept_in_plan (seg1))
+            {
+                heap_segment_pinned_survived_gcs (seg1) = ((pinned_survived_region > 0) ?
+                    (heap_segment_pinned_survived_gcs (seg1) + 1) : 0);
+            }
+            dprintf (REGIONS_LOG, ("h%d setting seg %Ix pin surv: %Ix (%d GCs)",
+                heap_number, heap_segment_mem (seg1), pinned_survived_region,
+                heap_segment_pinned_survived_gcs (seg1)));
             pinned_survived_region = 0;
             if (heap_segment_mem (seg1) == heap_segment_allocated (seg1))
             {
@@ -30660,13 +31279,22 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
         size_t basic_region_size = (size_t)1 << min_segment_size_shr;
         assert (heap_segment_gen_num (region) == heap_segment_plan_gen_num (region));
 
+        // When the GC was induced to compact or is trying to avoid an OOM, we want
+        // everything that can be gotten back, so only the densest gen2 regions are
+        // swept, as for the other generations.
+        int surv_ratio_th = sip_surv_ratio_th;
+        if ((gen_num == max_generation) && !is_induced_blocking (settings.reason) &&
+            !last_gc_before_oom && !heap_hard_limit)
+        {
+            surv_ratio_th = sip_gen2_surv_ratio_th;
+        }
         int surv_ratio = (int)(((double)heap_segment_survived (region) * 100.0) / (double)basic_region_size);
         dprintf (2222, ("SSIP: region %Ix surv %Id / %Id = %d%%(%d)",
             heap_segment_mem (region),
             heap_segment_survived (region),
             basic_region_size,
-            surv_ratio, sip_surv_ratio_th));
-        if (surv_ratio >= sip_surv_ratio_th)
+            surv_ratio, surv_ratio_th));
+        if (surv_ratio >= surv_ratio_th)
         {
             set_region_plan_gen_num (region, new_gen_num);
             sip_p = true;
@@ -30681,7 +31309,17 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
                 heap_segment_old_card_survived (region),
                 basic_region_size,
                 old_card_surv_ratio, sip_surv_ratio_th));
-            if (old_card_surv_ratio >= sip_old_card_surv_ratio_th)
+
+            // Compacting around pins that keep surviving leaves this region fragmented
+            // and demoted GC after GC, so we move the whole region out of the way.
+            bool long_lived_pins_p = ((sip_pinned_gcs_count_th > 0) &&
+                (heap_segment_pinned_survived_gcs (region) >= sip_pinned_gcs_count_th));
+            dprintf (2222, ("SSIP: region %Ix kept pins for %d GCs(%d)",
+                heap_segment_mem (region),
+                heap_segment_pinned_survived_gcs (region),
+                sip_pinned_gcs_count_th));
+
+            if ((old_card_surv_ratio >= sip_old_card_surv_ratio_th) || long_lived_pins_p)
             {
                 set_region_plan_gen_num (region, max_generation);
                 sip_maxgen_regions_per_gen[gen_num]++;
@@ -33370,6 +34008,105 @@ void gc_heap::allow_fgc()
             GCToEEInterface::DisablePreemptiveGC();
         }
     }
+
+    if (bgc_max_cpu_percent && cm_in_progress)
+    {
+        bgc_duty_cycle();
+    }
+}
+
+// How much concurrent mark work a BGC thread does before it checks whether it
+// should pause, and how long a slice of that work is.
+#define bgc_duty_cycle_check_interval (256)
+#define bgc_duty_cycle_quantum_us (10 * 1000)
+
+void gc_heap::bgc_duty_cycle()
+{
+    if ((++bgc_duty_cycle_check_count % bgc_duty_cycle_check_interval) != 0)
+    {
+        return;
+    }
+
+    uint64_t now = GetHighPrecisionTimeStamp();
+    if (bgc_duty_cycle_start == 0)
+    {
+        bgc_duty_cycle_start = now;
+        return;
+    }
+
+    uint64_t elapsed = now - bgc_duty_cycle_start;
+    if (elapsed < bgc_duty_cycle_quantum_us)
+    {
+        return;
+    }
+
+    if (!bgc_mark_outpaced_p())
+    {
+        // We ran for elapsed us, so idle long enough for that to be bgc_max_cpu_percent
+        // of the whole slice.
+        uint32_t pause_ms = (uint32_t)((elapsed * (100 - bgc_max_cpu_percent)) / ((uint64_t)bgc_max_cpu_percent * 1000));
+        if (pause_ms)
+        {
+            dprintf (2, ("h%d BGC ran %I64dus, pausing %dms", heap_number, elapsed, pause_ms));
+            bool cooperative_mode = enable_preemptive ();
+            GCToOSInterface::Sleep (pause_ms);
+            disable_preemptive (cooperative_mode);
+        }
+    }
+
+    bgc_duty_cycle_start = GetHighPrecisionTimeStamp();
+}
+
+bool gc_heap::bgc_mark_outpaced_p()
+{
+    // UOH allocations are already being made to wait for this BGC, slowing it
+    // down would only make them wait longer.
+    if ((bgc_loh_allocate_spin() != 0) || (bgc_poh_allocate_spin() != 0))
+    {
+        return true;
+    }
+
+#ifdef BGC_SERVO_TUNING
+    // With FL tuning we know how many gen1 GCs it took to use up the budget that
+    // triggered this BGC. If we have done as many during this BGC, it will be
+    // triggered again as soon as it's done.
+    if (bgc_tuning::enable_fl_tuning && bgc_tuning::actual_num_gen1s_to_trigger)
+    {
+        size_t num_gen1s_since_start = get_current_gc_index (max_generation - 1) - bgc_tuning::gen1_index_last_bgc_start;
+        if (num_gen1s_since_start >= bgc_tuning::actual_num_gen1s_to_trigger)
+        {
+            return true;
+        }
+    }
+#endif //BGC_SERVO_TUNING
+
+    return false;
+}
+
+void gc_heap::set_bgc_thread_affinity()
+{
+    if (bgc_affinity_set_count == 0)
+    {
+        return;
+    }
+
+    // Spread the BGC threads over the configured processors.
+    size_t index = (size_t)heap_number % bgc_affinity_set_count;
+    for (size_t proc_no = 0; proc_no < MAX_SUPPORTED_CPUS; proc_no++)
+    {
+        if (bgc_affinity_set.Contains (proc_no))
+        {
+            if (index == 0)
+            {
+                if (!GCToOSInterface::SetThreadAffinity ((uint16_t)proc_no))
+                {
+                    dprintf (1, ("Failed to set thread affinity for BGC thread %d on proc #%d", heap_number, (int)proc_no));
+                }
+                break;
+            }
+            index--;
+        }
+    }
 }
 
 BOOL gc_heap::is_bgc_in_progress()
@@ -33861,6 +34598,8 @@ void gc_heap::background_mark_phase ()
     bgc_loh_size_increased = 0;
     bgc_poh_size_increased = 0;
     background_soh_size_end_mark = 0;
+    bgc_duty_cycle_start = 0;
+    bgc_duty_cycle_check_count = 0;
 
     dprintf (GTC_LOG, ("BM: h%d: loh: %Id, soh: %Id, poh: %Id", heap_number, total_loh_size, total_soh_size, total_poh_size));
 
@@ -33885,22 +34624,32 @@ void gc_heap::background_mark_phase ()
     if (bgc_t_join.joined())
 #endif //MULTIPLE_HEAPS
     {
+        // The thread that triggered this BGC holds the gc_lock until we restart the EE, so this
+        // can't race with DiagStreamBGCMarkedObjects.
+        bgc_mark_walk_callback = bgc_mark_walk_requested_callback;
+        bgc_mark_walk_context = bgc_mark_walk_requested_context;
+        bgc_mark_walk_requested_callback = nullptr;
+        bgc_mark_walk_requested_context = nullptr;
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         // Resetting write watch for software write watch is pretty fast, much faster than for hardware write watch. Reset
         // can be done while the runtime is suspended or after the runtime is restarted, the preference was to reset while
         // the runtime is suspended. The reset for hardware write watch is done after the runtime is restarted below.
-        concurrent_print_time_delta ("CRWW begin");
+        if (!virtual_alloc_hardware_write_watch)
+        {
+            concurrent_print_time_delta ("CRWW begin");
 
 #ifdef MULTIPLE_HEAPS
-        for (int i = 0; i < n_heaps; i++)
-        {
-            g_heaps[i]->reset_write_watch (FALSE);
-        }
+            for (int i = 0; i < n_heaps; i++)
+            {
+                g_heaps[i]->reset_write_watch (FALSE);
+            }
 #else
-        reset_write_watch (FALSE);
+            reset_write_watch (FALSE);
 #endif //MULTIPLE_HEAPS
 
-        concurrent_print_time_delta ("CRWW");
+            concurrent_print_time_delta ("CRWW");
+        }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
         num_sizedrefs = GCToEEInterface::GetTotalNumSizedRefHandles();
@@ -33929,36 +34678,35 @@ void gc_heap::background_mark_phase ()
     {
         disable_preemptive (true);
 
-#ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-        // When software write watch is enabled, resetting write watch is done while the runtime is
+        // When software write watch is used, resetting write watch is done while the runtime is
         // suspended above. The post-reset call to revisit_written_pages is only necessary for concurrent
         // reset_write_watch, to discard dirtied pages during the concurrent reset.
-#ifdef WRITE_WATCH
-        concurrent_print_time_delta ("CRWW begin");
+        if (virtual_alloc_hardware_write_watch)
+        {
+            concurrent_print_time_delta ("CRWW begin");
 
 #ifdef MULTIPLE_HEAPS
-        for (int i = 0; i < n_heaps; i++)
-        {
-            g_heaps[i]->reset_write_watch (TRUE);
-        }
+            for (int i = 0; i < n_heaps; i++)
+            {
+                g_heaps[i]->reset_write_watch (TRUE);
+            }
 #else
-        reset_write_watch (TRUE);
+            reset_write_watch (TRUE);
 #endif //MULTIPLE_HEAPS
 
-        concurrent_print_time_delta ("CRWW");
-#endif //WRITE_WATCH
+            concurrent_print_time_delta ("CRWW");
 
 #ifdef MULTIPLE_HEAPS
-        for (int i = 0; i < n_heaps; i++)
-        {
-            g_heaps[i]->revisit_written_pages (TRUE, TRUE);
-        }
+            for (int i = 0; i < n_heaps; i++)
+            {
+                g_heaps[i]->revisit_written_pages (TRUE, TRUE);
+            }
 #else
-        revisit_written_pages (TRUE, TRUE);
+            revisit_written_pages (TRUE, TRUE);
 #endif //MULTIPLE_HEAPS
 
-        concurrent_print_time_delta ("CRW");
-#endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+            concurrent_print_time_delta ("CRW");
+        }
 
 #ifdef MULTIPLE_HEAPS
         for (int i = 0; i < n_heaps; i++)
@@ -34206,7 +34954,10 @@ void gc_heap::background_mark_phase ()
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         // The runtime is suspended, take this opportunity to pause tracking written pages to
         // avoid further perf penalty after the runtime is restarted
-        SoftwareWriteWatch::DisableForGCHeap();
+        if (!virtual_alloc_hardware_write_watch)
+        {
+            SoftwareWriteWatch::DisableForGCHeap();
+        }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
         GCToEEInterface::AfterGcScanRoots (max_generation, max_generation, &sc);
@@ -34278,11 +35029,25 @@ void gc_heap::background_mark_phase ()
     GCScan::GcWeakPtrScan (max_generation, max_generation, &sc);
     concurrent_print_time_delta ("NR GcWeakPtrScan");
 
+    // Marking is done, hand over what's left of our chunk.
+    if (bgc_mark_walk_callback)
+    {
+        flush_bgc_marked_objects();
+    }
+
 #ifdef MULTIPLE_HEAPS
     bgc_t_join.join(this, gc_join_null_dead_syncblk);
     if (bgc_t_join.joined())
 #endif //MULTIPLE_HEAPS
     {
+        if (bgc_mark_walk_callback)
+        {
+            // Tells the callback this BGC won't report any more objects.
+            bgc_mark_walk_callback (nullptr, 0, bgc_mark_walk_context);
+            bgc_mark_walk_callback = nullptr;
+            bgc_mark_walk_context = nullptr;
+        }
+
         dprintf (2, ("calling GcWeakPtrScanBySingleThread"));
         // scan for deleted entries in the syncblk cache
         GCScan::GcWeakPtrScanBySingleThread (max_generation, max_generation, &sc);
@@ -35117,6 +35882,7 @@ void gc_heap::bgc_thread_function()
     bool cooperative_mode = true;
     bgc_thread_id.SetToCurrentThread();
     dprintf (1, ("bgc_thread_id is set to %x", (uint32_t)GCToOSInterface::GetCurrentThreadIdForLogging()));
+    set_bgc_thread_affinity();
     while (1)
     {
         // Wait for work to do...
@@ -36650,6 +37416,49 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first non-zero card word in [card_word, card_word_end[, or card_word_end if they are
+// all clear. In ephemeral GCs most card words are clear, so long spans are skipped with vector
+// instructions where we have them.
+inline
+uint32_t* find_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+    size_t num_card_words = card_word_end - card_word;
+#if defined(USE_VXSORT) && !defined(TARGET_ARM64)
+    // below this it's not worth calling out to the vectorized versions
+    const size_t AVX2_THRESHOLD_WORDS = 32;
+    const size_t AVX512F_THRESHOLD_WORDS = 256;
+
+    if ((num_card_words >= AVX2_THRESHOLD_WORDS) && IsSupportedInstructionSet (InstructionSet::AVX2))
+    {
+        if ((num_card_words >= AVX512F_THRESHOLD_WORDS) && IsSupportedInstructionSet (InstructionSet::AVX512F))
+        {
+            return do_find_card_word_avx512 (card_word, card_word_end);
+        }
+        return do_find_card_word_avx2 (card_word, card_word_end);
+    }
+#elif defined(TARGET_ARM64)
+    // NEON is always available on arm64 - look at 16 card words at a time
+    const size_t words_per_step = 16;
+    while (num_card_words >= words_per_step)
+    {
+        uint32x4_t v = vorrq_u32 (vorrq_u32 (vld1q_u32 (&card_word[0]), vld1q_u32 (&card_word[4])),
+                                  vorrq_u32 (vld1q_u32 (&card_word[8]), vld1q_u32 (&card_word[12])));
+        if (vmaxvq_u32 (v) != 0)
+            break;
+        card_word += words_per_step;
+        num_card_words -= words_per_step;
+    }
+#else
+    UNREFERENCED_PARAMETER(num_card_words);
+#endif //USE_VXSORT && !TARGET_ARM64
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -36674,10 +37483,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -36700,18 +37506,12 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
     }
     else
     {
-        uint32_t* card_word = &card_table[cardw];
-        uint32_t* card_word_end = &card_table [cardw_end];
+        uint32_t* card_word = find_card_word (&card_table[cardw], &card_table [cardw_end]);
 
-        while (card_word < card_word_end)
+        if (card_word != &card_table [cardw_end])
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -36761,12 +37561,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -39276,6 +40071,19 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
             new_allocation = linear_allocation_model (allocation_fraction, new_allocation,
                                                       dd_desired_allocation (dd), time_since_previous_collection_secs);
 
+            if (pause_budget_factor < 1.0f)
+            {
+                // trading throughput for shorter ephemeral pauses - see update_pause_budget_factor.
+                // this needs to be able to go below the generation's minimum budget, which is what
+                // keeps gen0 from getting smaller than the cache size and so what bounds the pause
+                // when gen0 is small. but not below a quarter of it, we'd just be doing GCs that have
+                // too little to collect to be worth their fixed cost.
+                size_t pause_allocation = max ((size_t)(new_allocation * pause_budget_factor), min_gc_size / 4);
+                dprintf (2, ("Reducing gen%d allocation from %Id to %Id for pause time target",
+                    gen_number, new_allocation, pause_allocation));
+                new_allocation = pause_allocation;
+            }
+
             if (gen_number == 0)
             {
                 if (pass == 0)
@@ -43859,6 +44667,7 @@ HRESULT GCHeap::Initialize()
     else
     {
         gc_heap::total_physical_mem = GCToOSInterface::GetPhysicalMemoryLimit (&gc_heap::is_restricted_physical_mem);
+        gc_heap::physical_mem_from_os_p = gc_heap::is_restricted_physical_mem;
     }
 #ifdef HOST_64BIT
     gc_heap::heap_hard_limit = (size_t)GCConfig::GetGCHeapHardLimit();
@@ -44147,6 +44956,7 @@ HRESULT GCHeap::Initialize()
 
 #ifdef MULTIPLE_HEAPS
     gc_heap::n_heaps = nhp;
+    gc_heap::n_active_heaps = nhp;
     hr = gc_heap::initialize_gc (seg_size, large_seg_size, pin_seg_size, nhp);
 #else
     hr = gc_heap::initialize_gc (seg_size, large_seg_size, pin_seg_size);
@@ -45779,6 +46589,168 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+// Called after each blocking ephemeral GC when a pause time target is set. Since the work
+// an ephemeral GC does is mostly proportional to what survives and a smaller budget means
+// less gets a chance to survive, we scale the gen0/gen1 budgets by pause_budget_factor
+// (applied in desired_new_allocation) and adjust that factor based on the pauses we see.
+void gc_heap::update_pause_budget_factor (uint64_t pause_duration)
+{
+    // don't let a single GC shrink the budget by more than half
+    const float max_decrease_step = 0.5f;
+    // grow budgets back slowly once we are below this fraction of the target
+    const float grow_threshold = 0.75f;
+    const float grow_step = 1.1f;
+    const float min_pause_budget_factor = 0.1f;
+
+    recent_ephemeral_pause = max (pause_duration, (recent_ephemeral_pause * 15) / 16);
+
+#ifdef TRACE_GC
+    float old_factor = pause_budget_factor;
+#endif //TRACE_GC
+    if (recent_ephemeral_pause > pause_time_target)
+    {
+        float decrease = max (max_decrease_step, (float)pause_time_target / (float)recent_ephemeral_pause);
+        pause_budget_factor = max (min_pause_budget_factor, pause_budget_factor * decrease);
+    }
+    else if (recent_ephemeral_pause < (uint64_t)(pause_time_target * grow_threshold))
+    {
+        pause_budget_factor = min (1.0f, pause_budget_factor * grow_step);
+    }
+
+    dprintf (1, ("GC#%Id pause %I64dus, recent %I64dus, target %I64dus, budget factor %d%% -> %d%%",
+        (size_t)settings.gc_index, pause_duration, recent_ephemeral_pause, pause_time_target,
+        (int)(old_factor * 100), (int)(pause_budget_factor * 100)));
+}
+
+// Called at the start of a GC and, with Server GC, periodically on heap 0's GC thread between GCs
+// when GCMemoryLimitPollInterval is set. The memory limit of a container can be changed while we
+// are running - taking the new limit into account means the memory load we compute reflects it.
+// Returns true if the limit shrank or the memory pressure is high enough that we should give free
+// memory back to the OS right away.
+bool gc_heap::check_memory_limit_change()
+{
+    if (memory_limit_poll_interval == 0)
+    {
+        return false;
+    }
+
+    uint64_t now = GetHighPrecisionTimeStamp();
+    if ((now - last_memory_limit_poll_time) < memory_limit_poll_interval)
+    {
+        return false;
+    }
+    last_memory_limit_poll_time = now;
+
+    bool decommit_p = false;
+
+    if (physical_mem_from_os_p)
+    {
+        // We don't go from restricted to not restricted (or back) while running, too many things
+        // were decided based on that at init time. The hard limit derived from the physical limit
+        // is also left alone as the range we reserved for the heap is based on it.
+        uint64_t new_physical_mem = GCToOSInterface::RefreshRestrictedPhysicalMemoryLimit();
+        if ((new_physical_mem != 0) && (new_physical_mem != total_physical_mem))
+        {
+            dprintf (1, ("physical memory limit changed from %I64dMB to %I64dMB",
+                (total_physical_mem / 1024 / 1024), (new_physical_mem / 1024 / 1024)));
+
+            decommit_p = (new_physical_mem < total_physical_mem);
+            total_physical_mem = new_physical_mem;
+
+            mem_one_percent = total_physical_mem / 100;
+#ifndef MULTIPLE_HEAPS
+            mem_one_percent /= g_num_processors;
+#endif //!MULTIPLE_HEAPS
+#if defined(HOST_64BIT)
+            youngest_gen_desired_th = mem_one_percent;
+#endif // HOST_64BIT
+        }
+    }
+
+    uint32_t memory_pressure = 0;
+    if (GCToOSInterface::GetMemoryPressure (&memory_pressure) && (memory_pressure >= memory_pressure_decommit_th))
+    {
+        dprintf (1, ("memory pressure %d%% >= %d%%", memory_pressure, memory_pressure_decommit_th));
+        decommit_p = true;
+    }
+
+    return decommit_p;
+}
+
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS)
+// Moves the back half of free_list to global_regions_to_decommit - free lists are sorted so the
+// regions at the front are the ones we'd rather reuse. A single free region is left alone.
+size_t gc_heap::move_free_regions_to_decommit (region_free_list* free_list)
+{
+    size_t num_regions_to_move = free_list->get_num_free_regions() / 2;
+    size_t num_regions_to_keep = free_list->get_num_free_regions() - num_regions_to_move;
+
+    heap_segment* region = free_list->get_first_free_region();
+    for (size_t i = 0; i < num_regions_to_keep; i++)
+    {
+        region = heap_segment_next (region);
+    }
+
+    heap_segment* next_region = nullptr;
+    for (; region != nullptr; region = next_region)
+    {
+        next_region = heap_segment_next (region);
+        region_free_list::unlink_region (region);
+        region_free_list::add_region (region, global_regions_to_decommit);
+    }
+
+    return num_regions_to_move;
+}
+
+// Called on heap 0's GC thread between GCs when check_memory_limit_change says we should give
+// memory back. Instead of inducing a GC we hand part of the free regions over to gradual decommit -
+// if the pressure doesn't go away, we'll do the same on the next poll.
+bool gc_heap::decommit_free_regions_on_memory_pressure()
+{
+#ifdef BACKGROUND_GC
+    // a BGC in progress also puts regions on the free lists
+    if (background_running_p())
+    {
+        return false;
+    }
+#endif //BACKGROUND_GC
+
+    size_t num_regions_moved = 0;
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+
+        // the allocator takes free regions while holding the more space locks - same as in
+        // decommit_ephemeral_segment_pages_step we can't wait for them on this thread
+        if (try_enter_spin_lock (&hp->more_space_lock_soh))
+        {
+            hp->add_saved_spinlock_info (false, me_acquire, mt_decommit_step);
+            num_regions_moved += move_free_regions_to_decommit (&hp->free_regions[basic_free_region]);
+            hp->add_saved_spinlock_info (false, me_release, mt_decommit_step);
+            leave_spin_lock (&hp->more_space_lock_soh);
+        }
+
+        if (try_enter_spin_lock (&hp->more_space_lock_uoh))
+        {
+            num_regions_moved += move_free_regions_to_decommit (&hp->free_regions[large_free_region]);
+            num_regions_moved += move_free_regions_to_decommit (&hp->free_regions[huge_free_region]);
+            leave_spin_lock (&hp->more_space_lock_uoh);
+        }
+    }
+
+    if (try_enter_spin_lock (&gc_lock))
+    {
+        num_regions_moved += move_free_regions_to_decommit (&global_free_huge_regions);
+        leave_spin_lock (&gc_lock);
+    }
+
+    dprintf (REGIONS_LOG, ("moved %Id free regions to decommit because of memory pressure", num_regions_moved));
+
+    return (num_regions_moved != 0);
+}
+#endif //MULTIPLE_HEAPS && USE_REGIONS
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -45887,6 +46859,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if ((pause_time_target != 0) && (settings.condemned_generation < max_generation))
+        {
+            update_pause_budget_factor (pause_duration);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
@@ -46082,6 +47059,7 @@ GCHeap::GarbageCollectGeneration (unsigned int gen, gc_reason reason)
         BEGIN_TIMING(suspend_ee_during_log);
         GCToEEInterface::SuspendEE(SUSPEND_FOR_GC);
         END_TIMING(suspend_ee_during_log);
+        gc_heap::check_memory_limit_change();
         gc_heap::proceed_with_gc_p = gc_heap::should_proceed_with_gc();
         gc_heap::disable_preemptive (cooperative_mode);
         if (gc_heap::proceed_with_gc_p)
@@ -46806,6 +47784,42 @@ Object* GCHeap::GetNextFinalizableObject()
 
 }
 
+Object* GCHeap::GetNextFinalizableForThread(int thread_index, int thread_count, bool only_non_critical)
+{
+    assert ((thread_index >= 0) && (thread_index < thread_count));
+
+#ifdef MULTIPLE_HEAPS
+    int start_hn = (int)(((int64_t)thread_index * gc_heap::n_heaps) / thread_count);
+
+    //return the first non critical one, starting with the queue of start_hn.
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [(start_hn + i) % gc_heap::n_heaps];
+        Object* O = hp->finalize_queue->GetNextFinalizableObject(TRUE);
+        if (O)
+            return O;
+    }
+
+    if (!only_non_critical)
+    {
+        //return the first non critical/critical one, starting with the queue of start_hn.
+        for (int i = 0; i < gc_heap::n_heaps; i++)
+        {
+            gc_heap* hp = gc_heap::g_heaps [(start_hn + i) % gc_heap::n_heaps];
+            Object* O = hp->finalize_queue->GetNextFinalizableObject(FALSE);
+            if (O)
+                return O;
+        }
+    }
+    return 0;
+
+#else //MULTIPLE_HEAPS
+    UNREFERENCED_PARAMETER(thread_index);
+    UNREFERENCED_PARAMETER(thread_count);
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObject(only_non_critical);
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetNumberFinalizableObjects()
 {
 #ifdef MULTIPLE_HEAPS
@@ -47496,6 +48510,26 @@ void GCHeap::DiagWalkHeap (walk_fn fn, void* context, int gen_number, bool walk_
     gc_heap::walk_heap (fn, context, gen_number, walk_large_object_heap_p);
 }
 
+bool GCHeap::DiagStreamBGCMarkedObjects (bgc_mark_walk_fn fn, void* context)
+{
+#ifdef BACKGROUND_GC
+    if (!gc_heap::gc_can_use_concurrent)
+    {
+        return false;
+    }
+
+    enter_spin_lock (&gc_heap::gc_lock);
+    gc_heap::bgc_mark_walk_requested_callback = fn;
+    gc_heap::bgc_mark_walk_requested_context = context;
+    leave_spin_lock (&gc_heap::gc_lock);
+    return true;
+#else
+    UNREFERENCED_PARAMETER(fn);
+    UNREFERENCED_PARAMETER(context);
+    return false;
+#endif //BACKGROUND_GC
+}
+
 void GCHeap::DiagWalkFinalizeQueue (void* gc_context, fq_walk_fn fn)
 {
     gc_heap* hp = (gc_heap*)gc_context;
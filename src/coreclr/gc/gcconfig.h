@@ -77,11 +77,18 @@ public:
     BOOL_CONFIG  (GCNumaAware,               "GCNumaAware",               NULL,                                true,               "Enables numa allocations in the GC")                                                     \
     BOOL_CONFIG  (GCCpuGroup,                "GCCpuGroup",                "System.GC.CpuGroup",                false,              "Enables CPU groups in the GC")                                                            \
     BOOL_CONFIG  (GCLargePages,              "GCLargePages",              "System.GC.LargePages",              false,              "Enables using Large Pages in the GC")                                                     \
+    BOOL_CONFIG  (GCParallelHandleScan,      "GCParallelHandleScan",      NULL,                                true,               "Specifies whether Server GC threads help scan each other's handle tables in ephemeral GCs") \
+    BOOL_CONFIG  (GCRegionWriteBarrier,      "GCRegionWriteBarrier",      NULL,                                true,               "Specifies whether the write barrier only marks cards for older to younger references when regions are used") \
+    BOOL_CONFIG  (GCHardwareWriteWatch,      "GCHardwareWriteWatch",      NULL,                                false,              "Specifies whether background GC uses the OS write watch instead of software write watch when the OS supports it") \
     INT_CONFIG   (HeapVerifyLevel,           "HeapVerify",                NULL,                                HEAPVERIFY_NONE,    "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
     INT_CONFIG   (LOHCompactionMode,         "GCLOHCompact",              NULL,                                0,                  "Specifies the LOH compaction mode")                                                      \
     INT_CONFIG   (LOHThreshold,              "GCLOHThreshold",            NULL,                                LARGE_OBJECT_SIZE,  "Specifies the size that will make objects go on LOH")                                     \
     INT_CONFIG   (BGCSpinCount,              "BGCSpinCount",              NULL,                                140,                "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                   "BGCSpin",                   NULL,                                2,                  "Specifies the bgc spin time")                                                            \
+    INT_CONFIG   (BGCMaxCPUPercent,          "GCBGCMaxCPUPercent",        NULL,                                0,                  "Specifies the percentage of a core each BGC thread may use during concurrent mark, "     \
+                                                                                                                                          "0 means no limit")                                                                       \
+    STRING_CONFIG(BGCAffinitizeRanges,       "GCBGCAffinitizeRanges",     NULL,                                                    "Specifies list of processors for BGC threads, in the same format as "                    \
+                                                                                                                                          "GCHeapAffinitizeRanges")                                                                 \
     INT_CONFIG   (HeapCount,                 "GCHeapCount",               "System.GC.HeapCount",               0,                  "Specifies the number of server GC heaps")                                                 \
     INT_CONFIG   (Gen0Size,                  "GCgen0size",                NULL,                                0,                  "Specifies the smallest gen0 budget")                                                     \
     INT_CONFIG   (SegmentSize,               "GCSegmentSize",             NULL,                                0,                  "Specifies the managed heap segment size")                                                \
@@ -132,8 +139,14 @@ public:
     INT_CONFIG   (GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", "System.GC.HeapHardLimitSOHPercent", 0,                  "Specifies the GC heap SOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", "System.GC.HeapHardLimitLOHPercent", 0,                  "Specifies the GC heap LOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitPOHPercent, "GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", 0,                  "Specifies the GC heap POH usage as a percentage of the total memory")                    \
-    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F")\
+    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F, on arm64 4 for NEON")\
     INT_CONFIG   (GCConserveMem,             "GCConserveMemory",          "System.GC.ConserveMemory",          0,                  "Specifies how hard GC should try to conserve memory - values 0-9")                       \
+    INT_CONFIG   (GCPauseTimeTarget,         "GCPauseTimeTarget",         "System.GC.PauseTimeTarget",         0,                  "Specifies the pause time in milliseconds ephemeral GCs should stay under - 0 for no target")\
+    INT_CONFIG   (GCMemoryLimitPollInterval, "GCMemoryLimitPollInterval", "System.GC.MemoryLimitPollInterval", 0,                  "Specifies how often in milliseconds to re-read the memory limit and memory pressure between GCs - 0 to disable")\
+    INT_CONFIG   (GCMemoryPressureDecommitTh, "GCMemoryPressureDecommitThreshold", NULL,                         10,                 "Specifies the memory pressure in percent above which free regions are decommitted between GCs")\
+    INT_CONFIG   (GCGen2SIPSurvRatio,        "GCGen2SIPSurvRatio",        NULL,                                0,                  "Specifies the survival % at which gen2 regions are swept instead of compacted in full compacting GCs - 0 (the default) to use the 90% of the other generations")\
+    INT_CONFIG   (GCSIPPinnedGCCount,        "GCSIPPinnedGCCount",        NULL,                                0,                  "Specifies the number of GCs in a row an ephemeral region needs to keep pins before it's swept and promoted to gen2 - 0 (the default) to disable")\
+    INT_CONFIG   (GCDynamicAdaptationMode,   "GCDynamicAdaptationMode",   "System.GC.DynamicAdaptationMode",   0,                  "Specifies whether Server GC should adapt the number of heaps in use - 0 for off, 1 for on")\
 
 // This class is responsible for retreiving configuration information
 // for how the GC should operate.
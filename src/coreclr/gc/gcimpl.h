@@ -313,6 +313,10 @@ protected:
     virtual void DiagGetGCSettings(EtwGCSettingsInfo* etw_settings);
 
     virtual unsigned int GetGenerationWithRange(Object* object, uint8_t** ppStart, uint8_t** ppAllocated, uint8_t** ppReserved);
+
+    virtual bool DiagStreamBGCMarkedObjects(bgc_mark_walk_fn fn, void* context);
+
+    virtual Object* GetNextFinalizableForThread(int thread_index, int thread_count, bool only_non_critical);
 public:
     Object * NextObj (Object * object);
 
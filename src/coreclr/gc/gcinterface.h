@@ -11,7 +11,7 @@
 // The minor version of the GC/EE interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interopate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+#define GC_INTERFACE_MINOR_VERSION 5
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -108,6 +108,16 @@ struct WriteBarrierParameters
     // The new write watch table, if we are using our own write watch
     // implementation. Used for WriteBarrierOp::SwitchToWriteWatch only.
     uint8_t* write_watch_table;
+
+    // The table mapping each basic region to the generation it belongs to, with
+    // one byte per region and skewed so it can be indexed by (address >> region_shr).
+    // nullptr if the GC is not using regions or does not maintain the table.
+    // Used for WriteBarrierOp::Initialize only.
+    uint8_t* region_to_generation_table;
+
+    // The log2 of the basic region size, used to index region_to_generation_table.
+    // Used for WriteBarrierOp::Initialize only.
+    uint8_t region_shr;
 };
 
 struct EtwGCSettingsInfo
@@ -157,6 +167,10 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    // Used by the GC to size the allocation quantum for this context based on how
+    // often it needs a new one - these fit in what would otherwise be padding.
+    int16_t        alloc_quantum_level;
+    uint16_t       alloc_refill_count;
 public:
 
     void init()
@@ -170,6 +184,8 @@ public:
         gc_reserved_1 = 0;
         gc_reserved_2 = 0;
         alloc_count = 0;
+        alloc_quantum_level = 0;
+        alloc_refill_count = 0;
     }
 };
 
@@ -472,6 +488,7 @@ typedef bool (* walk_fn2)(Object*, uint8_t**, void*);
 typedef void (* gen_walk_fn)(void* context, int generation, uint8_t* range_start, uint8_t* range_end, uint8_t* range_reserved);
 typedef void (* record_surv_fn)(uint8_t* begin, uint8_t* end, ptrdiff_t reloc, void* context, bool compacting_p, bool bgc_p);
 typedef void (* fq_walk_fn)(bool, void*);
+typedef void (* bgc_mark_walk_fn)(Object** objects, size_t count, void* context);
 typedef void (* fq_scan_fn)(Object** ppObject, ScanContext *pSC, uint32_t dwFlags);
 typedef void (* handle_scan_fn)(Object** pRef, Object* pSec, uint32_t flags, ScanContext* context, bool isDependent);
 typedef bool (* async_pin_enum_fn)(Object* object, void* context);
@@ -935,6 +952,18 @@ public:
     // Get the segment/region associated with an address together with its generation for the profiler.
     virtual unsigned int GetGenerationWithRange(Object* object, uint8_t** ppStart, uint8_t** ppAllocated, uint8_t** ppReserved) = 0;
 
+    // Asks the next background GC to hand the gen2 and UOH objects it marks to fn, in chunks, while
+    // the runtime keeps running. The objects stay valid until that BGC completes. fn may be called on
+    // several GC threads at once and must not trigger a GC. Once that BGC is done marking, fn is called
+    // one last time with no objects. Returns false if background GC is disabled.
+    virtual bool DiagStreamBGCMarkedObjects(bgc_mark_walk_fn fn, void* context) = 0;
+
+    // Gets the next finalizable object like GetNextFinalizable, for thread thread_index of thread_count
+    // threads that run finalizers. Each of them starts looking in a different part of the per heap
+    // finalization queues so they can drain them in parallel. If only_non_critical is true, objects
+    // with critical finalizers are left in the queues.
+    virtual Object* GetNextFinalizableForThread(int thread_index, int thread_count, bool only_non_critical) = 0;
+
     IGCHeap() {}
 
     // The virtual destructors for the IGCHeap class hierarchy is intentionally omitted.
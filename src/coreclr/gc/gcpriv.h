@@ -56,6 +56,12 @@ inline void FATAL_GC_ERROR()
 #define USE_REGIONS
 #endif //HOST_64BIT && BUILD_AS_STANDALONE
 
+#if defined (MULTIPLE_HEAPS) && defined (USE_REGIONS)
+// This lets Server GC vary the number of heaps allocations are distributed over
+// based on how expensive GCs are relative to the time spent between them.
+#define DYNAMIC_HEAP_COUNT
+#endif //MULTIPLE_HEAPS && USE_REGIONS
+
 #ifdef USE_REGIONS
 // Currently this -
 // + creates some pins on our own
@@ -251,6 +257,7 @@ const int policy_expand  = 2;
 // the result. I have some already logged with HEAP_BALANCE_TEMP_LOG.
 #define HEAP_BALANCE_LOG (MIN_CUSTOM_LOG_LEVEL + 10)
 #define HEAP_BALANCE_TEMP_LOG (MIN_CUSTOM_LOG_LEVEL + 11)
+#define DYNAMIC_HEAP_COUNT_LOG (MIN_CUSTOM_LOG_LEVEL + 12)
 
 #ifdef SIMPLE_DPRINTF
 
@@ -1366,6 +1373,8 @@ public:
     PER_HEAP_ISOLATED
     void set_region_gen_num (heap_segment* region, int gen_num);
     PER_HEAP_ISOLATED
+    void update_region_to_generation_map (uint8_t* start, uint8_t* end, int gen_num);
+    PER_HEAP_ISOLATED
     int get_region_plan_gen_num (uint8_t* obj);
     PER_HEAP_ISOLATED
     bool is_region_demoted (uint8_t* obj);
@@ -1428,6 +1437,18 @@ public:
     PER_HEAP
     bool should_sweep_in_plan (heap_segment* region);
 
+    // In full compacting GCs, gen2 regions with at least this % survival are swept in plan
+    // instead of compacted, so only the sparse gen2 regions get evacuated. This doesn't apply
+    // to induced blocking GCs, the last GC before OOM or with a hard limit.
+    PER_HEAP_ISOLATED
+    int sip_gen2_surv_ratio_th;
+
+    // Ephemeral regions that have kept pinned survivors for at least this many GCs in a row
+    // are swept in plan and promoted to gen2, instead of having every ephemeral GC compact
+    // around the same long lived pins and demote the region. 0 turns this off.
+    PER_HEAP_ISOLATED
+    int sip_pinned_gcs_count_th;
+
     PER_HEAP
     void sweep_region_in_plan (heap_segment* region,
                                BOOL use_mark_list,
@@ -1531,6 +1552,20 @@ public:
     PER_HEAP_ISOLATED
     void do_post_gc();
 
+    PER_HEAP_ISOLATED
+    void update_pause_budget_factor (uint64_t pause_duration);
+
+    PER_HEAP_ISOLATED
+    bool check_memory_limit_change();
+
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS)
+    PER_HEAP_ISOLATED
+    size_t move_free_regions_to_decommit (region_free_list* free_list);
+
+    PER_HEAP_ISOLATED
+    bool decommit_free_regions_on_memory_pressure();
+#endif //MULTIPLE_HEAPS && USE_REGIONS
+
     PER_HEAP_ISOLATED
     void update_recorded_gen_data (last_recorded_gc_info* gc_info);
 
@@ -1777,7 +1812,11 @@ protected:
 
     PER_HEAP
     size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+                            int align_const, alloc_context* acontext);
+    PER_HEAP
+    size_t get_alloc_context_quantum (alloc_context* acontext);
+    PER_HEAP_ISOLATED
+    void update_alloc_context_quantum_level (alloc_context* acontext);
     PER_HEAP
     allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
@@ -2050,6 +2089,14 @@ protected:
 #endif //!USE_REGIONS
     PER_HEAP_ISOLATED
     void distribute_free_regions();
+#ifdef USE_REGIONS
+    PER_HEAP_ISOLATED
+    int get_numa_node_index_of_heap (int hn);
+    PER_HEAP_ISOLATED
+    int get_region_numa_node_index (heap_segment* region);
+    PER_HEAP_ISOLATED
+    void remove_surplus_regions (region_free_list* free_list, region_free_list* node_surplus_lists, size_t target_count);
+#endif //USE_REGIONS
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED
     void reset_write_watch_for_gc_heap(void* base_address, size_t region_size);
@@ -2391,6 +2438,16 @@ protected:
 #ifdef MH_SC_MARK
     PER_HEAP
     void mark_steal ();
+
+    // Decides whether GC threads that are done with their own marking should steal
+    // work from other heaps' mark stacks in this GC.
+    PER_HEAP_ISOLATED
+    BOOL decide_on_mark_steal (int condemned_gen_number);
+
+    // The heap that had the most survivors in the condemned generations last time,
+    // this is where idle GC threads go looking for work first.
+    PER_HEAP_ISOLATED
+    int mark_steal_busiest_heap;
 #endif //MH_SC_MARK
 
 #ifdef BACKGROUND_GC
@@ -2399,6 +2456,10 @@ protected:
     PER_HEAP
     BOOL background_mark1 (uint8_t* o);
     PER_HEAP
+    void record_bgc_marked_object (uint8_t* o);
+    PER_HEAP
+    void flush_bgc_marked_objects();
+    PER_HEAP
     BOOL background_mark (uint8_t* o, uint8_t* low, uint8_t* high);
     PER_HEAP
     uint8_t* background_mark_object (uint8_t* o THREAD_NUMBER_DCL);
@@ -3401,6 +3462,19 @@ protected:
     PER_HEAP
     void allow_fgc();
 
+    // Pauses the BGC thread during concurrent mark so it stays within
+    // GCBGCMaxCPUPercent of one core. Only called from allow_fgc.
+    PER_HEAP
+    void bgc_duty_cycle();
+
+    // Returns true when allocation is outpacing the concurrent mark so
+    // throttling it would only make the BGC fall further behind.
+    PER_HEAP
+    bool bgc_mark_outpaced_p();
+
+    PER_HEAP
+    void set_bgc_thread_affinity();
+
     // Restores BGC settings if necessary.
     PER_HEAP_ISOLATED
     void recover_bgc_settings();
@@ -4188,6 +4262,25 @@ protected:
     PER_HEAP
     CLRCriticalSection bgc_threads_timeout_cs;
 
+    // The share of a core (1-99) that a BGC thread may use during concurrent
+    // mark. 0 means concurrent mark is not throttled.
+    PER_HEAP_ISOLATED
+    uint32_t bgc_max_cpu_percent;
+
+    // Processors the BGC threads are affinitized to, from GCBGCAffinitizeRanges.
+    PER_HEAP_ISOLATED
+    AffinitySet bgc_affinity_set;
+
+    PER_HEAP_ISOLATED
+    size_t bgc_affinity_set_count;
+
+    // Start of the current slice of concurrent mark work, in us.
+    PER_HEAP
+    uint64_t bgc_duty_cycle_start;
+
+    PER_HEAP
+    uint32_t bgc_duty_cycle_check_count;
+
     PER_HEAP_ISOLATED
     GCEvent background_gc_done_event;
 
@@ -4369,6 +4462,29 @@ protected:
 
     PER_HEAP
     size_t          c_mark_list_index;
+
+#define bgc_marked_objects_chunk (256)
+    // Objects this heap marked in the current BGC that haven't been handed to
+    // bgc_mark_walk_callback yet.
+    PER_HEAP
+    uint8_t*        bgc_marked_objects[bgc_marked_objects_chunk];
+
+    PER_HEAP
+    size_t          bgc_marked_objects_count;
+
+    // Set by DiagStreamBGCMarkedObjects and taken by the next BGC, both under gc_lock.
+    PER_HEAP_ISOLATED
+    bgc_mark_walk_fn bgc_mark_walk_requested_callback;
+
+    PER_HEAP_ISOLATED
+    void*           bgc_mark_walk_requested_context;
+
+    // Non null while the current BGC is marking and reports what it marks.
+    PER_HEAP_ISOLATED
+    bgc_mark_walk_fn bgc_mark_walk_callback;
+
+    PER_HEAP_ISOLATED
+    void*           bgc_mark_walk_context;
 #endif //BACKGROUND_GC
 
     PER_HEAP
@@ -4525,8 +4641,8 @@ protected:
 
 #endif //SYNCHRONIZATION_STATS
 
-#define NUM_LOH_ALIST (7)
-    // bucket 0 contains sizes less than 64*1024
+#define NUM_LOH_ALIST (10)
+    // bucket 0 contains sizes less than 64*1024, the last bucket contains sizes of 16MB and above
     // the "BITS" number here is the highest bit in 64*1024 - 1, zero-based as in BitScanReverse.
     // see first_suitable_bucket(size_t size) for details.
 #define BASE_LOH_ALIST_BITS (15)
@@ -4734,6 +4850,79 @@ protected:
     PER_HEAP_ISOLATED
     int conserve_mem_setting;
 
+    // If a pause time target is set, we shrink the gen0/gen1 budgets when ephemeral GCs
+    // exceed it and let them grow back when ephemeral GCs are comfortably below it.
+    // All times are in microseconds.
+    PER_HEAP_ISOLATED
+    uint64_t pause_time_target;
+
+    // decaying maximum of recent ephemeral pauses - this way a single long pause counts
+    // for a while, so we approximate a high percentile instead of the average.
+    PER_HEAP_ISOLATED
+    uint64_t recent_ephemeral_pause;
+
+    // what the gen0 and gen1 budgets are multiplied with, in [min_pause_budget_factor, 1.0]
+    PER_HEAP_ISOLATED
+    float pause_budget_factor;
+
+    // If set, we re-read the restricted physical memory limit and the memory pressure this often
+    // (in microseconds) - at the start of a GC and, with Server GC, on heap 0's GC thread between GCs.
+    PER_HEAP_ISOLATED
+    uint64_t memory_limit_poll_interval;
+
+    PER_HEAP_ISOLATED
+    uint64_t last_memory_limit_poll_time;
+
+    // memory pressure (percentage of time stalled on memory) above which we decommit free regions between GCs
+    PER_HEAP_ISOLATED
+    uint32_t memory_pressure_decommit_th;
+
+    // only a limit we got from the OS can change while we are running, not one specified via config
+    PER_HEAP_ISOLATED
+    bool physical_mem_from_os_p;
+
+#ifdef DYNAMIC_HEAP_COUNT
+    enum gc_dynamic_adaptation_mode
+    {
+        dynamic_adaptation_default = 0,
+        dynamic_adaptation_to_application_sizes = 1,
+    };
+
+    PER_HEAP_ISOLATED
+    int dynamic_adaptation_mode;
+
+    struct dynamic_heap_count_data_t
+    {
+        // # of GCs we look at before deciding to change the heap count
+        static const int sample_size = 3;
+
+        // GC cost percentage we aim for - if the GCs take more than this much of the elapsed time
+        // we grow the heap count.
+        static const int target_tcp = 5;
+
+        struct sample
+        {
+            uint64_t    elapsed_between_gcs;    // time between the end of the previous GC and the start of this one (us)
+            uint64_t    gc_elapsed_time;        // time this GC took (us)
+            size_t      allocated;              // SOH bytes allocated between the previous GC and this one
+        };
+
+        sample      samples[sample_size];
+        size_t      sample_index;
+        // # of samples recorded since the last heap count change
+        size_t      samples_since_change;
+
+        uint64_t    last_gc_end_ts;
+        uint64_t    last_total_alloc_bytes_soh;
+    };
+
+    PER_HEAP_ISOLATED
+    dynamic_heap_count_data_t dynamic_heap_count_data;
+
+    PER_HEAP_ISOLATED
+    void update_dynamic_heap_count();
+#endif //DYNAMIC_HEAP_COUNT
+
     PER_HEAP
     BOOL gen0_bricks_cleared;
     PER_HEAP
@@ -4959,6 +5148,12 @@ public:
     static
     int n_heaps;
 
+    // The number of heaps allocation contexts are currently balanced over - these are
+    // always heaps [0, n_active_heaps). This is n_heaps unless DYNAMIC_HEAP_COUNT
+    // decides to use fewer.
+    static
+    int n_active_heaps;
+
     static
     gc_heap** g_heaps;
 
@@ -5052,6 +5247,13 @@ protected:
 
     PER_HEAP_ISOLATED
     size_t bookkeeping_sizes[total_bookkeeping_elements];
+
+    // One byte per basic region holding the gen num of the region it belongs to, which
+    // the write barrier reads to only mark cards for older to younger references. This
+    // is skewed so it's indexed by (address >> min_segment_size_shr); nullptr if we are
+    // not maintaining it.
+    PER_HEAP_ISOLATED
+    uint8_t* map_region_to_generation_skewed;
 #endif //USE_REGIONS
 }; // class gc_heap
 
@@ -5626,6 +5828,8 @@ public:
     int             survived;
     int             old_card_survived;
     int             pinned_survived;
+    // The number of GCs in a row in which this region's plan kept pinned plugs.
+    int             pinned_survived_gcs;
     // at the end of each GC, we increase each region in the region free list
     // by 1. So we can observe if a region stays in the free list over many
     // GCs. We stop at 99. It's initialized to 0 when a region is added to
@@ -6075,6 +6279,11 @@ int& heap_segment_pinned_survived (heap_segment* inst)
     return inst->pinned_survived;
 }
 inline
+int& heap_segment_pinned_survived_gcs (heap_segment* inst)
+{
+    return inst->pinned_survived_gcs;
+}
+inline
 uint8_t* heap_segment_free_list_head (heap_segment* inst)
 {
     return inst->free_list_head;
@@ -20,10 +20,14 @@
 
 #define SERVER_GC 1
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #include "vxsort/do_vxsort.h"
 #endif
 
+#ifdef TARGET_ARM64
+#include <arm_neon.h>
+#endif
+
 namespace SVR {
 #include "gcimpl.h"
 #include "gc.cpp"
@@ -20,10 +20,14 @@
 #undef SERVER_GC
 #endif
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #include "vxsort/do_vxsort.h"
 #endif
 
+#ifdef TARGET_ARM64
+#include <arm_neon.h>
+#endif
+
 namespace WKS {
 #include "gcimpl.h"
 #include "gc.cpp"
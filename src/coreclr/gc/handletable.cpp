@@ -600,6 +600,9 @@ void HndWriteBarrierWorker(OBJECTHANDLE handle, _UNCHECKED_OBJECTREF value)
             // we just set the clump age to 0, which means that whoever wins the race
             // results are the same, as GC will always look at the clump
             *pClumpAge = (uint8_t)0;
+
+            // the segment's lower bound has to follow, or ephemeral GCs may skip the segment
+            ((volatile _TableSegmentHeader *)barrier)->bMinGeneration = (uint8_t)0;
         }
     }
 }
@@ -646,6 +649,8 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
     info.uFlags          = (fAsync? HNDGCF_ASYNC : HNDGCF_NORMAL);
     info.fEnumUserData   = fEnumUserData;
     info.dwAgeMask       = 0;
+    info.uScanIndex      = 0;
+    info.uScanKey        = 0;
     info.pCurrentSegment = NULL;
     info.pfnScan         = pfnEnum;
     info.param1          = lParam1;
@@ -666,21 +671,21 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
 }
 
 /*
- * HndScanHandlesForGC
+ * ScanHandlesForGCWorker
  *
- * Multiple type scanning entrypoint for GC.
- *
- * This entrypoint is provided for GC-time scans of the handle table ONLY.  It
- * enables ephemeral scanning of the table, and optionally ages the write barrier
- * as it scans.
+ * Implements HndScanHandlesForGC and HndScanHandlesForGCParallel.
  *
  */
-GC_DAC_VISIBLE_NO_MANGLE
-void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
-                         const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags)
+static void ScanHandlesForGCWorker(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                   const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags,
+                                   uint32_t uScanIndex, uint32_t uScanKey)
 {
     WRAPPER_NO_CONTRACT;
 
+    // parallel scans are only done for synchronous ephemeral GCs
+    _ASSERTE(!uScanKey || ((condemned < maxgen) && !(flags & HNDGCF_ASYNC)));
+    _ASSERTE(uScanIndex < HNDSCAN_PARALLEL_COUNT);
+
     // fetch the table pointer
     PTR_HandleTable pTable = Table(hTable);
 
@@ -723,9 +728,10 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
     else
     {
         // this is an ephemeral GC - is it g0?
-        if (condemned == 0)
+        if ((condemned == 0) || uScanKey)
         {
-            // yes - do bare-bones enumeration
+            // yes (or other GC threads may be scanning this table too, so we
+            // can't re-sort the chains) - do bare-bones enumeration
             pfnSegment = QuickSegmentIterator;
         }
         else
@@ -755,6 +761,8 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
     info.uFlags          = flags;
     info.fEnumUserData   = enumUserData;
     info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.uScanIndex      = uScanIndex;
+    info.uScanKey        = uScanKey;
     info.pCurrentSegment = NULL;
     info.pfnScan         = scanProc;
     info.param1          = param1;
@@ -788,8 +796,47 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
     }
 }
 
+/*
+ * HndScanHandlesForGC
+ *
+ * Multiple type scanning entrypoint for GC.
+ *
+ * This entrypoint is provided for GC-time scans of the handle table ONLY.  It
+ * enables ephemeral scanning of the table, and optionally ages the write barrier
+ * as it scans.
+ *
+ */
+GC_DAC_VISIBLE_NO_MANGLE
+void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                         const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags)
+{
+    WRAPPER_NO_CONTRACT;
+
+    ScanHandlesForGCWorker(hTable, scanProc, param1, param2, types, typeCount, condemned, maxgen, flags, 0, 0);
+}
+
 #ifndef DACCESS_COMPILE
 
+/*
+ * HndScanHandlesForGCParallel
+ *
+ * Like HndScanHandlesForGC, for synchronous ephemeral GCs where several GC threads may
+ * scan the same table.  Each segment is claimed with uScanKey (which must be unique for
+ * the GC) in the uScanIndex slot before it is scanned, so it is scanned by exactly one
+ * of the threads.
+ *
+ */
+void HndScanHandlesForGCParallel(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                 const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags,
+                                 uint32_t uScanIndex, uint32_t uScanKey)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(uScanKey != 0);
+
+    ScanHandlesForGCWorker(hTable, scanProc, param1, param2, types, typeCount, condemned, maxgen, flags, uScanIndex, uScanKey);
+}
+
 
 /*
  * HndResetAgeMap
@@ -817,6 +864,8 @@ void HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCou
     info.uFlags          = flags;
     info.fEnumUserData   = FALSE;
     info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.uScanIndex      = 0;
+    info.uScanKey        = 0;
     info.pCurrentSegment = NULL;
     info.pfnScan         = NULL;
     info.param1          = 0;
@@ -857,6 +906,8 @@ void HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCou
     info.uFlags          = flags;
     info.fEnumUserData   = FALSE;
     info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.uScanIndex      = 0;
+    info.uScanKey        = 0;
     info.pCurrentSegment = NULL;
     info.pfnScan         = NULL;
     info.param1          = 0;
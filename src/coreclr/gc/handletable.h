@@ -112,6 +112,20 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
 #define HNDGCF_ASYNC        (0x00000002)    // drop the table lock while scanning
 #define HNDGCF_EXTRAINFO    (0x00000004)    // iterate per-handle data while scanning
 
+/*
+ * kinds of parallel GC-time scans - each scan that may run while another one is still
+ * in progress on other GC threads needs a kind of its own
+ */
+#define HNDSCAN_PARALLEL_PINNED         (0)
+#define HNDSCAN_PARALLEL_ASYNCPINNED    (1)
+#define HNDSCAN_PARALLEL_STRONG         (2)
+#define HNDSCAN_PARALLEL_REFCOUNTED     (3)
+#define HNDSCAN_PARALLEL_WEAK_SHORT     (4)
+#define HNDSCAN_PARALLEL_WEAK_LONG      (5)
+#define HNDSCAN_PARALLEL_UPDATE         (6)
+#define HNDSCAN_PARALLEL_UPDATE_PINNED  (7)
+#define HNDSCAN_PARALLEL_COUNT          (8)
+
 GC_DAC_VISIBLE_NO_MANGLE
 void            HndScanHandlesForGC(HHANDLETABLE hTable,
                                     HANDLESCANPROC scanProc,
@@ -123,6 +137,18 @@ void            HndScanHandlesForGC(HHANDLETABLE hTable,
                                     uint32_t maxgen,
                                     uint32_t flags);
 
+void            HndScanHandlesForGCParallel(HHANDLETABLE hTable,
+                                            HANDLESCANPROC scanProc,
+                                            uintptr_t param1,
+                                            uintptr_t param2,
+                                            const uint32_t *types,
+                                            uint32_t typeCount,
+                                            uint32_t condemned,
+                                            uint32_t maxgen,
+                                            uint32_t flags,
+                                            uint32_t uScanIndex,
+                                            uint32_t uScanKey);
+
 void            HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 void            HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 
@@ -526,6 +526,8 @@ BOOL SegmentInitialize(TableSegment *pSegment, HandleTable *pTable)
     memset(pSegment->rgFreeMask,   0xFF,            sizeof(pSegment->rgFreeMask));
     memset(pSegment->rgBlockType,  TYPE_INVALID,    sizeof(pSegment->rgBlockType));
     memset(pSegment->rgUserData,   BLOCK_INVALID,   sizeof(pSegment->rgUserData));
+    pSegment->bMinGeneration = 0xFF;
+    memset(pSegment->rgScanClaim,  0,               sizeof(pSegment->rgScanClaim));
 
     // prelink the free chain
     _ASSERTE(FitsInU1(HANDLE_BLOCKS_PER_SEGMENT));
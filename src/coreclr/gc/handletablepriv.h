@@ -163,6 +163,17 @@ struct _TableSegmentHeader
      */
     uint32_t rgFreeMask[HANDLE_MASKS_PER_SEGMENT];
 
+    /*
+     * Scan Claims
+     *
+     * Each slot holds the key of the last parallel GC scan of that kind that claimed this
+     * segment.  GC threads that help each other with ephemeral scans use them to make sure
+     * a segment is only scanned once per scan.
+     *
+     * N.B. these are updated with interlocked operations so they must stay 4-byte aligned.
+     */
+    uint32_t rgScanClaim[HNDSCAN_PARALLEL_COUNT];
+
     /*
      * Block Handle Types
      *
@@ -265,8 +276,19 @@ struct _TableSegmentHeader
      * Indicates the segment sequence number.
      */
     uint8_t bSequence;
+
+    /*
+     * Minimum Generation
+     *
+     * Lower bound for the bytes in rgGeneration.  It is lowered whenever a clump's age is
+     * lowered and recomputed when the handles are aged, which lets ephemeral scans skip
+     * segments that don't have any handles pointing into the condemned generations.
+     */
+    uint8_t bMinGeneration;
 };
 
+C_ASSERT (offsetof(_TableSegmentHeader, rgScanClaim) % sizeof(uint32_t) == 0);
+
 typedef DPTR(struct _TableSegmentHeader) PTR__TableSegmentHeader;
 typedef DPTR(uintptr_t) PTR_uintptr_t;
 
@@ -362,6 +384,8 @@ struct ScanCallbackInfo
     uintptr_t        param1;            // callback param 1
     uintptr_t        param2;            // callback param 2
     uint32_t         dwAgeMask;         // generation mask for ephemeral GCs
+    uint32_t         uScanIndex;        // HNDSCAN_PARALLEL_* kind of a parallel scan
+    uint32_t         uScanKey;          // key used to claim segments in parallel scans, 0 if not parallel
 
 #ifdef _DEBUG
     uint32_t DEBUG_BlocksScanned;
@@ -768,6 +792,24 @@ void SegmentRemoveFreeBlocks(TableSegment *pSegment, uint32_t uType);
 void SegmentResortChains(TableSegment *pSegment);
 
 
+/*
+ * SegmentTryClaimForScan
+ *
+ * Claims a segment for one of the GC threads taking part in a parallel scan.
+ *
+ */
+BOOL SegmentTryClaimForScan(TableSegment *pSegment, uint32_t uIndex, uint32_t uKey);
+
+
+/*
+ * SegmentUpdateMinGeneration
+ *
+ * Recomputes the lower bound of the clump ages in a segment after aging.
+ *
+ */
+void SegmentUpdateMinGeneration(TableSegment *pSegment);
+
+
 /*
  * DoesSegmentNeedsToTrimExcessPages
  *
@@ -829,6 +829,10 @@ void BlockResetAgeMapForBlocksWorker(uint32_t *pdwGen, uint32_t dwClumpMask, Sca
             }
             _ASSERTE(FitsInU1(minAge));
             ((uint8_t *)pSegment->rgGeneration)[uClump] = static_cast<uint8_t>(minAge);
+
+            // keep the segment's lower bound below the clump's new age
+            if (pSegment->bMinGeneration > static_cast<uint8_t>(minAge))
+                pSegment->bMinGeneration = static_cast<uint8_t>(minAge);
         }
         // skip to the next clump
         dwClumpMask = NEXT_CLUMP_IN_MASK(dwClumpMask);
@@ -1334,6 +1338,66 @@ void xxxTableScanQueuedBlocksAsync(PTR_HandleTable pTable, PTR_TableSegment pSeg
 
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * SegmentTryClaimForScan
+ *
+ * Claims a segment for the parallel scan identified by uIndex and uKey.
+ *
+ * Returns TRUE if the calling thread should scan the segment, or FALSE if
+ * another thread has already claimed it for this scan.
+ *
+ */
+BOOL SegmentTryClaimForScan(TableSegment *pSegment, uint32_t uIndex, uint32_t uKey)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(uIndex < HNDSCAN_PARALLEL_COUNT);
+    _ASSERTE(uKey != 0);
+
+    uint32_t *pClaim = &pSegment->rgScanClaim[uIndex];
+
+    // quick check before we try to claim it the expensive way
+    uint32_t uOld = VolatileLoad(pClaim);
+    if (uOld == uKey)
+        return FALSE;
+
+    // the thread that swaps its key in gets to scan the segment
+    return (Interlocked::CompareExchange(pClaim, uKey, uOld) == uOld);
+}
+
+
+/*
+ * SegmentUpdateMinGeneration
+ *
+ * Recomputes the lower bound of the clump ages in a segment.
+ *
+ * N.B. the EE must be suspended, since the write barrier lowers the bound too.
+ *
+ */
+void SegmentUpdateMinGeneration(TableSegment *pSegment)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // only the blocks up to the empty line can hold handles
+    uint8_t *pbGen     = pSegment->rgGeneration;
+    uint8_t *pbGenLast = pbGen + (pSegment->bEmptyLine * sizeof(uint32_t));
+
+    uint8_t bMin = 0xFF;
+    for (; pbGen < pbGenLast; pbGen++)
+    {
+        if (*pbGen < bMin)
+            bMin = *pbGen;
+    }
+
+    pSegment->bMinGeneration = bMin;
+}
+#endif // !DACCESS_COMPILE
+
+/*--------------------------------------------------------------------------*/
+
+
+
 /****************************************************************************
  *
  * SEGMENT ITERATORS
@@ -1457,6 +1521,11 @@ PTR_TableSegment CALLBACK FullSegmentIterator(PTR_HandleTable pTable, PTR_TableS
             // update this segment's sequence number
             pNextSegment->bSequence = (uint8_t)(uSequence % 0x100);
 
+#ifndef DACCESS_COMPILE
+            // no parallel scan is running now, so forget the old claims before their keys wrap around
+            memset(pNextSegment->rgScanClaim, 0, sizeof(pNextSegment->rgScanClaim));
+#endif
+
             // break out and return the segment
             break;
         }
@@ -1693,6 +1762,12 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
     if (uTypeCount > 1)
         BuildInclusionMap(rgTypeInclusion, puType, uTypeCount);
 
+    // ephemeral scans only look at clumps young enough for the condemned generation
+    BOOL fEphemeral = (pfnBlockHandler == BlockScanBlocksEphemeral);
+#ifndef DACCESS_COMPILE
+    fEphemeral = fEphemeral || (pfnBlockHandler == BlockAgeBlocksEphemeral);
+#endif
+
     // now, iterate over the segments, scanning blocks of the specified type(s)
     PTR_TableSegment pSegment = NULL;
     while ((pSegment = pfnSegmentIterator(pTable, pSegment, pCrstHolder)) != NULL)
@@ -1701,6 +1776,20 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
         // (we do this test inside the loop since the iterators should still run...)
         if (uTypeCount >= 1)
         {
+            // an ephemeral scan can skip the segment if none of its clumps is young enough
+            if (fEphemeral)
+            {
+                uint32_t dwMinGen = (uint32_t)pSegment->bMinGeneration * 0x01010101;
+                if (!COMPUTE_CLUMP_MASK(dwMinGen, pInfo->dwAgeMask))
+                    continue;
+            }
+
+#ifndef DACCESS_COMPILE
+            // if other GC threads are scanning this table too then make sure we're the only one
+            if (pInfo->uScanKey && !SegmentTryClaimForScan(pSegment, pInfo->uScanIndex, pInfo->uScanKey))
+                continue;
+#endif
+
             // make sure the "current segment" pointer in the scan info is up to date
             pInfo->pCurrentSegment = pSegment;
 
@@ -1718,6 +1807,12 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
 
             // make sure the "current segment" pointer in the scan info is up to date
             pInfo->pCurrentSegment = NULL;
+
+#ifndef DACCESS_COMPILE
+            // aging may have moved the segment's youngest clump up
+            if (pInfo->uFlags & HNDGCF_AGE)
+                SegmentUpdateMinGeneration(pSegment);
+#endif
         }
     }
 }
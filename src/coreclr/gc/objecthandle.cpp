@@ -19,6 +19,7 @@
 #include "handletablepriv.h"
 
 #include "gchandletableimpl.h"
+#include "gcconfig.h"
 
 HandleTableMap g_HandleTableMap;
 
@@ -26,6 +27,9 @@ HandleTableMap g_HandleTableMap;
 // heaps and they're allocated by Ref_Initialize and initialized during each GC by GcDhInitialScan.
 DhContext *g_pDependentHandleContexts;
 
+// whether GC threads help scan each other's handle tables in ephemeral Server GCs
+static bool g_fParallelHandleScan = false;
+
 #ifndef DACCESS_COMPILE
 
 //----------------------------------------------------------------------------
@@ -642,6 +646,8 @@ bool Ref_Initialize()
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
+    g_fParallelHandleScan = GCConfig::GetGCParallelHandleScan();
+
     return true;
 
 CleanupAndFail:
@@ -825,6 +831,59 @@ int getSlotNumber(ScanContext* sc)
     return (IsServerHeap() ? sc->thread_number : 0);
 }
 
+/*
+ * ScanHandleTablesForGC
+ *
+ * Scans the calling GC thread's handle tables in all the buckets.
+ *
+ * In synchronous ephemeral Server GCs the thread then goes on to the tables of the other
+ * slots, so a thread whose tables hold few handles helps out the ones with many.  In that
+ * case every table is scanned by claiming its segments for uScanIndex, so two threads
+ * never scan the same segment.
+ *
+ */
+static void ScanHandleTablesForGC(HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                  const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen,
+                                  uint32_t flags, ScanContext *sc, uint32_t uScanIndex)
+{
+    WRAPPER_NO_CONTRACT;
+
+    int uCPUindex = getSlotNumber(sc);
+    int max_slots = getNumberOfSlots();
+    int n_slots = 1;
+    uint32_t uScanKey = 0;
+
+    if (g_fParallelHandleScan && IsServerHeap() && (condemned < maxgen) && !(flags & HNDGCF_ASYNC))
+    {
+        n_slots = max_slots;
+
+        // unique for this GC and never 0
+        uScanKey = (g_theGCHeap->GetGcCount() << 1) | 1;
+    }
+
+    for (int n = 0; n < n_slots; n++)
+    {
+        int uSlot = (uCPUindex + n) % max_slots;
+
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk) {
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+                if (walk->pBuckets[i] != NULL)
+                {
+                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uSlot];
+                    if (hTable)
+                    {
+                        if (uScanKey)
+                            HndScanHandlesForGCParallel(hTable, scanProc, param1, param2, types, typeCount, condemned, maxgen, flags, uScanIndex, uScanKey);
+                        else
+                            HndScanHandlesForGC(hTable, scanProc, param1, param2, types, typeCount, condemned, maxgen, flags);
+                    }
+                }
+            walk = walk->pNext;
+        }
+    }
+}
+
 // <TODO> - reexpress as complete only like hndtable does now!!! -fmh</REVISIT_TODO>
 void Ref_EndSynchronousGC(uint32_t condemned, uint32_t maxgen)
 {
@@ -1013,23 +1072,11 @@ void Ref_TracePinningRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
     uint32_t types[2] = {HNDTYPE_PINNED, HNDTYPE_ASYNCPINNED};
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber((ScanContext*) sc)];
-                if (hTable)
-                {
-                    // Pinned handles and async pinned handles are scanned in separate passes, since async pinned
-                    // handles may require a callback into the EE in order to fully trace an async pinned
-                    // object's object graph.
-                    HndScanHandlesForGC(hTable, PinObject, uintptr_t(sc), uintptr_t(fn), &types[0], 1, condemned, maxgen, flags);
-                    HndScanHandlesForGC(hTable, AsyncPinObject, uintptr_t(sc), uintptr_t(fn), &types[1], 1, condemned, maxgen, flags);
-                }
-            }
-        walk = walk->pNext;
-    }
+    // Pinned handles and async pinned handles are scanned in separate passes, since async pinned
+    // handles may require a callback into the EE in order to fully trace an async pinned
+    // object's object graph.
+    ScanHandleTablesForGC(PinObject, uintptr_t(sc), uintptr_t(fn), &types[0], 1, condemned, maxgen, flags, sc, HNDSCAN_PARALLEL_PINNED);
+    ScanHandleTablesForGC(AsyncPinObject, uintptr_t(sc), uintptr_t(fn), &types[1], 1, condemned, maxgen, flags, sc, HNDSCAN_PARALLEL_ASYNCPINNED);
 
     // pin objects pointed to by variable handles whose dynamic type is VHT_PINNED
     TraceVariableHandles(PinObject, uintptr_t(sc), uintptr_t(fn), VHT_PINNED, condemned, maxgen, flags);
@@ -1048,19 +1095,7 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
     uint32_t uTypeCount = (((condemned >= maxgen) && !g_theGCHeap->IsConcurrentGCInProgress()) ? 1 : ARRAY_SIZE(types));
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
-                if (hTable)
-                {
-                    HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
-                }
-            }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesForGC(PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags, sc, HNDSCAN_PARALLEL_STRONG);
 
     // promote objects pointed to by variable handles whose dynamic type is VHT_STRONG
     TraceVariableHandles(PromoteObject, uintptr_t(sc), uintptr_t(fn), VHT_STRONG, condemned, maxgen, flags);
@@ -1073,17 +1108,7 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
         // promote ref-counted handles
         uint32_t type = HNDTYPE_REFCOUNTED;
 
-        walk = &g_HandleTableMap;
-        while (walk) {
-            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-                if (walk->pBuckets[i] != NULL)
-                {
-                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, PromoteRefCounted, uintptr_t(sc), uintptr_t(fn), &type, 1, condemned, maxgen, flags );
-                }
-            walk = walk->pNext;
-        }
+        ScanHandleTablesForGC(PromoteRefCounted, uintptr_t(sc), uintptr_t(fn), &type, 1, condemned, maxgen, flags, sc, HNDSCAN_PARALLEL_REFCOUNTED);
     }
 #endif // FEATURE_COMINTEROP || FEATURE_COMWRAPPERS || FEATURE_OBJCMARSHAL || FEATURE_NATIVEAOT
 }
@@ -1139,21 +1164,8 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
 
     // check objects pointed to by short weak handles
     uint32_t flags = (((ScanContext*) lp1)->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
-    int uCPUindex = getSlotNumber((ScanContext*) lp1);
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-        {
-            if (walk->pBuckets[i] != NULL)
-           {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uCPUindex];
-                if (hTable)
-                    HndScanHandlesForGC(hTable, CheckPromoted, lp1, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
-        }
-        }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesForGC(CheckPromoted, lp1, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags, (ScanContext*) lp1, HNDSCAN_PARALLEL_WEAK_LONG);
 
     // check objects pointed to by variable handles whose dynamic type is VHT_WEAK_LONG
     TraceVariableHandles(CheckPromoted, lp1, 0, VHT_WEAK_LONG, condemned, maxgen, flags);
@@ -1385,21 +1397,8 @@ void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
     };
     uint32_t flags = (((ScanContext*) lp1)->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    int uCPUindex = getSlotNumber((ScanContext*) lp1);
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk)
-    {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-        {
-            if (walk->pBuckets[i] != NULL)
-            {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uCPUindex];
-                if (hTable)
-                    HndScanHandlesForGC(hTable, CheckPromoted, lp1, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
-            }
-        }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesForGC(CheckPromoted, lp1, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags, (ScanContext*) lp1, HNDSCAN_PARALLEL_WEAK_SHORT);
+
     // check objects pointed to by variable handles whose dynamic type is VHT_WEAK_SHORT
     TraceVariableHandles(CheckPromoted, lp1, 0, VHT_WEAK_SHORT, condemned, maxgen, flags);
 }
@@ -1447,17 +1446,7 @@ void Ref_UpdatePointers(uint32_t condemned, uint32_t maxgen, ScanContext* sc, Re
     // perform a multi-type scan that updates pointers
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
-                if (hTable)
-                    HndScanHandlesForGC(hTable, UpdatePointer, uintptr_t(sc), uintptr_t(fn), types, ARRAY_SIZE(types), condemned, maxgen, flags);
-            }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesForGC(UpdatePointer, uintptr_t(sc), uintptr_t(fn), types, ARRAY_SIZE(types), condemned, maxgen, flags, sc, HNDSCAN_PARALLEL_UPDATE);
 
     // update pointers in variable handles whose dynamic type is VHT_WEAK_SHORT, VHT_WEAK_LONG or VHT_STRONG
     TraceVariableHandles(UpdatePointer, uintptr_t(sc), uintptr_t(fn), VHT_WEAK_SHORT | VHT_WEAK_LONG | VHT_STRONG, condemned, maxgen, flags);
@@ -1594,17 +1583,7 @@ void Ref_UpdatePinnedPointers(uint32_t condemned, uint32_t maxgen, ScanContext*
     uint32_t types[2] = {HNDTYPE_PINNED, HNDTYPE_ASYNCPINNED};
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-            if (walk->pBuckets[i] != NULL)
-            {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
-                if (hTable)
-                    HndScanHandlesForGC(hTable, UpdatePointerPinned, uintptr_t(sc), uintptr_t(fn), types, ARRAY_SIZE(types), condemned, maxgen, flags);
-            }
-        walk = walk->pNext;
-    }
+    ScanHandleTablesForGC(UpdatePointerPinned, uintptr_t(sc), uintptr_t(fn), types, ARRAY_SIZE(types), condemned, maxgen, flags, sc, HNDSCAN_PARALLEL_UPDATE_PINNED);
 
     // update pointers in variable handles whose dynamic type is VHT_PINNED
     TraceVariableHandles(UpdatePointerPinned, uintptr_t(sc), uintptr_t(fn), VHT_PINNED, condemned, maxgen, flags);
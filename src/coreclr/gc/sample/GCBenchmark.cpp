@@ -0,0 +1,599 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBenchmark.cpp
+//
+
+//
+//  Microbenchmarks for the GC that run in the sample host, so GC changes can be measured without the rest of
+//  CoreCLR. Each scenario builds a synthetic heap shape and keeps it alive through GC handles while it
+//  churns through allocations:
+//
+//  * linkedlist - deep linked lists that get replaced one at a time, stressing deep marking
+//  * widearray  - a large array of references whose elements keep getting replaced, stressing card marking
+//  * cache      - a cache where most objects survive and a few get evicted, stressing high survival
+//  * pinning    - many short lived pinned objects scattered through gen0, plus a few that stay pinned like
+//                 receive buffers, stressing pinning and demotion (and, with GCSIPPinnedGCCount set, sweeping
+//                 regions with long lived pins in plan)
+//
+//  For every GC the sample EE reports the points in GCBenchmark.h, which gives the pause and the time spent
+//  in mark, in plan, and in relocate/compact or sweep. Fragmentation is taken from the GC's own memory info
+//  after each GC. The scenarios use a fixed seed so the allocations are the same from run to run.
+//
+//  GC settings can be passed as DOTNET_<setting> environment variables, as with the runtime.
+//
+//  The scenarios run against the workstation GC that is linked into the sample. The sample does not load
+//  clrgc through the standalone GC loader, and Server GC (gcsvr.cpp) is not built into it, since the sample EE
+//  cannot create the GC's own threads. Results for those configurations still have to be measured with the
+//  runtime.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+#include "GCBenchmark.h"
+
+//
+// GC timing records
+//
+
+#define MAX_RECORDED_GCS (64 * 1024)
+
+struct BenchGCRecord
+{
+    int64_t points[bench_gc_point_count];
+    uint64_t fragmentationBytes;
+    uint64_t heapSizeBytes;
+};
+
+static void RecordMemoryInfo(BenchGCRecord * pRecord);
+
+static BenchGCRecord * g_pGCRecords = NULL;
+static size_t g_numGCRecords = 0;
+static bool g_fRecordingGCs = false;
+static int64_t g_gcPoints[bench_gc_point_count];
+
+void BenchRecordGCPoint(bench_gc_point point)
+{
+    if (!g_fRecordingGCs)
+        return;
+
+    if (point == bench_gc_suspend)
+    {
+        for (int i = 0; i < bench_gc_point_count; i++)
+        {
+            g_gcPoints[i] = 0;
+        }
+    }
+
+    // Some callbacks are made more than once in a GC (the sync block cache is also scanned when
+    // relocating), the first one is the phase boundary
+    if (g_gcPoints[point] == 0)
+    {
+        g_gcPoints[point] = GCToOSInterface::QueryPerformanceCounter();
+    }
+
+    if ((point == bench_gc_restart) && (g_numGCRecords < MAX_RECORDED_GCS))
+    {
+        BenchGCRecord * pRecord = &g_pGCRecords[g_numGCRecords++];
+        memcpy(pRecord->points, g_gcPoints, sizeof(g_gcPoints));
+        RecordMemoryInfo(pRecord);
+    }
+}
+
+// RestartEE is called after the GC has recorded what it knows about the GC it just did
+static void RecordMemoryInfo(BenchGCRecord * pRecord)
+{
+    uint64_t highMemLoadThresholdBytes, totalAvailableMemoryBytes, lastRecordedMemLoadBytes;
+    uint64_t lastRecordedHeapSizeBytes, lastRecordedFragmentationBytes, totalCommittedBytes;
+    uint64_t promotedBytes, pinnedObjectCount, finalizationPendingCount, index;
+    uint32_t generation, pauseTimePct;
+    bool isCompaction, isConcurrent;
+    uint64_t genInfoRaw[total_generation_count * 4];
+    uint64_t pauseInfoRaw[2];
+
+    g_theGCHeap->GetMemoryInfo(&highMemLoadThresholdBytes, &totalAvailableMemoryBytes, &lastRecordedMemLoadBytes,
+        &lastRecordedHeapSizeBytes, &lastRecordedFragmentationBytes, &totalCommittedBytes, &promotedBytes,
+        &pinnedObjectCount, &finalizationPendingCount, &index, &generation, &pauseTimePct, &isCompaction,
+        &isConcurrent, genInfoRaw, pauseInfoRaw, gc_kind_any);
+
+    pRecord->fragmentationBytes = lastRecordedFragmentationBytes;
+    pRecord->heapSizeBytes = lastRecordedHeapSizeBytes;
+}
+
+//
+// Types used by the scenarios
+//
+
+class Node : public Object
+{
+public:
+    Object * m_pNext;
+    Object * m_pData;
+};
+
+class RefArray : public Object
+{
+public:
+    uint32_t m_dwLength;
+#ifdef HOST_64BIT
+    uint32_t m_dwPadding;
+#endif // HOST_64BIT
+    Object * m_Data[1];
+};
+
+struct BenchMethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+};
+
+static BenchMethodTable g_nodeMT;
+static BenchMethodTable g_refArrayMT;
+static BenchMethodTable g_byteArrayMT;
+
+static void InitializeBenchTypes()
+{
+    // Node: two adjacent references
+    uint32_t nodeSize = sizeof(Node) + sizeof(ObjHeader);
+    g_nodeMT.m_MT.m_baseSize = max(nodeSize, (uint32_t)MIN_OBJECT_SIZE);
+    g_nodeMT.m_MT.m_componentSize = 0;
+    g_nodeMT.m_MT.m_flags = MTFlag_ContainsPointers;
+    g_nodeMT.m_numSeries = 1;
+    g_nodeMT.m_series[0].SetSeriesOffset(offsetof(Node, m_pNext));
+    g_nodeMT.m_series[0].SetSeriesCount(2);
+    g_nodeMT.m_series[0].seriessize -= g_nodeMT.m_MT.m_baseSize;
+
+    // Array of references: the series covers all the elements, the GC adds the object size to the
+    // series size and the base size is subtracted here so only the elements are left
+    g_refArrayMT.m_MT.m_baseSize = offsetof(RefArray, m_Data) + sizeof(ObjHeader);
+    g_refArrayMT.m_MT.m_flags = MTFlag_ContainsPointers | MTFlag_HasComponentSize | MTFlag_IsArray;
+    g_refArrayMT.m_MT.m_componentSize = sizeof(Object *);
+    g_refArrayMT.m_numSeries = 1;
+    g_refArrayMT.m_series[0].SetSeriesOffset(offsetof(RefArray, m_Data));
+    g_refArrayMT.m_series[0].SetSeriesSize((size_t)0 - g_refArrayMT.m_MT.m_baseSize);
+
+    // Array of bytes, no references
+    g_byteArrayMT.m_MT.m_baseSize = offsetof(RefArray, m_Data) + sizeof(ObjHeader);
+    g_byteArrayMT.m_MT.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray;
+    g_byteArrayMT.m_MT.m_componentSize = 1;
+    g_byteArrayMT.m_numSeries = 0;
+}
+
+//
+// Helpers
+//
+
+// xorshift64, seeded the same way for every run so the scenarios are reproducible
+class BenchRandom
+{
+    uint64_t m_state;
+
+public:
+    BenchRandom() : m_state(0x2545F4914F6CDD1DULL) {}
+
+    uint64_t Next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return m_state;
+    }
+
+    uint32_t Next(uint32_t limit)
+    {
+        return (uint32_t)(Next() % limit);
+    }
+};
+
+static HHANDLETABLE GetBenchHandleTable()
+{
+    return g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+}
+
+static OBJECTHANDLE CreateBenchHandle(Object * pObject, uint32_t type = HNDTYPE_DEFAULT)
+{
+    return HndCreateHandle(GetBenchHandleTable(), type, pObject);
+}
+
+static void DestroyBenchHandle(OBJECTHANDLE handle, uint32_t type = HNDTYPE_DEFAULT)
+{
+    HndDestroyHandle(GetBenchHandleTable(), type, handle);
+}
+
+static RefArray * FetchArray(OBJECTHANDLE handle)
+{
+    return (RefArray *)HndFetchHandle(handle);
+}
+
+static void StoreElement(OBJECTHANDLE arrayHandle, uint32_t index, Object * pObject)
+{
+    WriteBarrier(&FetchArray(arrayHandle)->m_Data[index], pObject);
+}
+
+// Allocates a node whose m_pNext is the object in 'headHandle', and makes the node the new head
+static bool PushNode(OBJECTHANDLE headHandle)
+{
+    Node * pNode = (Node *)AllocateObject(&g_nodeMT.m_MT);
+    if (pNode == NULL)
+        return false;
+
+    WriteBarrier(&pNode->m_pNext, HndFetchHandle(headHandle));
+    HndAssignHandle(headHandle, pNode);
+    return true;
+}
+
+//
+// Scenarios. Each one returns false if an allocation failed.
+//
+
+// Keeps a few deep lists alive and replaces one of them every round, so full GCs have to mark
+// through very long chains and gen2 keeps getting garbage.
+static bool RunLinkedList(uint32_t scale)
+{
+    const int numLists = 4;
+    const uint32_t listLength = 250000;
+    const uint32_t rounds = 16 * scale;
+
+    OBJECTHANDLE lists[numLists];
+    for (int i = 0; i < numLists; i++)
+    {
+        lists[i] = CreateBenchHandle(NULL);
+    }
+
+    OBJECTHANDLE building = CreateBenchHandle(NULL);
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        HndAssignHandle(building, NULL);
+        for (uint32_t i = 0; i < listLength; i++)
+        {
+            if (!PushNode(building))
+                return false;
+
+            // Short lived garbage next to the list
+            if (AllocateObject(&g_nodeMT.m_MT) == NULL)
+                return false;
+        }
+
+        HndAssignHandle(lists[round % numLists], HndFetchHandle(building));
+    }
+
+    DestroyBenchHandle(building);
+    for (int i = 0; i < numLists; i++)
+    {
+        DestroyBenchHandle(lists[i]);
+    }
+
+    return true;
+}
+
+// Keeps a large array of references in the LOH and replaces random elements with new objects,
+// so every ephemeral GC has to find the young objects through the cards of the array.
+static bool RunWideArray(uint32_t scale)
+{
+    const uint32_t arrayLength = 256 * 1024;
+    const uint32_t replacements = 8 * 1024 * 1024 * scale;
+
+    BenchRandom random;
+
+    Object * pArray = AllocateArray(&g_refArrayMT.m_MT, arrayLength);
+    if (pArray == NULL)
+        return false;
+
+    OBJECTHANDLE arrayHandle = CreateBenchHandle(pArray);
+    for (uint32_t i = 0; i < replacements; i++)
+    {
+        Object * pNode = AllocateObject(&g_nodeMT.m_MT);
+        if (pNode == NULL)
+            return false;
+
+        StoreElement(arrayHandle, random.Next(arrayLength), pNode);
+    }
+
+    DestroyBenchHandle(arrayHandle);
+    return true;
+}
+
+// A cache of entries with payloads of random sizes where each step evicts one random entry, so
+// most of the heap survives every GC and gets promoted.
+static bool RunCache(uint32_t scale)
+{
+    const uint32_t cacheSize = 128 * 1024;
+    const uint32_t steps = 4 * 1024 * 1024 * scale;
+
+    BenchRandom random;
+
+    Object * pCache = AllocateArray(&g_refArrayMT.m_MT, cacheSize);
+    if (pCache == NULL)
+        return false;
+
+    OBJECTHANDLE cacheHandle = CreateBenchHandle(pCache);
+    OBJECTHANDLE entryHandle = CreateBenchHandle(NULL);
+    for (uint32_t i = 0; i < cacheSize + steps; i++)
+    {
+        Object * pEntry = AllocateObject(&g_nodeMT.m_MT);
+        if (pEntry == NULL)
+            return false;
+        HndAssignHandle(entryHandle, pEntry);
+
+        Object * pPayload = AllocateArray(&g_byteArrayMT.m_MT, 32 + random.Next(480));
+        if (pPayload == NULL)
+            return false;
+
+        Node * pNode = (Node *)HndFetchHandle(entryHandle);
+        WriteBarrier(&pNode->m_pData, pPayload);
+
+        // Fill the cache first, then evict random entries
+        uint32_t slot = (i < cacheSize) ? i : random.Next(cacheSize);
+        StoreElement(cacheHandle, slot, pNode);
+    }
+
+    DestroyBenchHandle(entryHandle);
+    DestroyBenchHandle(cacheHandle);
+    return true;
+}
+
+// Pins one object out of every few allocated and keeps a window of them pinned, so gen0 GCs
+// find pinned plugs scattered between dead objects.
+static bool RunPinning(uint32_t scale)
+{
+    const uint32_t numPinned = 1024;
+    const uint32_t numLongLivedPinned = 8;
+    const uint32_t pinInterval = 64;
+    const uint32_t allocations = 16 * 1024 * 1024 * scale;
+
+    BenchRandom random;
+
+    OBJECTHANDLE * pinnedHandles = new (nothrow) OBJECTHANDLE[numPinned];
+    if (pinnedHandles == NULL)
+        return false;
+
+    for (uint32_t i = 0; i < numPinned; i++)
+    {
+        pinnedHandles[i] = NULL;
+    }
+
+    for (uint32_t i = 0; i < allocations; i++)
+    {
+        Object * pObject = AllocateArray(&g_byteArrayMT.m_MT, 16 + random.Next(112));
+        if (pObject == NULL)
+            return false;
+
+        if ((i % pinInterval) == 0)
+        {
+            // The first few pinned objects stay pinned for the whole scenario
+            uint32_t pinIndex = i / pinInterval;
+            uint32_t slot = (pinIndex < numLongLivedPinned) ?
+                pinIndex : (numLongLivedPinned + random.Next(numPinned - numLongLivedPinned));
+            if (pinnedHandles[slot] != NULL)
+            {
+                DestroyBenchHandle(pinnedHandles[slot], HNDTYPE_PINNED);
+            }
+
+            pinnedHandles[slot] = CreateBenchHandle(pObject, HNDTYPE_PINNED);
+            if (pinnedHandles[slot] == NULL)
+                return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < numPinned; i++)
+    {
+        if (pinnedHandles[i] != NULL)
+        {
+            DestroyBenchHandle(pinnedHandles[i], HNDTYPE_PINNED);
+        }
+    }
+
+    delete[] pinnedHandles;
+    return true;
+}
+
+struct BenchScenario
+{
+    const char * name;
+    bool (*run)(uint32_t scale);
+};
+
+static const BenchScenario g_scenarios[] =
+{
+    { "linkedlist", RunLinkedList },
+    { "widearray", RunWideArray },
+    { "cache", RunCache },
+    { "pinning", RunPinning },
+};
+
+//
+// Reporting
+//
+
+static int CompareInt64(const void * a, const void * b)
+{
+    int64_t x = *(const int64_t *)a;
+    int64_t y = *(const int64_t *)b;
+    return (x < y) ? -1 : ((x > y) ? 1 : 0);
+}
+
+static double TicksToMicroseconds(int64_t ticks)
+{
+    return (double)ticks * 1000000.0 / (double)GCToOSInterface::QueryPerformanceFrequency();
+}
+
+// Time between two points of a GC, or 0 if the GC did not go through both
+static int64_t GetPhaseTicks(BenchGCRecord * pRecord, bench_gc_point start, bench_gc_point end)
+{
+    if ((pRecord->points[start] == 0) || (pRecord->points[end] == 0))
+        return 0;
+
+    return pRecord->points[end] - pRecord->points[start];
+}
+
+static void ReportScenario(const char * name, int64_t elapsedTicks, uint64_t allocatedBytes,
+                           int collectionCounts[max_generation + 1])
+{
+    int64_t * pauses = new (nothrow) int64_t[g_numGCRecords + 1];
+    if (pauses == NULL)
+        return;
+
+    int64_t markTicks = 0;
+    int64_t planTicks = 0;
+    int64_t finishTicks = 0;
+    uint64_t maxFragmentation = 0;
+    double sumFragmentationRatio = 0;
+    size_t numFragmentationSamples = 0;
+
+    for (size_t i = 0; i < g_numGCRecords; i++)
+    {
+        BenchGCRecord * pRecord = &g_pGCRecords[i];
+        pauses[i] = GetPhaseTicks(pRecord, bench_gc_suspend, bench_gc_restart);
+        markTicks += GetPhaseTicks(pRecord, bench_gc_mark_start, bench_gc_mark_end);
+        planTicks += GetPhaseTicks(pRecord, bench_gc_mark_end, bench_gc_plan_end);
+        finishTicks += GetPhaseTicks(pRecord, bench_gc_plan_end, bench_gc_done);
+
+        if (pRecord->heapSizeBytes != 0)
+        {
+            maxFragmentation = max(maxFragmentation, pRecord->fragmentationBytes);
+            sumFragmentationRatio += (double)pRecord->fragmentationBytes / (double)pRecord->heapSizeBytes;
+            numFragmentationSamples++;
+        }
+    }
+
+    qsort(pauses, g_numGCRecords, sizeof(int64_t), CompareInt64);
+
+    size_t n = g_numGCRecords;
+    double count = (n != 0) ? (double)n : 1.0;
+    printf("%s\n", name);
+    printf("  elapsed           %.1f ms, %llu MB allocated\n",
+        TicksToMicroseconds(elapsedTicks) / 1000.0, (unsigned long long)(allocatedBytes / (1024 * 1024)));
+    printf("  gcs               %zu (gen0 %d, gen1 %d, gen2 %d)\n",
+        n, collectionCounts[0], collectionCounts[1], collectionCounts[2]);
+    if (n != 0)
+    {
+        int64_t totalPause = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            totalPause += pauses[i];
+        }
+
+        printf("  pause us          p50 %.1f, p90 %.1f, p99 %.1f, max %.1f, total %.1f ms (%.1f%%)\n",
+            TicksToMicroseconds(pauses[n / 2]),
+            TicksToMicroseconds(pauses[(n * 90) / 100]),
+            TicksToMicroseconds(pauses[(n * 99) / 100]),
+            TicksToMicroseconds(pauses[n - 1]),
+            TicksToMicroseconds(totalPause) / 1000.0,
+            (elapsedTicks != 0) ? (100.0 * (double)totalPause / (double)elapsedTicks) : 0.0);
+    }
+    printf("  phase avg us      mark %.1f, plan %.1f, relocate/compact or sweep %.1f\n",
+        TicksToMicroseconds(markTicks) / count,
+        TicksToMicroseconds(planTicks) / count,
+        TicksToMicroseconds(finishTicks) / count);
+    printf("  fragmentation     avg %.1f%%, max %llu KB\n",
+        (numFragmentationSamples != 0) ? (100.0 * sumFragmentationRatio / (double)numFragmentationSamples) : 0.0,
+        (unsigned long long)(maxFragmentation / 1024));
+    if (g_numGCRecords == MAX_RECORDED_GCS)
+    {
+        printf("  (only the first %d GCs were recorded)\n", MAX_RECORDED_GCS);
+    }
+
+    delete[] pauses;
+}
+
+static int RunScenario(IGCHeap * pGCHeap, const BenchScenario * pScenario, uint32_t scale)
+{
+    // Start each scenario from a clean heap
+    pGCHeap->GarbageCollect(max_generation, false, collection_blocking);
+
+    int collectionCountsBefore[max_generation + 1];
+    for (int i = 0; i <= max_generation; i++)
+    {
+        collectionCountsBefore[i] = pGCHeap->CollectionCount(i);
+    }
+
+    uint64_t allocatedBefore = pGCHeap->GetTotalAllocatedBytes();
+
+    g_numGCRecords = 0;
+    g_fRecordingGCs = true;
+
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+    bool succeeded = pScenario->run(scale);
+    int64_t elapsed = GCToOSInterface::QueryPerformanceCounter() - start;
+
+    g_fRecordingGCs = false;
+
+    if (!succeeded)
+    {
+        printf("%s: allocation failed\n", pScenario->name);
+        return -1;
+    }
+
+    // Collection counts include all the lower generations, report each kind of GC on its own
+    int collectionCounts[max_generation + 1];
+    for (int i = 0; i <= max_generation; i++)
+    {
+        collectionCounts[i] = pGCHeap->CollectionCount(i) - collectionCountsBefore[i];
+    }
+    for (int i = 0; i < max_generation; i++)
+    {
+        collectionCounts[i] -= collectionCounts[i + 1];
+    }
+
+    ReportScenario(pScenario->name, elapsed, pGCHeap->GetTotalAllocatedBytes() - allocatedBefore,
+        collectionCounts);
+    return 0;
+}
+
+//
+// Usage: gcsample <scenario>|all [scale]
+//
+// The scale multiplies the amount of work each scenario does (default 1).
+//
+int RunGCBenchmarks(IGCHeap * pGCHeap, int argc, char * argv[])
+{
+    const char * selected = argv[0];
+    uint32_t scale = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1;
+    if (scale == 0)
+    {
+        scale = 1;
+    }
+
+    g_pGCRecords = new (nothrow) BenchGCRecord[MAX_RECORDED_GCS];
+    if (g_pGCRecords == NULL)
+        return -1;
+
+    InitializeBenchTypes();
+
+    bool found = false;
+    for (size_t i = 0; i < sizeof(g_scenarios) / sizeof(g_scenarios[0]); i++)
+    {
+        const BenchScenario * pScenario = &g_scenarios[i];
+        if ((strcmp(selected, "all") != 0) && (strcmp(selected, pScenario->name) != 0))
+            continue;
+
+        found = true;
+        if (RunScenario(pGCHeap, pScenario, scale) != 0)
+            return -1;
+    }
+
+    if (!found)
+    {
+        printf("Usage: gcsample <scenario>|all [scale]\n");
+        printf("Scenarios:");
+        for (size_t i = 0; i < sizeof(g_scenarios) / sizeof(g_scenarios[0]); i++)
+        {
+            printf(" %s", g_scenarios[i].name);
+        }
+        printf("\n");
+        return -1;
+    }
+
+    return 0;
+}
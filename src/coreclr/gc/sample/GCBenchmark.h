@@ -0,0 +1,42 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBenchmark.h
+//
+
+#ifndef __GCBENCHMARK_H__
+#define __GCBENCHMARK_H__
+
+//
+// Points in a GC that the sample EE reports to the benchmark harness. They are taken
+// from GC to EE callbacks that the GC makes at the boundaries of its phases:
+//
+//  * SuspendEE/RestartEE bound the pause
+//  * BeforeGcScanRoots starts the mark phase
+//  * SyncBlockCacheWeakPtrScan is first called at the end of the mark phase
+//  * DiagWalkSurvivors is called once plan has decided whether to compact
+//  * GcDone is called once relocate/compact or sweep is done
+//
+enum bench_gc_point
+{
+    bench_gc_suspend = 0,
+    bench_gc_mark_start,
+    bench_gc_mark_end,
+    bench_gc_plan_end,
+    bench_gc_done,
+    bench_gc_restart,
+    bench_gc_point_count
+};
+
+void BenchRecordGCPoint(bench_gc_point point);
+
+// Runs the benchmark scenarios given on the command line and prints their results
+int RunGCBenchmarks(IGCHeap * pGCHeap, int argc, char * argv[]);
+
+// Allocation and write barrier helpers implemented by GCSample.cpp
+Object * AllocateObject(MethodTable * pMT);
+Object * AllocateArray(MethodTable * pMT, uint32_t numComponents);
+void WriteBarrier(Object ** dst, Object * ref);
+
+#endif // __GCBENCHMARK_H__
@@ -13,6 +13,9 @@
 //  * How to implement fast object allocator and write barrier
 //  * How to allocate objects and work with GC handles
 //
+//  When given arguments, the sample instead runs the GC benchmark scenarios in GCBenchmark.cpp against
+//  synthetic heap shapes (see RunGCBenchmarks for the usage).
+//
 //  An important part of the sample is the GC environment (gcenv.*) that provides methods for GC to interact
 //  with the OS and execution engine.
 //
@@ -46,21 +49,26 @@
 #include "objecthandle.h"
 
 #include "gcdesc.h"
+#include "GCBenchmark.h"
 
 //
 // The fast paths for object allocation and write barriers is performance critical. They are often
 // hand written in assembly code, etc.
 //
-Object * AllocateObject(MethodTable * pMT)
+static Object * AllocateWithSize(MethodTable * pMT, size_t size)
 {
     alloc_context * acontext = GetThread()->GetAllocContext();
     Object * pObject;
 
-    size_t size = pMT->GetBaseSize();
-
     uint8_t* result = acontext->alloc_ptr;
     uint8_t* advance = result + size;
-    if (advance <= acontext->alloc_limit)
+    if (size >= LARGE_OBJECT_SIZE)
+    {
+        pObject = g_theGCHeap->Alloc(acontext, size, GC_ALLOC_LARGE_OBJECT_HEAP);
+        if (pObject == NULL)
+            return NULL;
+    }
+    else if (advance <= acontext->alloc_limit)
     {
         acontext->alloc_ptr = advance;
         pObject = (Object *)result;
@@ -77,6 +85,25 @@ Object * AllocateObject(MethodTable * pMT)
     return pObject;
 }
 
+Object * AllocateObject(MethodTable * pMT)
+{
+    return AllocateWithSize(pMT, pMT->GetBaseSize());
+}
+
+Object * AllocateArray(MethodTable * pMT, uint32_t numComponents)
+{
+    size_t size = pMT->GetBaseSize() + (size_t)numComponents * pMT->RawGetComponentSize();
+    size = (size + sizeof(uintptr_t) - 1) & ~(sizeof(uintptr_t) - 1);
+
+    Object * pObject = AllocateWithSize(pMT, size);
+    if (pObject == NULL)
+        return NULL;
+
+    *(uint32_t *)((uint8_t *)pObject + ArrayBase::GetOffsetOfNumComponents()) = numComponents;
+
+    return pObject;
+}
+
 #if defined(HOST_64BIT)
 // Card byte shift is different on 64bit.
 #define card_byte_shift     11
@@ -143,6 +170,11 @@ int __cdecl main(int argc, char* argv[])
     //
     ThreadStore::AttachCurrentThread();
 
+    if (argc > 1)
+    {
+        return RunGCBenchmarks(pGCHeap, argc - 1, argv + 1);
+    }
+
     //
     // Create a Methodtable with GCDesc
     //
@@ -7,6 +7,7 @@
 
 #include "gcenv.h"
 #include "gc.h"
+#include "GCBenchmark.h"
 
 EEConfig * g_pConfig;
 
@@ -126,6 +127,8 @@ void ThreadStore::AttachCurrentThread()
 
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    BenchRecordGCPoint(bench_gc_suspend);
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,6 +139,8 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    BenchRecordGCPoint(bench_gc_restart);
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
@@ -149,6 +154,7 @@ void GCToEEInterface::GcStartWork(int condemned, int max_gen)
 
 void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_concurrent)
 {
+    BenchRecordGCPoint(bench_gc_mark_start);
 }
 
 void GCToEEInterface::AfterGcScanRoots(int condemned, int max_gen, ScanContext* sc)
@@ -157,6 +163,7 @@ void GCToEEInterface::AfterGcScanRoots(int condemned, int max_gen, ScanContext*
 
 void GCToEEInterface::GcDone(int condemned)
 {
+    BenchRecordGCPoint(bench_gc_done);
 }
 
 bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
@@ -215,6 +222,7 @@ uint8_t* GCToEEInterface::GetLoaderAllocatorObjectForGC(Object* pObject)
 
 void GCToEEInterface::SyncBlockCacheWeakPtrScan(HANDLESCANPROC /*scanProc*/, uintptr_t /*lp1*/, uintptr_t /*lp2*/)
 {
+    BenchRecordGCPoint(bench_gc_mark_end);
 }
 
 void GCToEEInterface::SyncBlockCacheDemote(int /*max_gen*/)
@@ -243,6 +251,7 @@ void GCToEEInterface::DiagWalkFReachableObjects(void* gcContext)
 
 void GCToEEInterface::DiagWalkSurvivors(void* gcContext, bool fCompacting)
 {
+    BenchRecordGCPoint(bench_gc_plan_end);
 }
 
 void GCToEEInterface::DiagWalkUOHSurvivors(void* gcContext, int gen)
@@ -274,14 +283,41 @@ bool GCToEEInterface::EagerFinalized(Object* obj)
     return false;
 }
 
+// GC settings can be given as DOTNET_<key> environment variables holding hex numbers, like
+// for the runtime, so that the sample can be used to try out GC tuning.
+static bool GetConfigValueFromEnvironment(const char* privateKey, int64_t* value)
+{
+    if (privateKey == NULL)
+        return false;
+
+    char name[128];
+    snprintf(name, sizeof(name), "DOTNET_%s", privateKey);
+    const char* str = getenv(name);
+    if (str == NULL)
+        return false;
+
+    char* end;
+    int64_t result = (int64_t)strtoull(str, &end, 16);
+    if ((end == str) || (*end != '\0'))
+        return false;
+
+    *value = result;
+    return true;
+}
+
 bool GCToEEInterface::GetBooleanConfigValue(const char* privateKey, const char* publicKey, bool* value)
 {
-    return false;
+    int64_t intValue;
+    if (!GetConfigValueFromEnvironment(privateKey, &intValue))
+        return false;
+
+    *value = (intValue != 0);
+    return true;
 }
 
 bool GCToEEInterface::GetIntConfigValue(const char* privateKey, const char* publicKey, int64_t* value)
 {
-    return false;
+    return GetConfigValueFromEnvironment(privateKey, value);
 }
 
 bool GCToEEInterface::GetStringConfigValue(const char* privateKey, const char* publicKey, const char** value)
@@ -46,6 +46,9 @@ Abstract:
 #define PROC_STATM_FILENAME "/proc/self/statm"
 #define CGROUP1_MEMORY_LIMIT_FILENAME "/memory.limit_in_bytes"
 #define CGROUP2_MEMORY_LIMIT_FILENAME "/memory.max"
+#define CGROUP2_MEMORY_HIGH_FILENAME "/memory.high"
+#define CGROUP2_MEMORY_PRESSURE_FILENAME "/memory.pressure"
+#define PROC_PRESSURE_MEMORY_FILENAME "/proc/pressure/memory"
 #define CGROUP_MEMORY_STAT_FILENAME "/memory.stat"
 #define CGROUP1_MEMORY_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
@@ -79,7 +82,18 @@ public:
         else if (s_cgroup_version == 1)
             return GetCGroupMemoryLimit(val, CGROUP1_MEMORY_LIMIT_FILENAME);
         else if (s_cgroup_version == 2)
-            return GetCGroupMemoryLimit(val, CGROUP2_MEMORY_LIMIT_FILENAME);
+        {
+            // Above memory.high the kernel throttles the cgroup and reclaims its memory aggressively,
+            // so we treat it as a limit just like memory.max.
+            uint64_t high_limit;
+            bool result = GetCGroupMemoryLimit(val, CGROUP2_MEMORY_LIMIT_FILENAME);
+            if (GetCGroupMemoryLimit(&high_limit, CGROUP2_MEMORY_HIGH_FILENAME) && (!result || (high_limit < *val)))
+            {
+                *val = high_limit;
+                result = true;
+            }
+            return result;
+        }
         else
         {
             assert(!"Unknown cgroup version.");
@@ -87,6 +101,26 @@ public:
         }
     }
 
+    static bool GetMemoryPressure(uint32_t *val)
+    {
+        // cgroup v2 keeps pressure stall information per cgroup, otherwise use the system wide one.
+        bool result = false;
+        if ((s_cgroup_version == 2) && (s_memory_cgroup_path != nullptr))
+        {
+            char* pressure_filename = nullptr;
+            if (asprintf(&pressure_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_PRESSURE_FILENAME) >= 0)
+            {
+                result = ReadMemoryPressureFromFile(pressure_filename, val);
+                free(pressure_filename);
+            }
+        }
+
+        if (!result)
+            result = ReadMemoryPressureFromFile(PROC_PRESSURE_MEMORY_FILENAME, val);
+
+        return result;
+    }
+
     static bool GetPhysicalMemoryUsage(size_t *val)
     {
         if (s_cgroup_version == 0)
@@ -380,6 +414,34 @@ private:
         return result;
     }
 
+    static bool ReadMemoryPressureFromFile(const char *filename, uint32_t *val)
+    {
+        // See https://docs.kernel.org/accounting/psi.html - the first line looks like
+        // "some avg10=1.23 avg60=0.45 avg300=0.06 total=123456", avg10 being the percentage of
+        // the last 10 seconds at least one task was stalled waiting on memory.
+        FILE *file = fopen(filename, "r");
+        if (file == nullptr)
+            return false;
+
+        char *line = nullptr;
+        size_t lineLen = 0;
+        bool result = false;
+
+        if (getline(&line, &lineLen, file) != -1)
+        {
+            double avg10;
+            if ((sscanf(line, "some avg10=%lf", &avg10) == 1) && (avg10 >= 0))
+            {
+                *val = (avg10 < 100) ? (uint32_t)avg10 : 100;
+                result = true;
+            }
+        }
+
+        fclose(file);
+        free(line);
+        return result;
+    }
+
     static bool GetCGroupMemoryUsage(size_t *val, const char *filename, const char *inactiveFileFieldName)
     {
         // Use the same way to calculate memory load as popular container tools (Docker, Kubernetes, Containerd etc.)
@@ -517,6 +579,14 @@ size_t GetRestrictedPhysicalMemoryLimit()
     }
 }
 
+bool GetMemoryPressure(uint32_t* val)
+{
+    if (val == nullptr)
+        return false;
+
+    return CGroup::GetMemoryPressure(val);
+}
+
 bool GetPhysicalMemoryUsed(size_t* val)
 {
     bool result = false;
@@ -51,6 +51,18 @@ check_cxx_source_compiles("
     }
     " HAVE_MAP_HUGETLB)
 
+check_cxx_source_compiles("
+    #include <sys/ioctl.h>
+    #include <linux/fs.h>
+    #include <linux/userfaultfd.h>
+
+    int main()
+    {
+        struct pm_scan_arg arg;
+        return PAGEMAP_SCAN + PAGE_IS_WRITTEN + PM_SCAN_WP_MATCHING + UFFD_FEATURE_WP_ASYNC + UFFD_FEATURE_WP_UNPOPULATED;
+    }
+    " HAVE_PAGEMAP_SCAN)
+
 check_cxx_source_compiles("
 #include <pthread_np.h>
 int main(int argc, char **argv) {
@@ -110,6 +110,13 @@ extern "C"
 # endif
 #endif
 
+#if HAVE_PAGEMAP_SCAN
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>          // PAGEMAP_SCAN
+#include <linux/userfaultfd.h> // UFFDIO_WRITEPROTECT
+#endif // HAVE_PAGEMAP_SCAN
+
 #if HAVE_PTHREAD_NP_H
 #include <pthread_np.h>
 #endif
@@ -226,6 +233,7 @@ static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 
 size_t GetRestrictedPhysicalMemoryLimit();
 bool GetPhysicalMemoryUsed(size_t* val);
+bool GetMemoryPressure(uint32_t* val);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
@@ -636,9 +644,65 @@ void GCToOSInterface::YieldThread(uint32_t switchCount)
 //  flags     - flags to control special settings like write watching
 // Return:
 //  Starting virtual address of the reserved range
+#if HAVE_PAGEMAP_SCAN
+// Write watch is implemented with asynchronous userfaultfd write protection. Writes to a write
+// protected page are resolved by the kernel itself, so no thread has to handle faults, and the
+// pagemap PAGEMAP_SCAN ioctl reports the pages written since they were last write protected.
+static int g_writeWatchUffd = -1;
+static int g_writeWatchPagemap = -1;
+
+static void InitializeWriteWatch()
+{
+    // The GC consumes write watch results in 4KB units, which is the page size on Windows.
+    if (OS_PAGE_SIZE != 0x1000)
+    {
+        return;
+    }
+
+    int uffd = (int)syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY);
+    if (uffd == -1)
+    {
+        return;
+    }
+
+    const uint64_t requiredFeatures = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_UNPOPULATED;
+    struct uffdio_api api = {};
+    api.api = UFFD_API;
+    api.features = requiredFeatures;
+    if ((ioctl(uffd, UFFDIO_API, &api) != 0) || ((api.features & requiredFeatures) != requiredFeatures))
+    {
+        close(uffd);
+        return;
+    }
+
+    int pagemap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (pagemap == -1)
+    {
+        close(uffd);
+        return;
+    }
+
+    g_writeWatchUffd = uffd;
+    g_writeWatchPagemap = pagemap;
+}
+
+static bool RegisterWriteWatch(void* address, size_t size)
+{
+    struct uffdio_register reg = {};
+    reg.range.start = (uint64_t)address;
+    reg.range.len = size;
+    reg.mode = UFFDIO_REGISTER_MODE_WP;
+    return (ioctl(g_writeWatchUffd, UFFDIO_REGISTER, &reg) == 0);
+}
+#endif // HAVE_PAGEMAP_SCAN
+
 static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags, uint32_t hugePagesFlag = 0)
 {
+#if HAVE_PAGEMAP_SCAN
+    assert(!(flags & VirtualReserveFlags::WriteWatch) || (g_writeWatchUffd != -1));
+#else
     assert(!(flags & VirtualReserveFlags::WriteWatch) && "WriteWatch not supported on Unix");
+#endif // HAVE_PAGEMAP_SCAN
     if (alignment == 0)
     {
         alignment = OS_PAGE_SIZE;
@@ -665,6 +729,14 @@ static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags,
         }
 
         pRetVal = pAlignedRetVal;
+
+#if HAVE_PAGEMAP_SCAN
+        if ((flags & VirtualReserveFlags::WriteWatch) && !RegisterWriteWatch(pRetVal, size))
+        {
+            munmap(pRetVal, size);
+            pRetVal = NULL;
+        }
+#endif // HAVE_PAGEMAP_SCAN
     }
 
     return pRetVal;
@@ -735,13 +807,14 @@ bool GCToOSInterface::VirtualCommit(void* address, size_t size, uint16_t node)
     {
         if ((int)node <= g_highestNumaNode)
         {
+            const int bitsPerMaskElement = sizeof(unsigned long) * 8;
             int usedNodeMaskBits = g_highestNumaNode + 1;
-            int nodeMaskLength = (usedNodeMaskBits + sizeof(unsigned long) - 1) / sizeof(unsigned long);
+            int nodeMaskLength = (usedNodeMaskBits + bitsPerMaskElement - 1) / bitsPerMaskElement;
             unsigned long nodeMask[nodeMaskLength];
             memset(nodeMask, 0, sizeof(nodeMask));
 
-            int index = node / sizeof(unsigned long);
-            nodeMask[index] = ((unsigned long)1) << (node & (sizeof(unsigned long) - 1));
+            int index = node / bitsPerMaskElement;
+            nodeMask[index] = ((unsigned long)1) << (node % bitsPerMaskElement);
 
             int st = mbind(address, size, MPOL_PREFERRED, nodeMask, usedNodeMaskBits, 0);
             assert(st == 0);
@@ -766,6 +839,14 @@ bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
     // that much more clear to the operating system that we no
     // longer need these pages. Also, GC depends on re-commited pages to
     // be zeroed-out.
+#if HAVE_PAGEMAP_SCAN
+    if (g_writeWatchUffd != -1)
+    {
+        // Remapping would drop the userfaultfd registration of a write watched range, so discard
+        // the pages in place instead. Private anonymous pages read back as zeros once recommitted.
+        return (madvise(address, size, MADV_DONTNEED) == 0) && (mprotect(address, size, PROT_NONE) == 0);
+    }
+#endif // HAVE_PAGEMAP_SCAN
     return mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != NULL;
 }
 
@@ -803,7 +884,16 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
+#if HAVE_PAGEMAP_SCAN
+    if (g_writeWatchUffd == -1)
+    {
+        InitializeWriteWatch();
+    }
+
+    return (g_writeWatchUffd != -1);
+#else
     return false;
+#endif // HAVE_PAGEMAP_SCAN
 }
 
 // Reset the write tracking state for the specified virtual memory range.
@@ -812,7 +902,22 @@ bool GCToOSInterface::SupportsWriteWatch()
 //  size    - size of the virtual memory range
 void GCToOSInterface::ResetWriteWatch(void* address, size_t size)
 {
+#if HAVE_PAGEMAP_SCAN
+    assert(g_writeWatchUffd != -1);
+
+    // Like on Windows, the range covers all the pages that overlap [address, address + size).
+    uint64_t start = ALIGN_DOWN((size_t)address, OS_PAGE_SIZE);
+    uint64_t end = ALIGN_UP((size_t)address + size, OS_PAGE_SIZE);
+
+    struct uffdio_writeprotect wp = {};
+    wp.range.start = start;
+    wp.range.len = end - start;
+    wp.mode = UFFDIO_WRITEPROTECT_MODE_WP;
+    int st = ioctl(g_writeWatchUffd, UFFDIO_WRITEPROTECT, &wp);
+    assert(st == 0);
+#else
     assert(!"should never call ResetWriteWatch on Unix");
+#endif // HAVE_PAGEMAP_SCAN
 }
 
 // Retrieve addresses of the pages that are written to in a region of virtual memory
@@ -827,8 +932,60 @@ void GCToOSInterface::ResetWriteWatch(void* address, size_t size)
 //  true if it has succeeded, false if it has failed
 bool GCToOSInterface::GetWriteWatch(bool resetState, void* address, size_t size, void** pageAddresses, uintptr_t* pageAddressesCount)
 {
+#if HAVE_PAGEMAP_SCAN
+    assert(g_writeWatchPagemap != -1);
+
+    uintptr_t maxCount = *pageAddressesCount;
+    uintptr_t count = 0;
+    // PAGEMAP_SCAN rejects ranges that are not page aligned, while callers like the card bundle
+    // update pass arbitrary addresses, which Windows rounds to the pages that contain them.
+    uint64_t start = ALIGN_DOWN((size_t)address, OS_PAGE_SIZE);
+    uint64_t end = ALIGN_UP((size_t)address + size, OS_PAGE_SIZE);
+    struct page_region regions[64];
+
+    while ((start < end) && (count < maxCount))
+    {
+        struct pm_scan_arg arg = {};
+        arg.size = sizeof(arg);
+        // Write protecting the reported pages as part of the scan makes get and reset atomic
+        // per page, like GetWriteWatch with WRITE_WATCH_FLAG_RESET on Windows.
+        arg.flags = resetState ? (PM_SCAN_WP_MATCHING | PM_SCAN_CHECK_WPASYNC) : 0;
+        arg.start = start;
+        arg.end = end;
+        arg.vec = (uint64_t)regions;
+        arg.vec_len = sizeof(regions) / sizeof(regions[0]);
+        arg.max_pages = maxCount - count;
+        arg.category_mask = PAGE_IS_WRITTEN;
+        arg.return_mask = PAGE_IS_WRITTEN;
+
+        int regionCount = ioctl(g_writeWatchPagemap, PAGEMAP_SCAN, &arg);
+        if (regionCount < 0)
+        {
+            return false;
+        }
+
+        for (int i = 0; i < regionCount; i++)
+        {
+            for (uint64_t page = regions[i].start; (page < regions[i].end) && (count < maxCount); page += OS_PAGE_SIZE)
+            {
+                pageAddresses[count++] = (void*)page;
+            }
+        }
+
+        if (arg.walk_end <= start)
+        {
+            break;
+        }
+
+        start = arg.walk_end;
+    }
+
+    *pageAddressesCount = count;
+    return true;
+#else
     assert(!"should never call GetWriteWatch on Unix");
     return false;
+#endif // HAVE_PAGEMAP_SCAN
 }
 
 bool ReadMemoryValueFromFile(const char* filename, uint64_t* val)
@@ -1245,6 +1402,32 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
 #endif // HAVE_SYSCTL
 }
 
+// Re-read the restricted physical memory limit, which can change while the process is running
+// (e.g. when the memory limit of the container it runs in is adjusted).
+// Return:
+//  the current restricted limit, 0 if the process doesn't run with a restricted limit.
+uint64_t GCToOSInterface::RefreshRestrictedPhysicalMemoryLimit()
+{
+    size_t restricted_limit = GetRestrictedPhysicalMemoryLimit();
+    VolatileStore(&g_RestrictedPhysicalMemoryLimit, restricted_limit);
+
+    if (restricted_limit == SIZE_T_MAX)
+        return 0;
+
+    return restricted_limit;
+}
+
+// Get how much the process is stalled waiting on memory.
+// Parameters:
+//  pressure - A number between 0 and 100 that specifies the percentage of time in the last 10 seconds
+//      some threads were stalled because there wasn't enough physical memory.
+// Return:
+//  true if it has succeeded, false if the OS doesn't provide this information
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    return ::GetMemoryPressure(pressure);
+}
+
 // Get amount of physical memory available for use in the system
 uint64_t GetAvailablePhysicalMemory()
 {
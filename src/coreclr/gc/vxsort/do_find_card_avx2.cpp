@@ -0,0 +1,34 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#include "vxsort_targets_enable_avx2.h"
+
+#include <immintrin.h>
+
+// Returns the first non-zero card word in [card_word, card_word_end[, or card_word_end if there is none.
+// Clear card words are skipped 32 at a time.
+uint32_t* do_find_card_word_avx2 (uint32_t* card_word, uint32_t* card_word_end)
+{
+    const size_t words_per_step = 4 * sizeof(__m256i) / sizeof(uint32_t);
+
+    while ((size_t)(card_word_end - card_word) >= words_per_step)
+    {
+        __m256i v0 = _mm256_loadu_si256 ((const __m256i*)&card_word[0]);
+        __m256i v1 = _mm256_loadu_si256 ((const __m256i*)&card_word[8]);
+        __m256i v2 = _mm256_loadu_si256 ((const __m256i*)&card_word[16]);
+        __m256i v3 = _mm256_loadu_si256 ((const __m256i*)&card_word[24]);
+        __m256i v = _mm256_or_si256 (_mm256_or_si256 (v0, v1), _mm256_or_si256 (v2, v3));
+        if (!_mm256_testz_si256 (v, v))
+            break;
+        card_word += words_per_step;
+    }
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+#include "vxsort_targets_disable.h"
@@ -0,0 +1,34 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#include "vxsort_targets_enable_avx512.h"
+
+#include <immintrin.h>
+
+// Returns the first non-zero card word in [card_word, card_word_end[, or card_word_end if there is none.
+// Clear card words are skipped 64 at a time.
+uint32_t* do_find_card_word_avx512 (uint32_t* card_word, uint32_t* card_word_end)
+{
+    const size_t words_per_step = 4 * sizeof(__m512i) / sizeof(uint32_t);
+
+    while ((size_t)(card_word_end - card_word) >= words_per_step)
+    {
+        __m512i v0 = _mm512_loadu_si512 ((const void*)&card_word[0]);
+        __m512i v1 = _mm512_loadu_si512 ((const void*)&card_word[16]);
+        __m512i v2 = _mm512_loadu_si512 ((const void*)&card_word[32]);
+        __m512i v3 = _mm512_loadu_si512 ((const void*)&card_word[48]);
+        __m512i v = _mm512_or_si512 (_mm512_or_si512 (v0, v1), _mm512_or_si512 (v2, v3));
+        if (_mm512_test_epi32_mask (v, v) != 0)
+            break;
+        card_word += words_per_step;
+    }
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+#include "vxsort_targets_disable.h"
@@ -8,7 +8,11 @@
 #include "alignment.h"
 #include "machine_traits.h"
 
+#if defined(_M_ARM64) || defined(__aarch64__)
+#include <arm_neon.h>
+#else
 #include <immintrin.h>
+#endif
 
 namespace vxsort {
 
@@ -0,0 +1,28 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "bitonic_sort.NEON.h"
+
+using namespace vxsort;
+
+template <typename T>
+static void insertion_sort(T* ptr, size_t length) {
+    for (size_t i = 1; i < length; i++) {
+        T item = ptr[i];
+        size_t j = i;
+        while ((j > 0) && (ptr[j - 1] > item)) {
+            ptr[j] = ptr[j - 1];
+            j--;
+        }
+        ptr[j] = item;
+    }
+}
+
+void vxsort::smallsort::bitonic<int64_t, vector_machine::NEON >::sort(int64_t *ptr, size_t length) {
+    insertion_sort(ptr, length);
+}
+
+void vxsort::smallsort::bitonic<int32_t, vector_machine::NEON >::sort(int32_t *ptr, size_t length) {
+    insertion_sort(ptr, length);
+}
@@ -0,0 +1,28 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef BITONIC_SORT_NEON_H
+#define BITONIC_SORT_NEON_H
+
+#include "bitonic_sort.h"
+
+namespace vxsort {
+namespace smallsort {
+
+// With 128-bit vectors the small sorts only ever see up to 16 vectors of 2 or 4 elements,
+// so unlike the AVX2/AVX512 versions these are not generated bitonic networks but a simple
+// insertion sort, which is competitive at these sizes and doesn't need NEON at all.
+template<> struct bitonic<int64_t, NEON> {
+public:
+    static void sort(int64_t* ptr, size_t length);
+};
+
+template<> struct bitonic<int32_t, NEON> {
+public:
+    static void sort(int32_t* ptr, size_t length);
+};
+
+}  // namespace smallsort
+}  // namespace vxsort
+
+#endif  // BITONIC_SORT_NEON_H
@@ -2,7 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 
-#ifdef __GNUC__
+#if defined(__GNUC__) && !defined(__aarch64__)
 #ifdef __clang__
 #pragma clang attribute pop
 #else
@@ -1002,6 +1002,27 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
     return memStatus.ullTotalPhys;
 }
 
+// Re-read the restricted physical memory limit, which can change while the process is running
+// (e.g. when the memory limit of the job object it runs in is adjusted).
+// Return:
+//  the current restricted limit, 0 if the process doesn't run with a restricted limit.
+uint64_t GCToOSInterface::RefreshRestrictedPhysicalMemoryLimit()
+{
+    VolatileStore(&g_RestrictedPhysicalMemoryLimit, (size_t)UINTPTR_MAX);
+    return GetRestrictedPhysicalMemoryLimit();
+}
+
+// Get how much the process is stalled waiting on memory.
+// Parameters:
+//  pressure - A number between 0 and 100 that specifies the percentage of time in the last 10 seconds
+//      some threads were stalled because there wasn't enough physical memory.
+// Return:
+//  true if it has succeeded, false if the OS doesn't provide this information
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    return false;
+}
+
 // Get memory status
 // Parameters:
 //  restricted_limit - The amount of physical memory in bytes that the current process is being restricted to. If non-zero, it used to calculate
@@ -1816,18 +1816,24 @@ void GcInfoEncoder::Build()
         }
 
         // Figure out the largest offset, and total size of the sets
-        // Be sure to figure out the largest offset in the order that we will be emitting
-        // them in and not the order of their appearances in the safe point array.
+        // The sets are emitted in hash table order, except for the biggest one which is
+        // emitted last. The largest offset is then the total size minus the size of the
+        // biggest set, which can save a bit for each indirection in the offset encoding.
         // TODO: we should sort this to improve locality (the more frequent ones at the beginning)
-        // and to improve the indirection size (if the largest one is last, we *might* be able
-        // so use 1 less bit for each indirection for the offset encoding).
-        UINT32 largestSetOffset = 0;
+        const BitArray* biggestSet = NULL;
+        UINT32 sizeofBiggestSet = 0;
         UINT32 sizeofSets = 0;
         for (LiveStateHashTable::KeyIterator iter = hashMap.Begin(), end = hashMap.End(); !iter.Equal(end); iter.Next())
         {
-            largestSetOffset = sizeofSets;
-            sizeofSets += SizeofSlotStateVarLengthVector(*iter.Get(), LIVESTATE_RLE_SKIP_ENCBASE, LIVESTATE_RLE_RUN_ENCBASE);
+            UINT32 sizeofSet = SizeofSlotStateVarLengthVector(*iter.Get(), LIVESTATE_RLE_SKIP_ENCBASE, LIVESTATE_RLE_RUN_ENCBASE);
+            if ((biggestSet == NULL) || (sizeofSet > sizeofBiggestSet))
+            {
+                biggestSet = iter.Get();
+                sizeofBiggestSet = sizeofSet;
+            }
+            sizeofSets += sizeofSet;
         }
+        UINT32 largestSetOffset = sizeofSets - sizeofBiggestSet;
 
         // Now that we know the largest offset, we can figure out how much the indirection
         // will cost us and commit
@@ -1850,14 +1856,22 @@ void GcInfoEncoder::Build()
             GCINFO_WRITE(m_Info1, 1, 1, FlagsSize);
             GCINFO_WRITE_VARL_U(m_Info1, numBitsPerPointer - 1, POINTER_SIZE_ENCBASE, CallSiteStateSize);
 
-            // Now encode the live sets and record the real offset
+            // Now encode the live sets and record the real offset, leaving the biggest set for last
             for (LiveStateHashTable::KeyIterator iter = hashMap.Begin(), end = hashMap.End(); !iter.Equal(end); iter.Next())
             {
+                if (iter.Get() == biggestSet)
+                {
+                    continue;
+                }
                 _ASSERTE(FitsIn<UINT32>(m_Info2.GetBitCount()));
                 iter.SetValue((UINT32)m_Info2.GetBitCount());
                 GCINFO_WRITE_VAR_VECTOR(m_Info2, *iter.Get(), LIVESTATE_RLE_SKIP_ENCBASE, LIVESTATE_RLE_RUN_ENCBASE, CallSiteStateSize);
             }
 
+            _ASSERTE(largestSetOffset == m_Info2.GetBitCount());
+            hashMap.Set(biggestSet, largestSetOffset);
+            GCINFO_WRITE_VAR_VECTOR(m_Info2, *biggestSet, LIVESTATE_RLE_SKIP_ENCBASE, LIVESTATE_RLE_RUN_ENCBASE, CallSiteStateSize);
+
             _ASSERTE(sizeofSets == m_Info2.GetBitCount());
 
             for(pCurrent = pTransitions; pCurrent < pEndTransitions; )
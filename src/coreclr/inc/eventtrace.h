@@ -184,6 +184,32 @@ namespace ETW
         static VOID OnTypesKeywordTurnedOff();
     };
 
+    // Class to wrap the sampled allocation profiler for ETW. Allocations going through the
+    // allocation slow path are sampled so that each AllocationSampled event stands for
+    // ETW_AllocationSamplingMeanBytes allocated bytes on average, and the death of sampled
+    // objects is reported with AllocationSampleFreed once a GC has collected them.
+    class AllocationSamplingLog
+    {
+    private:
+        // Sampled objects still tracked for liveness
+        static const int s_cTrackedSamples = 1024;
+        static OBJECTHANDLE s_rgTrackedSampleHandles[s_cTrackedSamples];
+        static UINT64 s_rgTrackedSampleIDs[s_cTrackedSamples];
+
+        static INT64 s_nMeanBytesBetweenSamples;
+        static UINT64 s_nNextSampleID;
+        static unsigned int s_nLastScannedGCCount;
+
+    public:
+        static BOOL IsEnabled();
+        static void OnAllocationSlowPath(Object * pObject, UINT32 allocationKind);
+
+    private:
+        static INT64 GetNextSamplingInterval(Thread * pThread);
+        static void TrackSample(Object * pObject, UINT64 sampleID);
+        static void ReportFreedSamples();
+    };
+
 #endif // FEATURE_NATIVEAOT
 
 
@@ -260,6 +286,10 @@ namespace ETW
         static BOOL ShouldWalkHeapRootsForEtw();
         static BOOL ShouldTrackMovementForEtw();
         static HRESULT ForceGCForDiagnostics();
+#ifndef FEATURE_NATIVEAOT
+        static bool ForceBGCForHeapDump();
+        static void WalkBGCMarkedObjects(Object ** objects, size_t count, void * context);
+#endif // FEATURE_NATIVEAOT
         static VOID ForceGC(LONGLONG l64ClientSequenceNumber);
         static VOID FireGcStart(ETW_GC_INFO * pGcInfo);
         static VOID RootReference(
@@ -61,6 +61,10 @@ class ExecutableAllocator
 
     static int64_t g_releaseCount;
     static int64_t g_reserveCount;
+
+    static int64_t g_mapRWCount;
+    static int64_t g_mapRWCreateCount;
+    static int64_t g_mapRWReleaseCount;
 #endif
     // Instance of the allocator
     static ExecutableAllocator* g_instance;
@@ -102,18 +106,27 @@ class ExecutableAllocator
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
-    // Last RW mapping cached so that it can be reused for the next mapping
-    // request if it goes into the same range.
-    BlockRW* m_cachedMapping = NULL;
+    // Number of RW mappings kept alive in the cache
+    static const int CachedMappingCount = 4;
+
+    // Most recently used RW mappings, the most recent one first, cached so that
+    // they can be reused by the next mapping requests that go into the same ranges.
+    // Every cached mapping holds a reference on its RW block.
+    BlockRW* m_cachedMappings[CachedMappingCount] = {};
 
     // Synchronization of the public allocator methods
     CRITSEC_COOKIE m_CriticalSection;
 
-    // Update currently cached mapping. If the passed in block is the same as the one
-    // in the cache, it keeps it cached. Otherwise it destroys the currently cached one
-    // and replaces it by the passed in one.
+    // Make the passed in block the most recently used cached mapping. If it is not
+    // cached yet and the cache is full, the least recently used mapping is destroyed.
     void UpdateCachedMapping(BlockRW *pBlock);
 
+    // Destroy all cached mappings of RX memory within the specified range
+    void RemoveCachedMappings(void* baseRX, size_t size);
+
+    // Release the reference on an RW block and unmap it if it was the last one
+    void ReleaseRWBlock(void* pRW);
+
     // Find existing RW block that maps the whole specified range of RX memory.
     // Return NULL if no such block exists.
     void* FindRWBlock(void* baseRX, size_t size);
@@ -1266,6 +1266,7 @@ protected:
 #ifdef TARGET_XARCH
     void genCodeForShiftRMW(GenTreeStoreInd* storeInd);
     void genCodeForBT(GenTreeOp* bt);
+    void genCodeForSelect(GenTreeConditional* select);
 #endif // TARGET_XARCH
 
     void genCodeForCast(GenTreeOp* tree);
@@ -4433,12 +4433,29 @@ void CodeGen::genCodeForConditional(GenTreeConditional* tree)
     assert(genTypeSize(op1Type) == genTypeSize(op2Type));
 
     regNumber targetReg = tree->GetRegNum();
-    regNumber srcReg1   = genConsumeReg(op1);
+
+    if (tree->OperIs(GT_SELECT) && opcond->isContained())
+    {
+        // The condition is an integer compare that has to be emitted right before the csel.
+        // Unlike InsCondForCompareOp this has to take unsigned compares into account.
+        assert(opcond->OperIsCompare());
+        genCodeForCompare(opcond->AsOp());
+
+        const GenConditionDesc& desc = GenConditionDesc::Get(GenCondition::FromIntegralRelop(opcond));
+        assert(desc.oper == GT_NONE);
+
+        // The insCond values are defined in the same order as the jump kinds.
+        static_assert_no_msg((INS_COND_LE - INS_COND_EQ) == (EJ_le - EJ_eq));
+        cond = static_cast<insCond>(desc.jumpKind1 - EJ_eq);
+    }
+
+    regNumber srcReg1 = genConsumeReg(op1);
 
     if (tree->OperIs(GT_SELECT))
     {
         regNumber srcReg2 = genConsumeReg(op2);
         emit->emitIns_R_R_R_COND(INS_csel, cmpSize, targetReg, srcReg1, srcReg2, cond);
+        genProduceReg(tree);
         regSet.verifyRegUsed(targetReg);
     }
     else
@@ -1364,6 +1364,62 @@ void CodeGen::genCodeForBT(GenTreeOp* bt)
     GetEmitter()->emitIns_R_R(INS_bt, emitTypeSize(type), op2->GetRegNum(), op1->GetRegNum());
 }
 
+//------------------------------------------------------------------------
+// genCodeForSelect: Generates code for a GT_SELECT node.
+//
+// Arguments:
+//    select - The node.
+//
+// Notes:
+//    The condition is a contained integer compare, it is emitted here so that
+//    nothing can clobber the flags before the cmov. The destination is set to
+//    the "false" value and the "true" value is then conditionally moved into it.
+//
+void CodeGen::genCodeForSelect(GenTreeConditional* select)
+{
+    assert(select->OperIs(GT_SELECT));
+
+    GenTree*  cond = select->gtCond;
+    var_types type = genActualType(select->TypeGet());
+
+    assert(cond->isContained() && cond->OperIsCompare());
+    assert(varTypeIsIntegralOrI(type));
+
+    genCompareInt(cond);
+
+    regNumber dstReg   = select->GetRegNum();
+    regNumber trueReg  = genConsumeReg(select->gtOp1);
+    regNumber falseReg = genConsumeReg(select->gtOp2);
+
+    GenCondition condition = GenCondition::FromIntegralRelop(cond);
+
+    if (cond->AsOp()->MarkedForSignJumpOpt())
+    {
+        // The compare was elided because the previous instruction already set SF, see genCompareInt.
+        assert(cond->OperIs(GT_LT, GT_GE));
+        condition = cond->OperIs(GT_LT) ? GenCondition(GenCondition::S) : GenCondition(GenCondition::NS);
+    }
+
+    if (dstReg == trueReg)
+    {
+        // The destination already holds the "true" value, select the other way around.
+        std::swap(trueReg, falseReg);
+        condition = GenCondition::Reverse(condition);
+    }
+
+    const GenConditionDesc& desc = GenConditionDesc::Get(condition);
+    assert(desc.oper == GT_NONE);
+
+    // The cmovcc instructions are defined in the same order as the jcc ones.
+    static_assert_no_msg((INS_cmovg - INS_cmovo) == (EJ_jg - EJ_jo));
+    instruction ins = static_cast<instruction>(INS_cmovo + (desc.jumpKind1 - EJ_jo));
+
+    inst_Mov(type, dstReg, falseReg, /* canSkip */ true);
+    GetEmitter()->emitIns_R_R(ins, emitTypeSize(type), dstReg, trueReg);
+
+    genProduceReg(select);
+}
+
 // clang-format off
 const CodeGen::GenConditionDesc CodeGen::GenConditionDesc::map[32]
 {
@@ -1774,6 +1830,10 @@ void CodeGen::genCodeForTreeNode(GenTree* treeNode)
             genCodeForSetcc(treeNode->AsCC());
             break;
 
+        case GT_SELECT:
+            genCodeForSelect(treeNode->AsConditional());
+            break;
+
         case GT_BT:
             genCodeForBT(treeNode->AsOp());
             break;
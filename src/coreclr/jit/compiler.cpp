@@ -2430,6 +2430,7 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     opts.compJitAlignLoopAdaptive       = JitConfig.JitAlignLoopAdaptive() == 1;
     opts.compJitAlignLoopBoundary       = (unsigned short)JitConfig.JitAlignLoopBoundary();
     opts.compJitAlignLoopMinBlockWeight = (unsigned short)JitConfig.JitAlignLoopMinBlockWeight();
+    opts.compJitAlignLoopMinIterCount   = (unsigned short)JitConfig.JitAlignLoopMinIterCount();
 
     opts.compJitAlignLoopForJcc            = JitConfig.JitAlignLoopForJcc() == 1;
     opts.compJitAlignLoopMaxCodeSize       = (unsigned short)JitConfig.JitAlignLoopMaxCodeSize();
@@ -2439,6 +2440,7 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     opts.compJitAlignLoopAdaptive          = true;
     opts.compJitAlignLoopBoundary          = DEFAULT_ALIGN_LOOP_BOUNDARY;
     opts.compJitAlignLoopMinBlockWeight    = DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT;
+    opts.compJitAlignLoopMinIterCount      = DEFAULT_ALIGN_LOOP_MIN_ITER_COUNT;
     opts.compJitAlignLoopMaxCodeSize       = DEFAULT_MAX_LOOPSIZE_FOR_ALIGN;
     opts.compJitHideAlignBehindJmp         = true;
     opts.compJitOptimizeStructHiddenBuffer = true;
@@ -2722,7 +2724,13 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     fgPgoFailReason  = nullptr;
     fgPgoSource      = ICorJitInfo::PgoSource::Unknown;
 
-    if (jitFlags->IsSet(JitFlags::JIT_FLAG_BBOPT))
+    // Tier0 methods that use partial compilation look at the profile data too, so blocks that
+    // were never executed are not jitted until they are reached.
+    //
+    const bool partialCompilation =
+        jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) && (JitConfig.TC_PartialCompilation() > 0);
+
+    if (jitFlags->IsSet(JitFlags::JIT_FLAG_BBOPT) || partialCompilation)
     {
         fgPgoQueryResult = info.compCompHnd->getPgoInstrumentationResults(info.compMethodHnd, &fgPgoSchema,
                                                                           &fgPgoSchemaCount, &fgPgoData, &fgPgoSource);
@@ -4772,6 +4780,10 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
     };
     DoPhase(this, PHASE_MORPH_GLOBAL, morphGlobalPhase);
 
+    // Promote hot fields of structs that struct promotion left in memory
+    //
+    DoPhase(this, PHASE_PHYSICAL_PROMOTION, &Compiler::fgPhysicalPromotion);
+
     // GS security checks for unsafe buffers
     //
     auto gsPhase = [this]() {
@@ -4837,6 +4849,10 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         //
         DoPhase(this, PHASE_CLONE_LOOPS, &Compiler::optCloneLoops);
 
+        // Vectorize simple element-wise loops whose bounds checks cloning removed
+        //
+        DoPhase(this, PHASE_VECTORIZE_LOOPS, &Compiler::optVectorizeLoops);
+
         // Unroll loops
         //
         DoPhase(this, PHASE_UNROLL_LOOPS, &Compiler::optUnrollLoops);
@@ -4898,6 +4914,7 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         bool doCse           = true;
         bool doAssertionProp = true;
         bool doRangeAnalysis = true;
+        bool doIfConversion  = true;
         int  iterations      = 1;
 
 #if defined(OPT_CONFIG)
@@ -4910,6 +4927,7 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         doCse           = doValueNum;
         doAssertionProp = doValueNum && (JitConfig.JitDoAssertionProp() != 0);
         doRangeAnalysis = doAssertionProp && (JitConfig.JitDoRangeAnalysis() != 0);
+        doIfConversion  = (JitConfig.JitDoIfConversion() != 0);
 
         if (opts.optRepeat)
         {
@@ -5013,6 +5031,14 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
             ResetOptAnnotations();
             RecomputeLoopInfo();
         }
+
+        if (doIfConversion)
+        {
+            // Turn small branchy assignments into conditional selects. This runs
+            // after the SSA/VN based phases, since it does not maintain either.
+            //
+            DoPhase(this, PHASE_IF_CONVERSION, &Compiler::optIfConversion);
+        }
     }
 
 #ifdef DEBUG
@@ -1707,7 +1707,7 @@ enum LoopFlags : unsigned short
 {
     LPFLG_EMPTY = 0,
 
-    // LPFLG_UNUSED  = 0x0001,
+    LPFLG_FAST_PATH = 0x0001, // loop cloning removed the bounds checks on the iterator in this loop
     // LPFLG_UNUSED  = 0x0002,
     LPFLG_ITER = 0x0004, // loop of form: for (i = icon or expression; test_condition(); i++)
     // LPFLG_UNUSED    = 0x0008,
@@ -1821,6 +1821,7 @@ class Compiler
     friend class Lowering;
     friend class CSE_DataFlow;
     friend class CSE_Heuristic;
+    friend class CSE_HeuristicPGO;
     friend class CodeGenInterface;
     friend class CodeGen;
     friend class LclVarDsc;
@@ -1828,6 +1829,7 @@ class Compiler
     friend class LIR;
     friend class ObjectAllocator;
     friend class LocalAddressVisitor;
+    friend class LoopVectorizer;
     friend struct GenTree;
     friend class MorphInitBlockHelper;
     friend class MorphCopyBlockHelper;
@@ -2257,6 +2259,9 @@ public:
     // For binary opers.
     GenTree* gtNewOperNode(genTreeOps oper, var_types type, GenTree* op1, GenTree* op2);
 
+    GenTreeConditional* gtNewConditionalNode(
+        genTreeOps oper, GenTree* cond, GenTree* op1, GenTree* op2, var_types type);
+
     GenTreeColon* gtNewColonNode(var_types type, GenTree* elseNode, GenTree* thenNode);
     GenTreeQmark* gtNewQmarkNode(var_types type, GenTree* cond, GenTreeColon* colon);
 
@@ -4860,6 +4865,9 @@ public:
     // Does value-numbering for a block assignment.
     void fgValueNumberBlockAssignment(GenTree* tree);
 
+    // Flags the operand of a compare against a checked bound as a checked bound too.
+    void fgValueNumberJTrueCheckedBound(GenTree* tree);
+
     // Does value-numbering for a cast tree.
     void fgValueNumberCastTree(GenTree* tree);
 
@@ -5307,6 +5315,7 @@ public:
     void fgComputeEdgeWeights();
 
     bool fgReorderBlocks(bool useProfile);
+    bool fgExtTspLayout();
 
 #ifdef FEATURE_EH_FUNCLETS
     bool fgFuncletsAreCold();
@@ -5918,6 +5927,8 @@ private:
     bool fgForwardSubBlock(BasicBlock* block);
     bool fgForwardSubStatement(Statement* statement);
 
+    PhaseStatus fgPhysicalPromotion();
+
     // The given local variable, required to be a struct variable, is being assigned via
     // a "lclField", to make it masquerade as an integral type in the ABI.  Make sure that
     // the variable is not enregistered, and is therefore not promoted independently.
@@ -6070,6 +6081,9 @@ public:
     void optFindLoops();
 
     PhaseStatus optCloneLoops();
+    PhaseStatus optVectorizeLoops();
+    PhaseStatus optIfConversion();
+    bool optIfConvert(BasicBlock* block);
     void optCloneLoop(unsigned loopInd, LoopCloneContext* context);
     void optEnsureUniqueHead(unsigned loopInd, weight_t ambientWeight);
     PhaseStatus optUnrollLoops(); // Unrolls loops (needs to have cost info)
@@ -6863,12 +6877,16 @@ public:
         optMethodFlags |= OMF_HAS_GUARDEDDEVIRT;
     }
 
+    // Most classes a single call site guesses for.
+    static const unsigned MAX_GDV_TYPE_CHECKS = 5;
+
     void pickGDV(GenTreeCall*           call,
                  IL_OFFSET              ilOffset,
                  bool                   isInterface,
-                 CORINFO_CLASS_HANDLE*  classGuess,
-                 CORINFO_METHOD_HANDLE* methodGuess,
-                 unsigned*              likelihood);
+                 CORINFO_CLASS_HANDLE*  classGuesses,
+                 CORINFO_METHOD_HANDLE* methodGuesses,
+                 unsigned*              likelihoods,
+                 unsigned*              candidatesCount);
 
     void considerGuardedDevirtualization(GenTreeCall*            call,
                                          IL_OFFSET               ilOffset,
@@ -6877,6 +6895,14 @@ public:
                                          CORINFO_CLASS_HANDLE    baseClass,
                                          CORINFO_CONTEXT_HANDLE* pContextHandle);
 
+    void considerGuardedDevirtualizationCandidate(GenTreeCall*            call,
+                                                  bool                    isInterface,
+                                                  CORINFO_METHOD_HANDLE   baseMethod,
+                                                  CORINFO_CONTEXT_HANDLE* pContextHandle,
+                                                  CORINFO_CLASS_HANDLE    likelyClass,
+                                                  CORINFO_METHOD_HANDLE   likelyMethod,
+                                                  unsigned                likelihood);
+
     bool isCompatibleMethodGDV(GenTreeCall* call, CORINFO_METHOD_HANDLE gdvTarget);
 
     void addGuardedDevirtualizationCandidate(GenTreeCall*          call,
@@ -9207,6 +9233,10 @@ public:
 // Default minimum loop block weight required to enable loop alignment.
 #define DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT 4
 
+// Default minimum average iteration count per loop entry, when the loop has profile data,
+// required to enable loop alignment.
+#define DEFAULT_ALIGN_LOOP_MIN_ITER_COUNT 4
+
 // By default a loop will be aligned at 32B address boundary to get better
 // performance as per architecture manuals.
 #define DEFAULT_ALIGN_LOOP_BOUNDARY 0x20
@@ -9228,6 +9258,10 @@ public:
         // Minimum weight needed for the first block of a loop to make it a candidate for alignment.
         unsigned short compJitAlignLoopMinBlockWeight;
 
+        // Minimum average iteration count per entry needed for a loop with profile data to be a
+        // candidate for alignment.
+        unsigned short compJitAlignLoopMinIterCount;
+
         // For non-adaptive alignment, address boundary (power of 2) at which loop alignment should
         // be done. By default, 32B.
         unsigned short compJitAlignLoopBoundary;
@@ -9389,6 +9423,9 @@ public:
         STRESS_MODE(BYREF_PROMOTION) /* Change undoPromotion decisions for byrefs */            \
         STRESS_MODE(PROMOTE_FEWER_STRUCTS)/* Don't promote some structs that can be promoted */ \
         STRESS_MODE(VN_BUDGET)/* Randomize the VN budget */                                     \
+        STRESS_MODE(PHYSICAL_PROMOTION) /* Enable physical promotion */                         \
+        STRESS_MODE(VECTORIZE_LOOPS) /* Enable loop vectorization */                            \
+        STRESS_MODE(EXT_TSP_LAYOUT) /* Enable the ext-TSP block layout */                       \
                                                                                                 \
         /* After COUNT_VARN, stress level 2 does all of these all the time */                   \
                                                                                                 \
@@ -10811,6 +10848,28 @@ public:
                 }
                 break;
 
+            case GT_SELECT:
+            {
+                GenTreeConditional* const conditional = node->AsConditional();
+
+                result = WalkTree(&conditional->gtCond, conditional);
+                if (result == fgWalkResult::WALK_ABORT)
+                {
+                    return result;
+                }
+                result = WalkTree(&conditional->gtOp1, conditional);
+                if (result == fgWalkResult::WALK_ABORT)
+                {
+                    return result;
+                }
+                result = WalkTree(&conditional->gtOp2, conditional);
+                if (result == fgWalkResult::WALK_ABORT)
+                {
+                    return result;
+                }
+                break;
+            }
+
             case GT_CMPXCHG:
             {
                 GenTreeCmpXchg* const cmpXchg = node->AsCmpXchg();
@@ -4293,6 +4293,21 @@ void GenTree::VisitOperands(TVisitor visitor)
             }
             return;
 
+        case GT_SELECT:
+        {
+            GenTreeConditional* const conditional = this->AsConditional();
+            if (visitor(conditional->gtCond) == VisitResult::Abort)
+            {
+                return;
+            }
+            if (visitor(conditional->gtOp1) == VisitResult::Abort)
+            {
+                return;
+            }
+            visitor(conditional->gtOp2);
+            return;
+        }
+
         case GT_CMPXCHG:
         {
             GenTreeCmpXchg* const cmpXchg = this->AsCmpXchg();
@@ -58,6 +58,7 @@ CompMemKindMacro(TailMergeThrows)
 CompMemKindMacro(EarlyProp)
 CompMemKindMacro(ZeroInit)
 CompMemKindMacro(Pgo)
+CompMemKindMacro(Promotion)
 //clang-format on
 
 #undef CompMemKindMacro
@@ -48,6 +48,7 @@ CompPhaseNameMacro(PHASE_FWD_SUB,                    "Forward Substitution",
 CompPhaseNameMacro(PHASE_MORPH_IMPBYREF,             "Morph - ByRefs",                 "MOR-BYREF",  false, -1, false)
 CompPhaseNameMacro(PHASE_PROMOTE_STRUCTS,            "Morph - Promote Structs",        "PROMOTER" ,  false, -1, false)
 CompPhaseNameMacro(PHASE_MORPH_GLOBAL,               "Morph - Global",                 "MOR-GLOB",   false, -1, false)
+CompPhaseNameMacro(PHASE_PHYSICAL_PROMOTION,         "Physical promotion",             "PHYS-PROM",  false, -1, false)
 CompPhaseNameMacro(PHASE_MORPH_END,                  "Morph - Finish",                 "MOR-END",    false, -1, true)
 CompPhaseNameMacro(PHASE_GS_COOKIE,                  "GS Cookie",                      "GS-COOK",    false, -1, false)
 CompPhaseNameMacro(PHASE_COMPUTE_EDGE_WEIGHTS,       "Compute edge weights (1, false)","EDG-WGT",    false, -1, false)
@@ -63,6 +64,7 @@ CompPhaseNameMacro(PHASE_SET_BLOCK_WEIGHTS,          "Set block weights",
 CompPhaseNameMacro(PHASE_ZERO_INITS,                 "Redundant zero Inits",           "ZERO-INIT",  false, -1, false)
 CompPhaseNameMacro(PHASE_FIND_LOOPS,                 "Find loops",                     "LOOP-FND",   false, -1, false)
 CompPhaseNameMacro(PHASE_CLONE_LOOPS,                "Clone loops",                    "LP-CLONE",   false, -1, false)
+CompPhaseNameMacro(PHASE_VECTORIZE_LOOPS,            "Vectorize loops",                "LP-VECT",    false, -1, false)
 CompPhaseNameMacro(PHASE_UNROLL_LOOPS,               "Unroll loops",                   "UNROLL",     false, -1, false)
 CompPhaseNameMacro(PHASE_CLEAR_LOOP_INFO,            "Clear loop info",                "LP-CLEAR",   false, -1, false)
 CompPhaseNameMacro(PHASE_MORPH_MDARR,                "Morph array ops",                "MOR-ARRAY",  false, -1, false)
@@ -88,6 +90,7 @@ CompPhaseNameMacro(PHASE_OPTIMIZE_BRANCHES,          "Redundant branch opts",
 CompPhaseNameMacro(PHASE_ASSERTION_PROP_MAIN,        "Assertion prop",                 "AST-PROP",   false, -1, false)
 CompPhaseNameMacro(PHASE_OPT_UPDATE_FLOW_GRAPH,      "Update flow graph opt pass",     "UPD-FG-O",   false, -1, false)
 CompPhaseNameMacro(PHASE_COMPUTE_EDGE_WEIGHTS2,      "Compute edge weights (2, false)","EDG-WGT2",   false, -1, false)
+CompPhaseNameMacro(PHASE_IF_CONVERSION,              "If conversion",                  "IF-CONV",    false, -1, false)
 CompPhaseNameMacro(PHASE_INSERT_GC_POLLS,            "Insert GC Polls",                "GC-POLLS",   false, -1, true)
 CompPhaseNameMacro(PHASE_DETERMINE_FIRST_COLD_BLOCK, "Determine first cold block",     "COLD-BLK",   false, -1, true)
 CompPhaseNameMacro(PHASE_RATIONALIZE,                "Rationalize IR",                 "RAT",        false, -1, false)
@@ -1358,6 +1358,64 @@ void emitter::appendToCurIG(instrDesc* id)
     emitCurIGsize += id->idCodeSize();
 }
 
+#if defined(TARGET_ARM64)
+//------------------------------------------------------------------------
+// emitCanRemoveLastIns: check if the last instruction can be removed and
+//    replaced by a peephole optimization.
+//
+// Return Value:
+//    true if the last instruction is in the current instruction group, the
+//    group is not about to end and it is not part of a prolog or epilog (each
+//    of their instructions may be reported in the unwind data).
+//
+bool emitter::emitCanRemoveLastIns()
+{
+    if ((emitLastIns == nullptr) || (emitCurIGinsCnt == 0) || emitForceNewIG)
+    {
+        return false;
+    }
+
+    if ((emitCurIG->igFlags & IGF_NOGCINTERRUPT) != 0)
+    {
+        return false;
+    }
+
+    if (emitIGisInProlog(emitCurIG) || emitIGisInEpilog(emitCurIG))
+    {
+        return false;
+    }
+
+#if defined(FEATURE_EH_FUNCLETS)
+    if (emitIGisInFuncletProlog(emitCurIG) || emitIGisInFuncletEpilog(emitCurIG))
+    {
+        return false;
+    }
+#endif // FEATURE_EH_FUNCLETS
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// emitRemoveLastInstruction: remove the last instruction from the current
+//    instruction group, so that a peephole optimization can emit a combined
+//    instruction in its place.
+//
+void emitter::emitRemoveLastInstruction()
+{
+    assert(emitCanRemoveLastIns());
+    assert(emitCurIGfreeBase <= (BYTE*)emitLastIns);
+    assert((BYTE*)emitLastIns + emitSizeOfInsDsc(emitLastIns) == emitCurIGfreeNext);
+
+    emitCurIGfreeNext = (BYTE*)emitLastIns;
+    emitCurIGsize -= emitLastIns->idCodeSize();
+    emitCurIGinsCnt--;
+
+    // We don't know what the instruction before the removed one was; make sure
+    // the other peepholes don't look at it.
+    emitLastIns = nullptr;
+}
+#endif // TARGET_ARM64
+
 /*****************************************************************************
  *
  *  Display (optionally) an instruction offset.
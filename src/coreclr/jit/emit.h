@@ -1524,6 +1524,11 @@ protected:
 
     void appendToCurIG(instrDesc* id);
 
+#if defined(TARGET_ARM64)
+    bool emitCanRemoveLastIns();
+    void emitRemoveLastInstruction();
+#endif // TARGET_ARM64
+
     /********************************************************************************************/
 
     struct instrDescJmp : instrDesc
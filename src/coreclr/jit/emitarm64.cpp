@@ -5677,6 +5677,12 @@ void emitter::emitIns_R_R_I(
         {
             return;
         }
+
+        // Can the ldr/str be combined with the previous one into a ldp/stp?
+        if (emitComp->opts.OptimizationEnabled() && ReplaceLdrStrWithPairInstr(ins, attr, reg1, reg2, imm, size, fmt))
+        {
+            return;
+        }
     }
     else if (isAddSub)
     {
@@ -16093,4 +16099,132 @@ bool emitter::IsRedundantLdStr(
 
     return false;
 }
+
+//----------------------------------------------------------------------------------------
+// ReplaceLdrStrWithPairInstr:
+//    For ldr/str next to each other that access adjacent memory through the same base
+//    register, replace the previous instruction and the current one by a ldp/stp.
+//
+//    ldr x1,  [x2, #16]
+//    ldr x3,  [x2, #24]   <-- the pair is replaced by "ldp x1, x3, [x2, #16]"
+//
+//          OR
+//
+//    str w1,  [x2, #12]
+//    str w3,  [x2, #8]    <-- the pair is replaced by "stp w3, w1, [x2, #8]"
+//
+// Arguments:
+//    ins      - The current instruction
+//    reg1Attr - The emit attribute of the current destination/source, including its GC-ness
+//    reg1     - The current destination/source
+//    reg2     - The current base register, in its encoded form (SP is held as ZR)
+//    imm      - Immediate offset, scaled by the operand size for IF_LS_2B
+//    size     - Operand size
+//    fmt      - Format of instruction
+//
+// Return Value:
+//    true if the previous instruction was replaced by a pair that includes the current
+//    one, in which case the caller must not emit it.
+//
+// Notes:
+//    Only the "base" and "base plus scaled unsigned offset" forms are considered; the
+//    offsets have to be representable by the 7 bit signed scaled offset of ldp/stp.
+//
+bool emitter::ReplaceLdrStrWithPairInstr(
+    instruction ins, emitAttr reg1Attr, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt)
+{
+    if (((ins != INS_ldr) && (ins != INS_str)) || !emitCanRemoveLastIns() || (emitLastIns->idIns() != ins))
+    {
+        return false;
+    }
+
+    insFormat lastInsFmt = emitLastIns->idInsFmt();
+
+    if (((fmt != IF_LS_2A) && (fmt != IF_LS_2B)) || ((lastInsFmt != IF_LS_2A) && (lastInsFmt != IF_LS_2B)))
+    {
+        return false;
+    }
+
+    // Accesses to local variables carry GC liveness information for their stack slots.
+    if (!insOptsNone(emitLastIns->idInsOpt()) || (emitLastIns->idOpSize() != size) || emitLastIns->idIsLclVar())
+    {
+        return false;
+    }
+
+    // ldp/stp only handle 4 and 8 byte general registers and 4, 8 and 16 byte vector registers.
+    if ((size != EA_4BYTE) && (size != EA_8BYTE) && ((size != EA_16BYTE) || !isVectorRegister(reg1)))
+    {
+        return false;
+    }
+
+    regNumber prevReg1 = emitLastIns->idReg1();
+    regNumber prevReg2 = emitLastIns->idReg2();
+    ssize_t   prevImm  = emitGetInsSC(emitLastIns);
+
+    if ((prevReg2 != reg2) || (isVectorRegister(prevReg1) != isVectorRegister(reg1)))
+    {
+        return false;
+    }
+
+    if (ins == INS_ldr)
+    {
+        // ldp with the same destination twice is unpredictable, and the second load can't be
+        // moved before the first one if the first one overwrote the base register.
+        if ((prevReg1 == reg1) || (prevReg1 == reg2) || (reg1 == REG_ZR) || (prevReg1 == REG_ZR))
+        {
+            return false;
+        }
+    }
+
+    // Both offsets are scaled by the operand size here, as they will be for ldp/stp.
+    bool ascending;
+    if (imm == prevImm + 1)
+    {
+        ascending = true;
+    }
+    else if (prevImm == imm + 1)
+    {
+        ascending = false;
+    }
+    else
+    {
+        return false;
+    }
+
+    ssize_t pairImm = ascending ? prevImm : imm;
+    if (pairImm > 63)
+    {
+        return false;
+    }
+
+    emitAttr prevReg1Attr = size;
+    if (emitLastIns->idGCref() == GCT_GCREF)
+    {
+        prevReg1Attr = EA_GCREF;
+    }
+    else if (emitLastIns->idGCref() == GCT_BYREF)
+    {
+        prevReg1Attr = EA_BYREF;
+    }
+
+    instruction pairIns  = (ins == INS_ldr) ? INS_ldp : INS_stp;
+    regNumber   baseReg  = encodingZRtoSP(reg2);
+    ssize_t     byteOffs = pairImm * EA_SIZE_IN_BYTES(size);
+
+    JITDUMP("\n -- combining '%s' with the previous one into '%s'.\n", codeGen->genInsName(ins),
+            codeGen->genInsName(pairIns));
+
+    emitRemoveLastInstruction();
+
+    if (ascending)
+    {
+        emitIns_R_R_R_I(pairIns, prevReg1Attr, prevReg1, reg1, baseReg, byteOffs, INS_OPTS_NONE, reg1Attr);
+    }
+    else
+    {
+        emitIns_R_R_R_I(pairIns, reg1Attr, reg1, prevReg1, baseReg, byteOffs, INS_OPTS_NONE, prevReg1Attr);
+    }
+
+    return true;
+}
 #endif // defined(TARGET_ARM64)
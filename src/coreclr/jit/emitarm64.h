@@ -115,6 +115,16 @@ static bool IsMovInstruction(instruction ins);
 bool IsRedundantMov(instruction ins, emitAttr size, regNumber dst, regNumber src, bool canSkip);
 bool IsRedundantLdStr(instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
 
+// Method to merge a ldr/str with the previous ldr/str into a ldp/stp if they access adjacent memory.
+// If yes, the caller of this method must not emit the current instruction.
+bool ReplaceLdrStrWithPairInstr(instruction ins,
+                                emitAttr    reg1Attr,
+                                regNumber   reg1,
+                                regNumber   reg2,
+                                ssize_t     imm,
+                                emitAttr    size,
+                                insFormat   fmt);
+
 /************************************************************************
 *
 * This union is used to to encode/decode the special ARM64 immediate values
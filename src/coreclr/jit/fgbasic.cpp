@@ -2141,8 +2141,16 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
             // into the profitability model.
             impMakeDiscretionaryInlineObservations(impInlineInfo, compInlineResult);
 
-            // None of those observations should have changed the
-            // inline's viability.
+            // The only one of those observations that can change the
+            // inline's viability is a cold call site.
+            if (compInlineResult->IsFailure())
+            {
+                assert(compInlineResult->GetObservation() == InlineObservation::CALLSITE_IS_COLD);
+                impInlineRoot()->m_inlineStrategy->NoteUnprofitable();
+                JITDUMP("\n\nInline expansion aborted, call site is cold\n");
+                return;
+            }
+
             assert(compInlineResult->IsCandidate());
 
             if (isInlining)
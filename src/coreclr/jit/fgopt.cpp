@@ -8,6 +8,7 @@
 #endif
 
 #include "lower.h" // for LowerRange()
+#include "jitstd/algorithm.h"
 
 // Flowgraph Optimization
 
@@ -5875,6 +5876,453 @@ bool Compiler::fgReorderBlocks(bool useProfile)
 #pragma warning(pop)
 #endif
 
+//-----------------------------------------------------------------------------
+// fgExtTspLayout: reorder blocks to maximize the Extended TSP score of the
+//   layout, based on profile edge weights.
+//
+// Returns:
+//   True if the blocks were reordered.
+//
+// Notes:
+//   The Extended TSP score of a layout credits each flow edge with its
+//   weight when its target immediately follows its source, and with a
+//   fraction of its weight, decreasing with the distance, when the target
+//   is a short forward or backward jump away. Block sizes are estimated
+//   from the statement size costs.
+//
+//   Every block starts in a chain of its own. Chains are then merged
+//   greedily, each time concatenating the pair of chains whose merge
+//   increases the score the most, until no merge increases it. The chain
+//   that starts with the method entry is placed first, and the remaining
+//   chains follow by decreasing execution density, which moves cold code to
+//   the end of the method where fgDetermineFirstColdBlock can split it off.
+//
+//   Once the new order is linked, blocks whose fall through successor moved
+//   are fixed up: BBJ_COND blocks that now fall into their jump target get
+//   their condition reversed, and any other block that fell through gets an
+//   explicit jump via fgConnectFallThrough.
+//
+//   Methods with EH are skipped, so that try regions, handlers and call
+//   finally pairs never have to be kept contiguous.
+//
+bool Compiler::fgExtTspLayout()
+{
+    // Largest number of blocks for which the layout is computed. Each merge
+    // step considers the two merge orders of the chains joined by every
+    // edge, and computing a gain that is not cached scans all the edges, so
+    // for B blocks and E edges the chain merging is O(B * E * E) in the
+    // worst case.
+    const unsigned maxBlocks = 512;
+
+    // Weights of fall through edges, and of forward and backward jumps
+    // shorter than the given distances, in the Extended TSP score.
+    const double   fallThroughWeight   = 1.0;
+    const double   forwardJumpWeight   = 0.1;
+    const double   backwardJumpWeight  = 0.1;
+    const unsigned forwardDistanceMax  = 1024;
+    const unsigned backwardDistanceMax = 640;
+
+    if (((JitConfig.JitExtTspLayout() == 0) && !compStressCompile(STRESS_EXT_TSP_LAYOUT, 25)) ||
+        !fgIsUsingProfileWeights() || !fgHaveValidEdgeWeights || (compHndBBtabCount > 0) ||
+        (fgFirstBB->bbNext == nullptr) || (fgBBcount > maxBlocks))
+    {
+        return false;
+    }
+
+    JITDUMP("\n*************** In fgExtTspLayout()\n");
+
+    struct LayoutEdge
+    {
+        unsigned Source;
+        unsigned Target;
+        double   Weight;
+    };
+
+    CompAllocator allocator    = getAllocator(CMK_FlowList);
+    unsigned      numBlocks    = 0;
+    unsigned*     blockIndices = new (allocator) unsigned[fgBBNumMax + 1];
+    BasicBlock**  blocks       = new (allocator) BasicBlock*[fgBBcount];
+    unsigned*     sizes        = new (allocator) unsigned[fgBBcount];
+
+    for (BasicBlock* const block : Blocks())
+    {
+        unsigned size = 0;
+        for (Statement* const stmt : block->Statements())
+        {
+            size += stmt->GetCostSz();
+        }
+
+        blockIndices[block->bbNum] = numBlocks;
+        blocks[numBlocks]          = block;
+        sizes[numBlocks]           = max(size, 1u);
+        numBlocks++;
+    }
+
+    jitstd::vector<LayoutEdge> edges(allocator);
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        for (flowList* const edge : blocks[i]->PredEdges())
+        {
+            double const weight = (edge->edgeWeightMin() + edge->edgeWeightMax()) / 2;
+            if (weight > 0)
+            {
+                edges.push_back({blockIndices[edge->getBlock()->bbNum], i, weight});
+            }
+        }
+    }
+
+    if (edges.empty())
+    {
+        return false;
+    }
+
+    // Offsets of the blocks in the layout being scored.
+    unsigned* offsets = new (allocator) unsigned[numBlocks];
+
+    auto edgeScore = [&](const LayoutEdge& edge) -> double {
+        unsigned const sourceEnd   = offsets[edge.Source] + sizes[edge.Source];
+        unsigned const targetStart = offsets[edge.Target];
+
+        if (targetStart == sourceEnd)
+        {
+            return edge.Weight * fallThroughWeight;
+        }
+
+        if (targetStart > sourceEnd)
+        {
+            unsigned const distance = targetStart - sourceEnd;
+            return (distance < forwardDistanceMax)
+                       ? edge.Weight * forwardJumpWeight * (1.0 - (double)distance / forwardDistanceMax)
+                       : 0;
+        }
+
+        unsigned const distance = sourceEnd - targetStart;
+        return (distance < backwardDistanceMax)
+                   ? edge.Weight * backwardJumpWeight * (1.0 - (double)distance / backwardDistanceMax)
+                   : 0;
+    };
+
+    unsigned offset = 0;
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        offsets[i] = offset;
+        offset += sizes[i];
+    }
+
+    double oldScore = 0;
+    for (const LayoutEdge& edge : edges)
+    {
+        oldScore += edgeScore(edge);
+    }
+
+    // Chains are identified by the index of the block they were created for.
+    // A chain that has been merged into another one is null.
+    typedef jitstd::vector<unsigned> BlockChain;
+
+    BlockChain** chains    = new (allocator) BlockChain*[numBlocks];
+    unsigned*    chainOf   = new (allocator) unsigned[numBlocks];
+    double*      scores    = new (allocator) double[numBlocks];
+    unsigned*    versions  = new (allocator) unsigned[numBlocks];
+    unsigned     numChains = numBlocks;
+
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        chains[i] = new (allocator) BlockChain(allocator);
+        chains[i]->push_back(i);
+        chainOf[i]  = i;
+        scores[i]   = 0;
+        versions[i] = 0;
+    }
+
+    auto appendChain = [&](unsigned first, unsigned second) {
+        for (unsigned block : *chains[second])
+        {
+            chains[first]->push_back(block);
+            chainOf[block] = first;
+        }
+
+        chains[second] = nullptr;
+        versions[first]++;
+        numChains--;
+    };
+
+    // The entry block must stay first, so it keeps its fall through
+    // successor. Conditional blocks whose jump target is also their fall
+    // through successor stay paired with it as well.
+    for (unsigned i = 0; i + 1 < numBlocks; i++)
+    {
+        BasicBlock* const block = blocks[i];
+        if ((block->KindIs(BBJ_NONE) && (i == 0)) || (block->KindIs(BBJ_COND) && (block->bbJumpDest == block->bbNext)))
+        {
+            appendChain(chainOf[i], chainOf[i + 1]);
+        }
+    }
+
+    // Score of the edges within the concatenation of two chains, or within
+    // a single chain when both are the same.
+    auto chainScore = [&](unsigned first, unsigned second) -> double {
+        unsigned offset = 0;
+        for (unsigned block : *chains[first])
+        {
+            offsets[block] = offset;
+            offset += sizes[block];
+        }
+
+        if (second != first)
+        {
+            for (unsigned block : *chains[second])
+            {
+                offsets[block] = offset;
+                offset += sizes[block];
+            }
+        }
+
+        double score = 0;
+        for (const LayoutEdge& edge : edges)
+        {
+            unsigned const sourceChain = chainOf[edge.Source];
+            unsigned const targetChain = chainOf[edge.Target];
+            if (((sourceChain == first) || (sourceChain == second)) &&
+                ((targetChain == first) || (targetChain == second)))
+            {
+                score += edgeScore(edge);
+            }
+        }
+
+        return score;
+    };
+
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        if (chains[i] != nullptr)
+        {
+            scores[i] = chainScore(i, i);
+        }
+    }
+
+    // Gains of merging ordered pairs of chains, valid as long as the
+    // versions of both chains are unchanged.
+    struct MergeGain
+    {
+        unsigned FirstVersion;
+        unsigned SecondVersion;
+        double   Gain;
+    };
+
+    typedef JitHashTable<UINT64, JitLargePrimitiveKeyFuncs<UINT64>, MergeGain> MergeGainMap;
+    MergeGainMap gains(allocator);
+
+    auto mergeGain = [&](unsigned first, unsigned second) -> double {
+        UINT64 const key = ((UINT64)first << 32) | second;
+        MergeGain    gain;
+        if (!gains.Lookup(key, &gain) || (gain.FirstVersion != versions[first]) ||
+            (gain.SecondVersion != versions[second]))
+        {
+            gain.FirstVersion  = versions[first];
+            gain.SecondVersion = versions[second];
+            gain.Gain          = chainScore(first, second) - scores[first] - scores[second];
+            gains.Set(key, gain, MergeGainMap::Overwrite);
+        }
+
+        return gain.Gain;
+    };
+
+    unsigned const entryChain = chainOf[0];
+
+    while (numChains > 1)
+    {
+        double   bestGain   = 0;
+        unsigned bestFirst  = 0;
+        unsigned bestSecond = 0;
+
+        for (const LayoutEdge& edge : edges)
+        {
+            unsigned const sourceChain = chainOf[edge.Source];
+            unsigned const targetChain = chainOf[edge.Target];
+            if (sourceChain == targetChain)
+            {
+                continue;
+            }
+
+            for (unsigned order = 0; order < 2; order++)
+            {
+                unsigned const first  = (order == 0) ? sourceChain : targetChain;
+                unsigned const second = (order == 0) ? targetChain : sourceChain;
+                if (second == entryChain)
+                {
+                    continue;
+                }
+
+                double const gain = mergeGain(first, second);
+                if (gain > bestGain)
+                {
+                    bestGain   = gain;
+                    bestFirst  = first;
+                    bestSecond = second;
+                }
+            }
+        }
+
+        if (bestGain <= 0)
+        {
+            break;
+        }
+
+        scores[bestFirst] += scores[bestSecond] + bestGain;
+        appendChain(bestFirst, bestSecond);
+    }
+
+    // Order the chains: the entry chain first, the others by decreasing
+    // density, and by their original position on ties.
+    double*   densities  = new (allocator) double[numBlocks];
+    unsigned* chainOrder = new (allocator) unsigned[numChains];
+    unsigned  chainCount = 0;
+
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        if (chains[i] == nullptr)
+        {
+            continue;
+        }
+
+        double   weight = 0;
+        unsigned size   = 0;
+        for (unsigned block : *chains[i])
+        {
+            weight += blocks[block]->bbWeight * sizes[block];
+            size += sizes[block];
+        }
+
+        densities[i]             = weight / size;
+        chainOrder[chainCount++] = i;
+    }
+
+    assert(chainCount == numChains);
+    jitstd::sort(chainOrder, chainOrder + chainCount, [&](unsigned chain1, unsigned chain2) {
+        if ((chain1 == entryChain) || (chain2 == entryChain))
+        {
+            return chain1 == entryChain;
+        }
+
+        if (densities[chain1] != densities[chain2])
+        {
+            return densities[chain1] > densities[chain2];
+        }
+
+        return (*chains[chain1])[0] < (*chains[chain2])[0];
+    });
+
+    // Score the new layout, and keep the old one unless the new one is
+    // meaningfully better.
+    unsigned* newOrder = new (allocator) unsigned[numBlocks];
+    unsigned  position = 0;
+    offset             = 0;
+
+    for (unsigned i = 0; i < chainCount; i++)
+    {
+        for (unsigned block : *chains[chainOrder[i]])
+        {
+            newOrder[position++] = block;
+            offsets[block]       = offset;
+            offset += sizes[block];
+        }
+    }
+
+    assert(position == numBlocks);
+    assert(newOrder[0] == 0);
+
+    double newScore = 0;
+    for (const LayoutEdge& edge : edges)
+    {
+        newScore += edgeScore(edge);
+    }
+
+    JITDUMP("Ext-TSP score of the layout: old %f, new %f\n", oldScore, newScore);
+
+    if (newScore <= oldScore * 1.01)
+    {
+        JITDUMP("Keeping the current layout\n");
+        return false;
+    }
+
+    // Link the blocks in the new order.
+    BasicBlock** oldNext = new (allocator) BasicBlock*[numBlocks];
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        oldNext[i] = blocks[i]->bbNext;
+    }
+
+    BasicBlock* prevBlock = nullptr;
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        BasicBlock* const block = blocks[newOrder[i]];
+        block->bbPrev           = prevBlock;
+        if (prevBlock != nullptr)
+        {
+            prevBlock->bbNext = block;
+        }
+
+        prevBlock = block;
+    }
+
+    prevBlock->bbNext = nullptr;
+    fgLastBB          = prevBlock;
+    assert(fgFirstBB == blocks[newOrder[0]]);
+
+    // Fix up the blocks whose fall through successor moved.
+    for (unsigned i = 0; i < numBlocks; i++)
+    {
+        BasicBlock* const block = blocks[i];
+        BasicBlock* const next  = oldNext[i];
+
+        if ((next == nullptr) || (block->bbNext == next) || !block->bbFallsThrough())
+        {
+            continue;
+        }
+
+        if (block->KindIs(BBJ_COND) && (block->bbNext == block->bbJumpDest))
+        {
+            JITDUMP("Reversing the condition of " FMT_BB " to fall through into " FMT_BB "\n", block->bbNum,
+                    block->bbNext->bbNum);
+
+            Statement* const condTestStmt = block->lastStmt();
+            GenTree* const   condTest     = condTestStmt->GetRootNode();
+
+            noway_assert(condTest->gtOper == GT_JTRUE);
+            condTest->AsOp()->gtOp1 = gtReverseCond(condTest->AsOp()->gtOp1);
+
+            // may need to rethread
+            //
+            if (fgStmtListThreaded)
+            {
+                JITDUMP("Rethreading " FMT_STMT "\n", condTestStmt->GetID());
+                gtSetStmtInfo(condTestStmt);
+                fgSetStmtSeq(condTestStmt);
+            }
+
+            block->bbJumpDest = next;
+            continue;
+        }
+
+        fgConnectFallThrough(block, next);
+    }
+
+    fgRenumberBlocks();
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("\nAfter fgExtTspLayout:\n");
+        fgDispBasicBlocks(verboseTrees);
+        printf("\n");
+    }
+
+    fgDebugCheckBBlist();
+#endif // DEBUG
+
+    return true;
+}
+
 //-------------------------------------------------------------
 // fgUpdateFlowGraph: Removes any empty blocks, unreachable blocks, and redundant jumps.
 // Most of those appear after dead store removal and folding of conditionals.
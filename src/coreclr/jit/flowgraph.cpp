@@ -52,6 +52,51 @@ static bool blockNeedsGCPoll(BasicBlock* block)
     return blockMayNeedGCPoll;
 }
 
+//------------------------------------------------------------------------
+// blockNeedsLoopGCPoll: Determine whether the block ends with a back edge
+//    of a loop that may not execute a call.
+//
+// Arguments:
+//   block         - the block to check
+//
+// Notes:
+//    Relies on the blocks being numbered in lexical order. Like the checks
+//    in fgSetBlockOrder, a back edge is safe if its source or its target is
+//    known to execute a call.
+//
+// Returns:
+//    Whether the GC poll needs to be inserted after the block
+//
+static bool blockNeedsLoopGCPoll(BasicBlock* block)
+{
+    if ((block->bbFlags & (BBF_GC_SAFE_POINT | BBF_KEEP_BBJ_ALWAYS)) != 0)
+    {
+        return false;
+    }
+
+    switch (block->bbJumpKind)
+    {
+        case BBJ_COND:
+        case BBJ_ALWAYS:
+            return (block->bbJumpDest->bbNum <= block->bbNum) &&
+                   ((block->bbJumpDest->bbFlags & (BBF_GC_SAFE_POINT | BBF_LOOP_CALL1)) == 0);
+
+        case BBJ_SWITCH:
+            for (BasicBlock* const bTarget : block->SwitchTargets())
+            {
+                if ((bTarget->bbNum <= block->bbNum) &&
+                    ((bTarget->bbFlags & (BBF_GC_SAFE_POINT | BBF_LOOP_CALL1)) == 0))
+                {
+                    return true;
+                }
+            }
+            return false;
+
+        default:
+            return false;
+    }
+}
+
 //------------------------------------------------------------------------------
 // fgInsertGCPolls : Insert GC polls for basic blocks containing calls to methods
 //                   with SuppressGCTransitionAttribute.
@@ -61,6 +106,11 @@ static bool blockNeedsGCPoll(BasicBlock* block)
 //    find the basic blocks that require GC polls; when optimizing the tree nodes
 //    are scanned to find calls to methods with SuppressGCTransitionAttribute.
 //
+//    With JitGCPollLoops, optimized methods that were made fully interruptible
+//    because of a loop without calls also get a poll on each such back edge, so
+//    that the threads running the loop reach a safe point without relying on
+//    being interrupted by the runtime. The method stays fully interruptible.
+//
 //    This must be done after any transformations that would add control flow between
 //    calls.
 //
@@ -71,11 +121,19 @@ PhaseStatus Compiler::fgInsertGCPolls()
 {
     PhaseStatus result = PhaseStatus::MODIFIED_NOTHING;
 
-    if ((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0)
+    const bool pollLoops = opts.OptimizationEnabled() && GetInterruptible() && (JitConfig.JitGCPollLoops() != 0);
+
+    if (((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0) && !pollLoops)
     {
         return result;
     }
 
+    if (pollLoops)
+    {
+        // Back edges are found by comparing block numbers.
+        fgRenumberBlocks();
+    }
+
     bool createdPollBlocks = false;
 
 #ifdef DEBUG
@@ -96,7 +154,8 @@ PhaseStatus Compiler::fgInsertGCPolls()
 
         // When optimizations are enabled, we can't rely on BBF_HAS_SUPPRESSGC_CALL flag:
         // the call could've been moved, e.g., hoisted from a loop, CSE'd, etc.
-        if (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) == 0) : !blockNeedsGCPoll(block))
+        if (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) == 0)
+                                        : (!blockNeedsGCPoll(block) && !(pollLoops && blockNeedsLoopGCPoll(block))))
         {
             continue;
         }
@@ -351,10 +351,83 @@ GCInfo::WriteBarrierForm GCInfo::gcWriteBarrierFormFromTargetAddress(GenTree* tg
         return GCInfo::WBF_BarrierUnchecked;
     }
 
+    // The tree may not show it, e.g. when the address was computed into a local,
+    // but value numbering may know that it points into an object.
+    if ((compiler->vnStore != nullptr) && gcIsHeapAddressVN(tgtAddr->gtVNPair.GetLiberal()))
+    {
+        return GCInfo::WBF_BarrierUnchecked;
+    }
+
     // Otherwise, we have no information.
     return GCInfo::WBF_BarrierUnknown;
 }
 
+//------------------------------------------------------------------------
+// gcIsHeapAddressVN: Check if a value number describes an address in the GC heap.
+//
+// Arguments:
+//    vn - The (liberal) value number of a byref address
+//
+// Return Value:
+//    True if the address is an array element, or an object plus an offset.
+//
+// Notes:
+//    Stores through such addresses can use the unchecked write barrier. Nothing
+//    is known about the generation of the object, so the barrier itself is still
+//    needed, even for an object allocated just before the store: the object could
+//    be a large one outside of the ephemeral generations, and the barrier also
+//    records the write for the background GC.
+//
+bool GCInfo::gcIsHeapAddressVN(ValueNum vn)
+{
+    ValueNumStore* const vnStore = compiler->vnStore;
+
+    // Look through a few levels of offset additions.
+    for (int depth = 0; depth < 4; depth++)
+    {
+        if (vn == ValueNumStore::NoVN)
+        {
+            return false;
+        }
+
+        if (vnStore->TypeOfVN(vn) == TYP_REF)
+        {
+            return !vnStore->IsVNConstant(vn);
+        }
+
+        VNFuncApp funcApp;
+        if (!vnStore->GetVNFunc(vn, &funcApp))
+        {
+            return false;
+        }
+
+        if (funcApp.m_func == VNF_PtrToArrElem)
+        {
+            return true;
+        }
+
+        if (funcApp.m_func != VNFunc(GT_ADD))
+        {
+            return false;
+        }
+
+        if (varTypeIsGC(vnStore->TypeOfVN(funcApp.m_args[0])))
+        {
+            vn = funcApp.m_args[0];
+        }
+        else if (varTypeIsGC(vnStore->TypeOfVN(funcApp.m_args[1])))
+        {
+            vn = funcApp.m_args[1];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
 /*****************************************************************************
  *
  *  Initialize the non-register pointer variable tracking logic.
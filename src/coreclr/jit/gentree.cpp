@@ -310,6 +310,7 @@ void GenTree::InitNodeSize()
     static_assert_no_msg(sizeof(GenTreeField)        <= TREE_NODE_SZ_LARGE); // *** large node
     static_assert_no_msg(sizeof(GenTreeFieldList)    <= TREE_NODE_SZ_SMALL);
     static_assert_no_msg(sizeof(GenTreeColon)        <= TREE_NODE_SZ_SMALL);
+    static_assert_no_msg(sizeof(GenTreeConditional)  <= TREE_NODE_SZ_SMALL);
     static_assert_no_msg(sizeof(GenTreeCall)         <= TREE_NODE_SZ_LARGE); // *** large node
     static_assert_no_msg(sizeof(GenTreeCmpXchg)      <= TREE_NODE_SZ_LARGE); // *** large node
     static_assert_no_msg(sizeof(GenTreeFptrVal)      <= TREE_NODE_SZ_LARGE); // *** large node
@@ -2649,6 +2650,11 @@ AGAIN:
         case GT_FIELD_LIST:
             return GenTreeFieldList::Equals(op1->AsFieldList(), op2->AsFieldList());
 
+        case GT_SELECT:
+            return Compare(op1->AsConditional()->gtCond, op2->AsConditional()->gtCond) &&
+                   Compare(op1->AsConditional()->gtOp1, op2->AsConditional()->gtOp1) &&
+                   Compare(op1->AsConditional()->gtOp2, op2->AsConditional()->gtOp2);
+
         case GT_CMPXCHG:
             return Compare(op1->AsCmpXchg()->gtOpLocation, op2->AsCmpXchg()->gtOpLocation) &&
                    Compare(op1->AsCmpXchg()->gtOpValue, op2->AsCmpXchg()->gtOpValue) &&
@@ -3152,6 +3158,12 @@ AGAIN:
             }
             break;
 
+        case GT_SELECT:
+            hash = genTreeHashAdd(hash, gtHashValue(tree->AsConditional()->gtCond));
+            hash = genTreeHashAdd(hash, gtHashValue(tree->AsConditional()->gtOp1));
+            hash = genTreeHashAdd(hash, gtHashValue(tree->AsConditional()->gtOp2));
+            break;
+
         case GT_CMPXCHG:
             hash = genTreeHashAdd(hash, gtHashValue(tree->AsCmpXchg()->gtOpLocation));
             hash = genTreeHashAdd(hash, gtHashValue(tree->AsCmpXchg()->gtOpValue));
@@ -5751,6 +5763,30 @@ unsigned Compiler::gtSetEvalOrder(GenTree* tree)
             }
             break;
 
+        case GT_SELECT:
+        {
+            GenTreeConditional* const select = tree->AsConditional();
+
+            level  = gtSetEvalOrder(select->gtCond);
+            costEx = select->gtCond->GetCostEx();
+            costSz = select->gtCond->GetCostSz();
+
+            lvl2  = gtSetEvalOrder(select->gtOp1);
+            level = max(level, lvl2);
+            costEx += select->gtOp1->GetCostEx();
+            costSz += select->gtOp1->GetCostSz();
+
+            lvl2  = gtSetEvalOrder(select->gtOp2);
+            level = max(level, lvl2);
+            costEx += select->gtOp2->GetCostEx();
+            costSz += select->gtOp2->GetCostSz();
+
+            // The conditional move/select itself.
+            costEx += 2;
+            costSz += 4;
+            break;
+        }
+
         case GT_CMPXCHG:
 
             level  = gtSetEvalOrder(tree->AsCmpXchg()->gtOpLocation);
@@ -6063,6 +6099,27 @@ bool GenTree::TryGetUse(GenTree* operand, GenTree*** pUse)
             }
             return false;
 
+        case GT_SELECT:
+        {
+            GenTreeConditional* const select = this->AsConditional();
+            if (operand == select->gtCond)
+            {
+                *pUse = &select->gtCond;
+                return true;
+            }
+            if (operand == select->gtOp1)
+            {
+                *pUse = &select->gtOp1;
+                return true;
+            }
+            if (operand == select->gtOp2)
+            {
+                *pUse = &select->gtOp2;
+                return true;
+            }
+            return false;
+        }
+
         case GT_CMPXCHG:
         {
             GenTreeCmpXchg* const cmpXchg = this->AsCmpXchg();
@@ -6739,6 +6796,28 @@ GenTree* Compiler::gtNewOperNode(genTreeOps oper, var_types type, GenTree* op1,
     return node;
 }
 
+//------------------------------------------------------------------------
+// gtNewConditionalNode: Create a GT_SELECT node.
+//
+// Arguments:
+//    oper - The conditional oper (currently only GT_SELECT)
+//    cond - The condition, a relop
+//    op1  - The value of the node when the condition is true
+//    op2  - The value of the node when the condition is false
+//    type - The type of the node
+//
+// Return Value:
+//    The created node.
+//
+GenTreeConditional* Compiler::gtNewConditionalNode(
+    genTreeOps oper, GenTree* cond, GenTree* op1, GenTree* op2, var_types type)
+{
+    assert(GenTree::OperIsConditional(oper));
+    GenTreeConditional* node = new (this, oper) GenTreeConditional(oper, type, cond, op1, op2);
+    node->gtFlags |= (cond->gtFlags & GTF_ALL_EFFECT);
+    return node;
+}
+
 GenTreeColon* Compiler::gtNewColonNode(var_types type, GenTree* elseNode, GenTree* thenNode)
 {
     return new (this, GT_COLON) GenTreeColon(TYP_INT, elseNode, thenNode);
@@ -8693,6 +8772,13 @@ GenTree* Compiler::gtCloneExpr(
             }
             break;
 
+        case GT_SELECT:
+            copy = gtNewConditionalNode(oper, gtCloneExpr(tree->AsConditional()->gtCond, addFlags, deepVarNum, deepVarVal),
+                                        gtCloneExpr(tree->AsConditional()->gtOp1, addFlags, deepVarNum, deepVarVal),
+                                        gtCloneExpr(tree->AsConditional()->gtOp2, addFlags, deepVarNum, deepVarVal),
+                                        tree->TypeGet());
+            break;
+
         case GT_CMPXCHG:
             copy = new (this, GT_CMPXCHG)
                 GenTreeCmpXchg(tree->TypeGet(),
@@ -9337,6 +9423,12 @@ GenTreeUseEdgeIterator::GenTreeUseEdgeIterator(GenTree* node)
             AdvancePhi();
             return;
 
+        case GT_SELECT:
+            m_edge = &m_node->AsConditional()->gtCond;
+            assert(*m_edge != nullptr);
+            m_advance = &GenTreeUseEdgeIterator::AdvanceConditional;
+            return;
+
         case GT_CMPXCHG:
             m_edge = &m_node->AsCmpXchg()->gtOpLocation;
             assert(*m_edge != nullptr);
@@ -9397,6 +9489,29 @@ void GenTreeUseEdgeIterator::AdvanceCmpXchg()
     assert(*m_edge != nullptr);
 }
 
+//------------------------------------------------------------------------
+// GenTreeUseEdgeIterator::AdvanceConditional: produces the next operand of a conditional node and advances the state.
+//
+void GenTreeUseEdgeIterator::AdvanceConditional()
+{
+    GenTreeConditional* const conditional = m_node->AsConditional();
+    switch (m_state)
+    {
+        case 0:
+            m_edge  = &conditional->gtOp1;
+            m_state = 1;
+            break;
+        case 1:
+            m_edge    = &conditional->gtOp2;
+            m_advance = &GenTreeUseEdgeIterator::Terminate;
+            break;
+        default:
+            unreached();
+    }
+
+    assert(*m_edge != nullptr);
+}
+
 //------------------------------------------------------------------------
 // GenTreeUseEdgeIterator::AdvanceArrElem: produces the next operand of a ArrElem node and advances the state.
 //
@@ -11986,6 +12101,17 @@ void Compiler::gtDispTree(GenTree*     tree,
             }
             break;
 
+        case GT_SELECT:
+            gtDispCommonEndLine(tree);
+
+            if (!topOnly)
+            {
+                gtDispChild(tree->AsConditional()->gtCond, indentStack, IIArc, nullptr, topOnly);
+                gtDispChild(tree->AsConditional()->gtOp1, indentStack, IIArc, nullptr, topOnly);
+                gtDispChild(tree->AsConditional()->gtOp2, indentStack, IIArcBottom, nullptr, topOnly);
+            }
+            break;
+
         case GT_CMPXCHG:
             gtDispCommonEndLine(tree);
 
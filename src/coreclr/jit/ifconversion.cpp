@@ -0,0 +1,295 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "jitpch.h"
+
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+//------------------------------------------------------------------------
+// If Conversion
+//
+// This phase turns small branchy assignments to a local into conditional
+// selects, which lower to cmov on xarch and csel on arm64. Three shapes of
+// flow are recognized, where each middle block contains nothing but a single
+// assignment of a local or a constant to the same local V:
+//
+//    B:  if (cond) goto J          B:  if (cond) goto T          B:  if (cond) goto T
+//    F:  V = f                     J:  ...                       F:  V = f; goto J
+//    J:  ...                       T:  V = t; goto J             T:  V = t
+//                                                                J:  ...
+//
+// and they all become
+//
+//    B:  V = SELECT(cond, t, f)
+//
+// where the missing value of a triangle is V itself. The values are plain
+// locals or constants, so evaluating both of them unconditionally has no
+// side effects and costs nothing more than the branch did.
+//
+// A select is not always profitable: it makes the result of the assignment
+// depend on the condition, where a well predicted branch would have let the
+// processor speculate past it. So a branch is only converted when profile data
+// says both of its successors are taken a significant part of the time (see
+// JitIfConversionMinLikelihood). Without profile data there is no telling
+// whether the branch is predictable, and it is left alone. For testing,
+// JitDoIfConversion=2 also converts branches without profile data outside of
+// loops, where a select would likely become a loop carried dependency.
+//
+// The phase runs after the SSA and VN based optimizations, so it does not
+// have to keep SSA or value numbers up to date.
+
+//------------------------------------------------------------------------
+// optIfConversion: convert small if/else diamonds to conditional selects.
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus Compiler::optIfConversion()
+{
+    bool madeChanges = false;
+
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+    for (BasicBlock* const block : Blocks())
+    {
+        madeChanges |= optIfConvert(block);
+    }
+#endif // TARGET_XARCH || TARGET_ARM64
+
+    return madeChanges ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
+
+//------------------------------------------------------------------------
+// optIfConvertGetStore: check if a block is a suitable middle block for if
+//    conversion and get its assignment.
+//
+// Arguments:
+//    comp   - compiler instance
+//    block  - the BBJ_COND block being converted
+//    middle - one of the successors of block
+//    next   - [out] the block that middle flows into
+//
+// Returns:
+//    The ASG(LCL_VAR, value) that is the only statement of middle, or
+//    nullptr if middle is not suitable for if conversion.
+//
+static GenTree* optIfConvertGetStore(Compiler* comp, BasicBlock* block, BasicBlock* middle, BasicBlock** next)
+{
+    if ((middle == block) || (middle->GetUniquePred(comp) != block) || !BasicBlock::sameEHRegion(block, middle))
+    {
+        return nullptr;
+    }
+
+    if (((middle->bbFlags & (BBF_DONT_REMOVE | BBF_KEEP_BBJ_ALWAYS)) != 0) || (middle == comp->genReturnBB))
+    {
+        return nullptr;
+    }
+
+    if (!middle->KindIs(BBJ_NONE, BBJ_ALWAYS))
+    {
+        return nullptr;
+    }
+
+    Statement* const stmt = middle->firstStmt();
+
+    if ((stmt == nullptr) || (stmt->GetNextStmt() != nullptr))
+    {
+        return nullptr;
+    }
+
+    GenTree* const asg = stmt->GetRootNode();
+
+    if (!asg->OperIs(GT_ASG) || !asg->gtGetOp1()->OperIs(GT_LCL_VAR))
+    {
+        return nullptr;
+    }
+
+    LclVarDsc* const varDsc = comp->lvaGetDesc(asg->gtGetOp1()->AsLclVar());
+    var_types const  type   = varDsc->TypeGet();
+
+#ifdef TARGET_64BIT
+    if ((type != TYP_INT) && (type != TYP_LONG))
+#else
+    if (type != TYP_INT)
+#endif
+    {
+        return nullptr;
+    }
+
+    if (varDsc->IsAddressExposed())
+    {
+        return nullptr;
+    }
+
+    GenTree* const value = asg->gtGetOp2();
+
+    if (value->TypeGet() != type)
+    {
+        return nullptr;
+    }
+
+    if (value->OperIs(GT_LCL_VAR))
+    {
+        if (comp->lvaGetDesc(value->AsLclVar())->IsAddressExposed())
+        {
+            return nullptr;
+        }
+    }
+    else if (!value->IsCnsIntOrI() || value->IsIconHandle())
+    {
+        return nullptr;
+    }
+
+    *next = middle->KindIs(BBJ_NONE) ? middle->bbNext : middle->bbJumpDest;
+    return asg;
+}
+
+//------------------------------------------------------------------------
+// optIfConvert: try to convert the branch at the end of a block into a
+//    conditional select.
+//
+// Arguments:
+//    block - the block
+//
+// Returns:
+//    True if the block was converted.
+//
+bool Compiler::optIfConvert(BasicBlock* block)
+{
+    if (!block->KindIs(BBJ_COND))
+    {
+        return false;
+    }
+
+    Statement* const jtrueStmt = block->lastStmt();
+    GenTree* const   jtrue     = jtrueStmt->GetRootNode();
+    GenTree* const   cond      = jtrue->gtGetOp1();
+
+    assert(jtrue->OperIs(GT_JTRUE));
+
+    if (!cond->OperIsCompare() || varTypeIsFloating(cond->gtGetOp1()) ||
+        ((cond->gtFlags & (GTF_ASG | GTF_CALL)) != 0))
+    {
+        return false;
+    }
+
+#ifndef TARGET_64BIT
+    if (varTypeIsLong(cond->gtGetOp1()))
+    {
+        return false;
+    }
+#endif
+
+    BasicBlock* const trueBlock  = block->bbJumpDest;
+    BasicBlock* const falseBlock = block->bbNext;
+
+    if (trueBlock == falseBlock)
+    {
+        return false;
+    }
+
+    BasicBlock* trueNext   = nullptr;
+    BasicBlock* falseNext  = nullptr;
+    GenTree*    trueStore  = optIfConvertGetStore(this, block, trueBlock, &trueNext);
+    GenTree*    falseStore = optIfConvertGetStore(this, block, falseBlock, &falseNext);
+
+    if ((trueStore != nullptr) && (falseStore != nullptr) && (trueNext == falseNext) &&
+        (trueStore->gtGetOp1()->AsLclVar()->GetLclNum() == falseStore->gtGetOp1()->AsLclVar()->GetLclNum()))
+    {
+        // Diamond, both successors are middle blocks.
+    }
+    else if ((falseStore != nullptr) && (falseNext == trueBlock))
+    {
+        trueStore = nullptr;
+    }
+    else if ((trueStore != nullptr) && (trueNext == falseBlock))
+    {
+        falseStore = nullptr;
+    }
+    else
+    {
+        return false;
+    }
+
+    // The middle block whose weight says how often the "true" or "false" side is taken.
+    BasicBlock* const middle = (trueStore != nullptr) ? trueBlock : falseBlock;
+
+    if (block->hasProfileWeight() && middle->hasProfileWeight())
+    {
+        // Only convert if the branch is not well predicted, i.e. both sides are taken often.
+        weight_t const blockWeight  = block->bbWeight;
+        weight_t const middleWeight = min(middle->bbWeight, blockWeight);
+        weight_t const minWeight    = blockWeight * JitConfig.JitIfConversionMinLikelihood() / 100.0;
+
+        if ((blockWeight == BB_ZERO_WEIGHT) || (middleWeight < minWeight) ||
+            ((blockWeight - middleWeight) < minWeight))
+        {
+            JITDUMP("Not if-converting " FMT_BB ": branch is predictable (" FMT_WT " of " FMT_WT ")\n", block->bbNum,
+                    middleWeight, blockWeight);
+            return false;
+        }
+    }
+    else
+    {
+        bool convertWithoutProfile = false;
+#if defined(OPT_CONFIG)
+        convertWithoutProfile =
+            (JitConfig.JitDoIfConversion() == 2) && (block->bbNatLoopNum == BasicBlock::NOT_IN_LOOP);
+#endif // OPT_CONFIG
+
+        if (!convertWithoutProfile)
+        {
+            JITDUMP("Not if-converting " FMT_BB ": there is no profile data\n", block->bbNum);
+            return false;
+        }
+    }
+
+    GenTree* const store  = (trueStore != nullptr) ? trueStore : falseStore;
+    unsigned const lclNum = store->gtGetOp1()->AsLclVar()->GetLclNum();
+    var_types      type   = store->gtGetOp1()->TypeGet();
+
+    GenTree* trueValue  = (trueStore != nullptr) ? trueStore->gtGetOp2() : gtNewLclvNode(lclNum, type);
+    GenTree* falseValue = (falseStore != nullptr) ? falseStore->gtGetOp2() : gtNewLclvNode(lclNum, type);
+
+    JITDUMP("If-converting " FMT_BB " (true " FMT_BB ", false " FMT_BB ") to a select of V%02u\n", block->bbNum,
+            trueBlock->bbNum, falseBlock->bbNum, lclNum);
+
+    // The compare now produces a value for the select rather than controlling a jump.
+    cond->gtFlags &= ~GTF_RELOP_JMP_USED;
+
+    GenTree* const select = gtNewConditionalNode(GT_SELECT, cond, trueValue, falseValue, type);
+    store->AsOp()->gtOp2  = select;
+    store->gtFlags |= (select->gtFlags & GTF_ALL_EFFECT);
+
+    jtrueStmt->SetRootNode(store);
+    gtSetStmtInfo(jtrueStmt);
+    fgSetStmtSeq(jtrueStmt);
+
+    // Fix up the flow: the block now always falls into falseBlock, which is kept
+    // (emptied) if it was a middle block, while a trueBlock middle is removed.
+    fgRemoveRefPred(trueBlock, block);
+    block->bbJumpKind = BBJ_NONE;
+#ifdef DEBUG
+    block->bbJumpDest = nullptr;
+#endif
+
+    if (falseStore != nullptr)
+    {
+        // falseBlock is a middle block.
+        fgRemoveStmt(falseBlock, falseBlock->firstStmt());
+        falseBlock->inheritWeight(block);
+    }
+
+    if (trueStore != nullptr)
+    {
+        // trueBlock is a middle block, it is now unreachable.
+        assert(trueBlock->bbRefs == 0);
+        fgRemoveStmt(trueBlock, trueBlock->firstStmt());
+        fgRemoveBlock(trueBlock, /* unreachable */ true);
+    }
+
+    DISPSTMT(jtrueStmt);
+
+    return true;
+}
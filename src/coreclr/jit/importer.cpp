@@ -12644,13 +12644,13 @@ void Compiler::impImportBlockCode(BasicBlock* block)
         //
         assert(!compIsForInlining());
 
-        // OSR is not yet supported for methods with explicit tail calls.
+        // Methods with explicit tail calls are only jitted at Tier0 when instrumenting (otherwise they
+        // are switched to optimized code), and then they need patchpoints so that they don't stay in
+        // instrumented loops. OSR methods handle tail calls: fast tail calls pop the original method
+        // frame along with their own, and the tail call helpers find the return address of the
+        // original method (which the OSR method inherits) through the frame's return address slot.
         //
-        // But we also do not have to switch these methods to be optimized, as we should be
-        // able to avoid getting trapped in Tier0 code by normal call counting.
-        // So instead, just suppress adding patchpoints.
-        //
-        if (!compTailPrefixSeen)
+        if (!compTailPrefixSeen || opts.jitFlags->IsSet(JitFlags::JIT_FLAG_BBINSTR))
         {
             // We only need to add patchpoints if the method can loop.
             //
@@ -12853,6 +12853,9 @@ void Compiler::impImportBlockCode(BasicBlock* block)
     // to unconditionally throw, there's not as much to be gained by deferring jitting.
     // For now, we just screen out the entry bb.
     //
+    // If there is profile data for the method (say static PGO), blocks it never saw
+    // executed are rare as well, so they are deferred too.
+    //
     // In general we might want track all the IL stack empty points so we can
     // propagate rareness back through flow and place the partial compilation patchpoints "earlier"
     // so there are fewer overall.
@@ -20155,6 +20158,7 @@ void Compiler::impCheckCanInline(GenTreeCall*           call,
                 pInfo->guardedMethodUnboxedEntryHandle = nullptr;
                 pInfo->likelihood                      = 0;
                 pInfo->requiresInstMethodTableArg      = false;
+                pInfo->guardedNextCandidate            = nullptr;
             }
 
             pInfo->methInfo                       = methInfo;
@@ -21123,10 +21127,42 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
     // Do the actual evaluation
     impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo, ilOffset);
 
-    // If this call is an inline candidate or is not a guarded devirtualization
-    // candidate, we're done.
-    if (call->IsInlineCandidate() || !call->IsGuardedDevirtualizationCandidate())
+    // If this call is not a guarded devirtualization candidate, we're done.
+    if (!call->IsGuardedDevirtualizationCandidate())
+    {
+        return;
+    }
+
+    if (call->IsInlineCandidate())
     {
+        // Evaluate the methods for the classes guessed after the first one
+        // too. As for the first guess, we only keep guesses whose method can
+        // be inlined, and drop the rest of the chain at the first one that
+        // can't.
+        //
+        InlineCandidateInfo* const firstInfo = call->gtInlineCandidateInfo;
+        InlineCandidateInfo*       prevInfo  = firstInfo;
+
+        while (prevInfo->guardedNextCandidate != nullptr)
+        {
+            call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
+            call->gtInlineCandidateInfo = prevInfo->guardedNextCandidate;
+
+            impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo, ilOffset);
+
+            if (!call->IsInlineCandidate())
+            {
+                JITDUMP("Dropping guesses after class %s for call [%06u]: target method can't be inlined\n",
+                        eeGetClassName(prevInfo->guardedClassHandle), dspTreeID(call));
+                prevInfo->guardedNextCandidate = nullptr;
+                break;
+            }
+
+            prevInfo = call->gtInlineCandidateInfo;
+        }
+
+        call->gtFlags |= GTF_CALL_INLINE_CANDIDATE;
+        call->gtInlineCandidateInfo = firstInfo;
         return;
     }
 
@@ -22515,23 +22551,28 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
 // pickGDV: Use profile information to pick a GDV candidate for a call site.
 //
 // Arguments:
-//    call        - the call
-//    ilOffset    - exact IL offset of the call
-//    isInterface - whether or not the call target is defined on an interface
-//    classGuess  - [out] the class to guess for (mutually exclusive with methodGuess)
-//    methodGuess - [out] the method to guess for (mutually exclusive with classGuess)
-//    likelihood  - [out] an estimate of the likelihood that the guess will succeed
+//    call            - the call
+//    ilOffset        - exact IL offset of the call
+//    isInterface     - whether or not the call target is defined on an interface
+//    classGuesses    - [out] the classes to guess for (mutually exclusive with methodGuesses)
+//    methodGuesses   - [out] the methods to guess for (mutually exclusive with classGuesses)
+//    likelihoods     - [out] estimates of the likelihood that each guess will succeed
+//    candidatesCount - [out] the number of guesses, at most MAX_GDV_TYPE_CHECKS
+//
+// Notes:
+//    Guesses are ordered by decreasing likelihood. More than one guess is
+//    only made for classes, when JitGuardedDevirtualizationMaxTypeChecks
+//    allows it and the less likely classes are still above the threshold.
 //
 void Compiler::pickGDV(GenTreeCall*           call,
                        IL_OFFSET              ilOffset,
                        bool                   isInterface,
-                       CORINFO_CLASS_HANDLE*  classGuess,
-                       CORINFO_METHOD_HANDLE* methodGuess,
-                       unsigned*              likelihood)
+                       CORINFO_CLASS_HANDLE*  classGuesses,
+                       CORINFO_METHOD_HANDLE* methodGuesses,
+                       unsigned*              likelihoods,
+                       unsigned*              candidatesCount)
 {
-    *classGuess  = NO_CLASS_HANDLE;
-    *methodGuess = NO_METHOD_HANDLE;
-    *likelihood  = 0;
+    *candidatesCount = 0;
 
     const int               maxLikelyClasses = 32;
     LikelyClassMethodRecord likelyClasses[maxLikelyClasses];
@@ -22633,16 +22674,21 @@ void Compiler::pickGDV(GenTreeCall*           call,
         unsigned index = static_cast<unsigned>(random->Next(static_cast<int>(numberOfClasses + numberOfMethods)));
         if (index < numberOfClasses)
         {
-            *classGuess = (CORINFO_CLASS_HANDLE)likelyClasses[index].handle;
-            *likelihood = 100;
-            JITDUMP("Picked random class for GDV: %p (%s)\n", *classGuess, eeGetClassName(*classGuess));
+            classGuesses[0]  = (CORINFO_CLASS_HANDLE)likelyClasses[index].handle;
+            methodGuesses[0] = NO_METHOD_HANDLE;
+            likelihoods[0]   = 100;
+            *candidatesCount = 1;
+            JITDUMP("Picked random class for GDV: %p (%s)\n", classGuesses[0], eeGetClassName(classGuesses[0]));
             return;
         }
         else
         {
-            *methodGuess = (CORINFO_METHOD_HANDLE)likelyMethods[index - numberOfClasses].handle;
-            *likelihood  = 100;
-            JITDUMP("Picked random method for GDV: %p (%s)\n", *methodGuess, eeGetMethodFullName(*methodGuess));
+            classGuesses[0]  = NO_CLASS_HANDLE;
+            methodGuesses[0] = (CORINFO_METHOD_HANDLE)likelyMethods[index - numberOfClasses].handle;
+            likelihoods[0]   = 100;
+            *candidatesCount = 1;
+            JITDUMP("Picked random method for GDV: %p (%s)\n", methodGuesses[0],
+                    eeGetMethodFullName(methodGuesses[0]));
             return;
         }
     }
@@ -22654,8 +22700,22 @@ void Compiler::pickGDV(GenTreeCall*           call,
         unsigned likelihoodThreshold = isInterface ? 25 : 30;
         if (likelyClasses[0].likelihood >= likelihoodThreshold)
         {
-            *classGuess = (CORINFO_CLASS_HANDLE)likelyClasses[0].handle;
-            *likelihood = likelyClasses[0].likelihood;
+            const unsigned maxTypeChecks =
+                min(max((unsigned)JitConfig.JitGuardedDevirtualizationMaxTypeChecks(), 1u), MAX_GDV_TYPE_CHECKS);
+
+            for (unsigned i = 0; (i < numberOfClasses) && (i < maxTypeChecks); i++)
+            {
+                if (likelyClasses[i].likelihood < likelihoodThreshold)
+                {
+                    break;
+                }
+
+                classGuesses[i]  = (CORINFO_CLASS_HANDLE)likelyClasses[i].handle;
+                methodGuesses[i] = NO_METHOD_HANDLE;
+                likelihoods[i]   = likelyClasses[i].likelihood;
+                (*candidatesCount)++;
+            }
+
             return;
         }
 
@@ -22668,8 +22728,10 @@ void Compiler::pickGDV(GenTreeCall*           call,
         unsigned likelihoodThreshold = 30;
         if (likelyMethods[0].likelihood >= likelihoodThreshold)
         {
-            *methodGuess = (CORINFO_METHOD_HANDLE)likelyMethods[0].handle;
-            *likelihood  = likelyMethods[0].likelihood;
+            classGuesses[0]  = NO_CLASS_HANDLE;
+            methodGuesses[0] = (CORINFO_METHOD_HANDLE)likelyMethods[0].handle;
+            likelihoods[0]   = likelyMethods[0].likelihood;
+            *candidatesCount = 1;
             return;
         }
 
@@ -22702,6 +22764,10 @@ bool Compiler::isCompatibleMethodGDV(GenTreeCall* call, CORINFO_METHOD_HANDLE gd
     CORINFO_SIG_INFO sig;
     info.compCompHnd->getMethodSig(gdvTarget, &sig);
 
+    // A delegate closed over the first argument of a static method passes
+    // that argument as 'this' of the Invoke call.
+    const bool isClosedStatic = call->IsDelegateInvoke() && !sig.hasThis();
+
     CORINFO_ARG_LIST_HANDLE sigParam  = sig.args;
     unsigned                numParams = sig.numArgs;
     unsigned                numArgs   = 0;
@@ -22709,8 +22775,26 @@ bool Compiler::isCompatibleMethodGDV(GenTreeCall* call, CORINFO_METHOD_HANDLE gd
     {
         switch (arg.GetWellKnownArg())
         {
-            case WellKnownArg::RetBuffer:
             case WellKnownArg::ThisPointer:
+                if (isClosedStatic)
+                {
+                    // The delegate object stands in for the bound first argument,
+                    // which is always an object reference.
+                    CORINFO_CLASS_HANDLE classHnd = NO_CLASS_HANDLE;
+                    if ((numParams == 0) ||
+                        (JITtype2varType(strip(info.compCompHnd->getArgType(&sig, sigParam, &classHnd))) != TYP_REF))
+                    {
+                        JITDUMP("Incompatible method GDV: static target of call [%06u] does not take an object "
+                                "reference as its first parameter\n",
+                                dspTreeID(call));
+                        return false;
+                    }
+
+                    numArgs++;
+                    sigParam = info.compCompHnd->getArgNext(sigParam);
+                }
+                continue;
+            case WellKnownArg::RetBuffer:
                 // Not part of signature but we still expect to see it here
                 continue;
             case WellKnownArg::None:
@@ -22800,16 +22884,62 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
         return;
     }
 
-    CORINFO_CLASS_HANDLE  likelyClass;
-    CORINFO_METHOD_HANDLE likelyMethod;
-    unsigned              likelihood;
-    pickGDV(call, ilOffset, isInterface, &likelyClass, &likelyMethod, &likelihood);
+    CORINFO_CLASS_HANDLE  likelyClasses[MAX_GDV_TYPE_CHECKS];
+    CORINFO_METHOD_HANDLE likelyMethods[MAX_GDV_TYPE_CHECKS];
+    unsigned              likelihoods[MAX_GDV_TYPE_CHECKS];
+    unsigned              candidatesCount;
+    pickGDV(call, ilOffset, isInterface, likelyClasses, likelyMethods, likelihoods, &candidatesCount);
+
+    // Each guess after the first one is only tested when the previous ones
+    // failed, so its likelihood is scaled to the remaining odds.
+    //
+    unsigned remainingLikelihood = 100;
 
-    if ((likelyClass == NO_CLASS_HANDLE) && (likelyMethod == NO_METHOD_HANDLE))
+    for (unsigned candidateId = 0; candidateId < candidatesCount; candidateId++)
     {
-        return;
+        CORINFO_CLASS_HANDLE  likelyClass  = likelyClasses[candidateId];
+        CORINFO_METHOD_HANDLE likelyMethod = likelyMethods[candidateId];
+        unsigned const        likelihood   = min(likelihoods[candidateId] * 100 / max(remainingLikelihood, 1u), 100u);
+
+        remainingLikelihood -= min(likelihoods[candidateId], remainingLikelihood);
+
+        // Later guesses can only be chained to a guess that was accepted.
+        //
+        if ((candidateId > 0) && !call->IsGuardedDevirtualizationCandidate())
+        {
+            return;
+        }
+
+        considerGuardedDevirtualizationCandidate(call, isInterface, baseMethod, pContextHandle, likelyClass,
+                                                 likelyMethod, likelihood);
     }
+}
 
+//------------------------------------------------------------------------
+// considerGuardedDevirtualizationCandidate: check one of the guesses picked
+//    for a call and record it as a guarded devirtualization candidate.
+//
+// Arguments:
+//    call - potential guarded devirtualization candidate
+//    isInterface - whether or not the call target is defined on an interface
+//    baseMethod - target method of the call
+//    pContextHandle - context handle for the call
+//    likelyClass - class to guess for (mutually exclusive with likelyMethod)
+//    likelyMethod - method to guess for (mutually exclusive with likelyClass)
+//    likelihood - odds that the guess succeeds when it is tested
+//
+// Notes:
+//    Guesses for a call that is already a candidate are chained after its
+//    existing guesses.
+//
+void Compiler::considerGuardedDevirtualizationCandidate(GenTreeCall*            call,
+                                                        bool                    isInterface,
+                                                        CORINFO_METHOD_HANDLE   baseMethod,
+                                                        CORINFO_CONTEXT_HANDLE* pContextHandle,
+                                                        CORINFO_CLASS_HANDLE    likelyClass,
+                                                        CORINFO_METHOD_HANDLE   likelyMethod,
+                                                        unsigned                likelihood)
+{
     uint32_t likelyClassAttribs = 0;
     if (likelyClass != NO_CLASS_HANDLE)
     {
@@ -22850,27 +22980,22 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     {
         // For method GDV do a few more checks that we get for free in the
         // resolve call above for class-based GDV.
-        if ((likelyMethodAttribs & CORINFO_FLG_STATIC) != 0)
-        {
-            assert(call->IsDelegateInvoke());
-            JITDUMP("Cannot currently handle devirtualizing static delegate calls, sorry\n");
-            return;
-        }
-
-        // Verify that the call target and args look reasonable so that the JIT
-        // does not blow up during inlining/call morphing.
         //
-        // NOTE: Once we want to support devirtualization of delegate calls to
-        // static methods and remove the check above we will start failing here
-        // for delegates pointing to static methods that have the first arg
-        // bound. For example:
+        // A static target can only be profiled for a delegate that is closed
+        // over its first argument (possibly null), for example:
         //
         // public static void E(this C c) ...
         // Action a = new C().E;
         //
         // The delegate instance looks exactly like one pointing to an instance
-        // method in this case and the call will have zero args while the
-        // signature has 1 arg.
+        // method, with the bound first argument stored as the delegate target,
+        // so the devirtualized call will pass that in place of 'this'. Open
+        // static delegates go through a shuffle thunk and are never recorded.
+        //
+        assert(((likelyMethodAttribs & CORINFO_FLG_STATIC) == 0) || call->IsDelegateInvoke());
+
+        // Verify that the call target and args look reasonable so that the JIT
+        // does not blow up during inlining/call morphing.
         //
         if (!isCompatibleMethodGDV(call, likelyMethod))
         {
@@ -22967,18 +23092,32 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
 
 #endif
 
-    // We're all set, proceed with candidate creation.
+    // A call that is already a candidate gets this guess chained after its
+    // existing ones, to be tested when they fail.
     //
-    JITDUMP("Marking call [%06u] as guarded devirtualization candidate; will guess for %s %s\n", dspTreeID(call),
-            classHandle != NO_CLASS_HANDLE ? "class" : "method",
-            classHandle != NO_CLASS_HANDLE ? eeGetClassName(classHandle) : eeGetMethodFullName(methodHandle));
-    setMethodHasGuardedDevirtualization();
-    call->SetGuardedDevirtualizationCandidate();
+    const bool isChainedGuess = call->IsGuardedDevirtualizationCandidate();
 
-    // Spill off any GT_RET_EXPR subtrees so we can clone the call.
-    //
-    SpillRetExprHelper helper(this);
-    helper.StoreRetExprResultsInArgs(call);
+    if (isChainedGuess)
+    {
+        assert(classHandle != NO_CLASS_HANDLE);
+        JITDUMP("Chaining guess for class %s to guarded devirtualization candidate [%06u]\n",
+                eeGetClassName(classHandle), dspTreeID(call));
+    }
+    else
+    {
+        // We're all set, proceed with candidate creation.
+        //
+        JITDUMP("Marking call [%06u] as guarded devirtualization candidate; will guess for %s %s\n", dspTreeID(call),
+                classHandle != NO_CLASS_HANDLE ? "class" : "method",
+                classHandle != NO_CLASS_HANDLE ? eeGetClassName(classHandle) : eeGetMethodFullName(methodHandle));
+        setMethodHasGuardedDevirtualization();
+        call->SetGuardedDevirtualizationCandidate();
+
+        // Spill off any GT_RET_EXPR subtrees so we can clone the call.
+        //
+        SpillRetExprHelper helper(this);
+        helper.StoreRetExprResultsInArgs(call);
+    }
 
     // Gather some information for later. Note we actually allocate InlineCandidateInfo
     // here, as the devirtualized half of this call will likely become an inline candidate.
@@ -22990,6 +23129,7 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
     pInfo->guardedClassHandle              = classHandle;
     pInfo->likelihood                      = likelihood;
     pInfo->requiresInstMethodTableArg      = false;
+    pInfo->guardedNextCandidate            = nullptr;
 
     // If the guarded class is a value class, look for an unboxed entry point.
     //
@@ -23008,7 +23148,20 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
         }
     }
 
-    call->gtGuardedDevirtualizationCandidateInfo = pInfo;
+    if (isChainedGuess)
+    {
+        GuardedDevirtualizationCandidateInfo* lastInfo = call->gtGuardedDevirtualizationCandidateInfo;
+        while (lastInfo->guardedNextCandidate != nullptr)
+        {
+            lastInfo = lastInfo->guardedNextCandidate;
+        }
+
+        lastInfo->guardedNextCandidate = static_cast<InlineCandidateInfo*>(pInfo);
+    }
+    else
+    {
+        call->gtGuardedDevirtualizationCandidateInfo = pInfo;
+    }
 }
 
 void Compiler::addExpRuntimeLookupCandidate(GenTreeCall* call)
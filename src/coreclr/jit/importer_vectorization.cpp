@@ -6,8 +6,11 @@
 #pragma hdrstop
 #endif
 
-// For now the max possible size is Vector256<ushort>.Count * 2
-#define MaxPossibleUnrollSize 32
+// For now the max possible size is Vector256<ushort>.Count * 4
+#define MaxPossibleUnrollSize 64
+
+// Max number of vectors used to compare against a constant
+#define MaxUnrollVectorCount 4
 
 //------------------------------------------------------------------------
 // importer_vectorization.cpp
@@ -25,8 +28,8 @@
 //   8) MemoryExtensions.StartsWith<char>(ROS<char>, ROS<char>)
 //   9) MemoryExtensions.StartsWith(ROS<char>, ROS<char>, Ordinal or OrdinalIgnoreCase)
 //
-// When one of the arguments is a constant string of a [0..32] size so we can inline
-// a vectorized comparison against it using SWAR or SIMD techniques (e.g. via two V256 vectors)
+// When one of the arguments is a constant string of a [0..64] size so we can inline
+// a vectorized comparison against it using SWAR or SIMD techniques (e.g. via up to four V256 vectors)
 //
 
 //------------------------------------------------------------------------
@@ -113,7 +116,7 @@ static GenTreeHWIntrinsic* CreateConstVector(Compiler* comp, var_types simdType,
 
 //------------------------------------------------------------------------
 // impExpandHalfConstEqualsSIMD: Attempts to unroll and vectorize
-//    Equals against a constant WCHAR data for Length in [8..32] range
+//    Equals against a constant WCHAR data for Length in [8..64] range
 //    using SIMD instructions. C# equivalent of what this function emits:
 //
 //    bool IsTestString(ReadOnlySpan<char> span)
@@ -130,6 +133,9 @@ static GenTreeHWIntrinsic* CreateConstVector(Compiler* comp, var_types simdType,
 //        // return span.SequenceEqual("TestString");
 //    }
 //
+//    Longer constants are handled the same way, using up to MaxUnrollVectorCount vectors
+//    where only the last one may overlap with the previous one.
+//
 // Arguments:
 //    data       - Pointer to a data to vectorize
 //    cns        - Constant data (array of 2-byte chars)
@@ -158,19 +164,10 @@ GenTree* Compiler::impExpandHalfConstEqualsSIMD(
 
     CorInfoType baseType = CORINFO_TYPE_ULONG;
 
-    int       simdSize;
-    var_types simdType;
-
+    int            simdSize;
+    var_types      simdType;
     NamedIntrinsic niEquals;
 
-    GenTree* cnsVec1     = nullptr;
-    GenTree* cnsVec2     = nullptr;
-    GenTree* toLowerVec1 = nullptr;
-    GenTree* toLowerVec2 = nullptr;
-
-    // Optimization: don't use two vectors for Length == 8 or 16
-    bool useSingleVector = false;
-
     WCHAR cnsValue[MaxPossibleUnrollSize]    = {};
     WCHAR toLowerMask[MaxPossibleUnrollSize] = {};
 
@@ -185,68 +182,32 @@ GenTree* Compiler::impExpandHalfConstEqualsSIMD(
 #if defined(TARGET_XARCH)
     if (compOpportunisticallyDependsOn(InstructionSet_Vector256) && len >= 16)
     {
-        // Handle [16..32] inputs via two Vector256
-        assert(len >= 16 && len <= 32);
-
+        // Handle [16..64] inputs via Vector256
         simdSize = 32;
         simdType = TYP_SIMD32;
-
         niEquals = NI_Vector256_op_Equality;
-
-        // Special case: use a single vector for Length == 16
-        useSingleVector = len == 16;
-
-        cnsVec1 = CreateConstVector(this, simdType, cnsValue);
-        cnsVec2 = CreateConstVector(this, simdType, cnsValue + len - 16);
-
-        if (cmpMode == OrdinalIgnoreCase)
-        {
-            toLowerVec1 = CreateConstVector(this, simdType, toLowerMask);
-            toLowerVec2 = CreateConstVector(this, simdType, toLowerMask + len - 16);
-        }
     }
     else
 #endif // TARGET_XARCH
-        if (len <= 16)
     {
-        // Handle [8..16] inputs via two Vector128
-        assert(len >= 8 && len <= 16);
-
+        // Handle [8..32] inputs via Vector128
         simdSize = 16;
         simdType = TYP_SIMD16;
-
         niEquals = NI_Vector128_op_Equality;
+    }
 
-        // Special case: use a single vector for Length == 8
-        useSingleVector = len == 8;
-
-        cnsVec1 = CreateConstVector(this, simdType, cnsValue);
-        cnsVec2 = CreateConstVector(this, simdType, cnsValue + len - 8);
+    // Number of chars per vector and number of vectors needed to cover the whole constant
+    const int charsPerVector = simdSize / (int)sizeof(WCHAR);
+    const int vectorCount    = (len + charsPerVector - 1) / charsPerVector;
 
-        if (cmpMode == OrdinalIgnoreCase)
-        {
-            toLowerVec1 = CreateConstVector(this, simdType, toLowerMask);
-            toLowerVec2 = CreateConstVector(this, simdType, toLowerMask + len - 8);
-        }
-    }
-    else
+    if (vectorCount > MaxUnrollVectorCount)
     {
-        JITDUMP("impExpandHalfConstEqualsSIMD: No V256 support and data is too big for V128\n");
-        // NOTE: We might consider using four V128 for ARM64
+        JITDUMP("impExpandHalfConstEqualsSIMD: data is too big to be compared with %d vectors\n",
+                MaxUnrollVectorCount);
         return nullptr;
     }
 
-    GenTree* zero = gtNewZeroConNode(simdType, baseType);
-
-    GenTree* offset1  = gtNewIconNode(dataOffset, TYP_I_IMPL);
-    GenTree* offset2  = gtNewIconNode(dataOffset + len * sizeof(USHORT) - simdSize, TYP_I_IMPL);
-    GenTree* dataPtr1 = gtNewOperNode(GT_ADD, TYP_BYREF, data, offset1);
-    GenTree* dataPtr2 = gtNewOperNode(GT_ADD, TYP_BYREF, gtClone(data), offset2);
-
-    GenTree* vec1 = gtNewIndir(simdType, dataPtr1);
-    GenTree* vec2 = gtNewIndir(simdType, dataPtr2);
-
-    // TODO-Unroll-CQ: Spill vec1 and vec2 for better pipelining, currently we end up emitting:
+    // TODO-Unroll-CQ: Spill the loaded vectors for better pipelining, currently we end up emitting:
     //
     //   vmovdqu  xmm0, xmmword ptr [rcx+12]
     //   vpxor    xmm0, xmm0, xmmword ptr[reloc @RWD00]
@@ -260,20 +221,34 @@ GenTree* Compiler::impExpandHalfConstEqualsSIMD(
     //   vpxor    xmm0, xmm0, xmmword ptr[reloc @RWD00]
     //   vpxor    xmm1, xmm1, xmmword ptr[reloc @RWD16]
     //
-
-    if (cmpMode == OrdinalIgnoreCase)
+    GenTree* result = nullptr;
+    for (int i = 0; i < vectorCount; i++)
     {
-        // Apply ASCII-only ToLowerCase mask (bitwise OR 0x20 for all a-Z chars)
-        assert((toLowerVec1 != nullptr) && (toLowerVec2 != nullptr));
-        vec1 = gtNewSimdBinOpNode(GT_OR, simdType, vec1, toLowerVec1, baseType, simdSize, false);
-        vec2 = gtNewSimdBinOpNode(GT_OR, simdType, vec2, toLowerVec2, baseType, simdSize, false);
+        // All vectors but the last one are consecutive, the last one is aligned to the end of the
+        // data and may overlap with the previous one (or with the first one for Length in (N..2N)).
+        const int charOffset = (i == vectorCount - 1) ? (len - charsPerVector) : (i * charsPerVector);
+
+        GenTree* dataClone = (i == 0) ? data : gtClone(data);
+        GenTree* offset    = gtNewIconNode(dataOffset + charOffset * (int)sizeof(WCHAR), TYP_I_IMPL);
+        GenTree* vec       = gtNewIndir(simdType, gtNewOperNode(GT_ADD, TYP_BYREF, dataClone, offset));
+
+        if (cmpMode == OrdinalIgnoreCase)
+        {
+            // Apply ASCII-only ToLowerCase mask (bitwise OR 0x20 for all a-Z chars)
+            GenTree* toLowerVec = CreateConstVector(this, simdType, toLowerMask + charOffset);
+            vec                 = gtNewSimdBinOpNode(GT_OR, simdType, vec, toLowerVec, baseType, simdSize, false);
+        }
+
+        // ((v1 ^ cns1) | (v2 ^ cns2) | ...) == zero
+        GenTree* cnsVec = CreateConstVector(this, simdType, cnsValue + charOffset);
+        GenTree* xorVec = gtNewSimdBinOpNode(GT_XOR, simdType, vec, cnsVec, baseType, simdSize, false);
+
+        result = (result == nullptr) ? xorVec
+                                     : gtNewSimdBinOpNode(GT_OR, simdType, result, xorVec, baseType, simdSize, false);
     }
 
-    // ((v1 ^ cns1) | (v2 ^ cns2)) == zero
-    GenTree* xor1 = gtNewSimdBinOpNode(GT_XOR, simdType, vec1, cnsVec1, baseType, simdSize, false);
-    GenTree* xor2 = gtNewSimdBinOpNode(GT_XOR, simdType, vec2, cnsVec2, baseType, simdSize, false);
-    GenTree* orr  = gtNewSimdBinOpNode(GT_OR, simdType, xor1, xor2, baseType, simdSize, false);
-    return gtNewSimdHWIntrinsicNode(TYP_BOOL, useSingleVector ? xor1 : orr, zero, niEquals, baseType, simdSize);
+    GenTree* zero = gtNewZeroConNode(simdType, baseType);
+    return gtNewSimdHWIntrinsicNode(TYP_BOOL, result, zero, niEquals, baseType, simdSize);
 }
 #endif // defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT)
 
@@ -452,7 +427,7 @@ GenTree* Compiler::impExpandHalfConstEqualsSWAR(
 
 //------------------------------------------------------------------------
 // impExpandHalfConstEquals: Attempts to unroll and vectorize
-//    Equals against a constant WCHAR data for Length in [8..32] range
+//    Equals against a constant WCHAR data for Length in [0..64] range
 //    using either SWAR or SIMD. In a general case it will look like this:
 //
 //    bool equals = obj != null && obj.Length == len && (SWAR or SIMD)
@@ -510,7 +485,7 @@ GenTree* Compiler::impExpandHalfConstEquals(GenTreeLclVar*   data,
             indirCmp = impExpandHalfConstEqualsSWAR(gtClone(data)->AsLclVar(), cnsData, len, dataOffset, cmpMode);
         }
 #if defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT)
-        else if (len <= 32)
+        else if (len <= MaxPossibleUnrollSize)
         {
             indirCmp = impExpandHalfConstEqualsSIMD(gtClone(data)->AsLclVar(), cnsData, len, dataOffset, cmpMode);
         }
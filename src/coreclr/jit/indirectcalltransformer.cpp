@@ -729,12 +729,18 @@ private:
                     compiler->lvaSetStruct(returnTemp, origCall->gtRetClsHnd, false);
                 }
 
-                GenTree* tempTree = compiler->gtNewLclvNode(returnTemp, origCall->TypeGet());
+                // The residual call of a previous guess has no GT_RET_EXPR; its result
+                // already goes to the return temp of that guess.
+                //
+                if (retExpr != nullptr)
+                {
+                    GenTree* tempTree = compiler->gtNewLclvNode(returnTemp, origCall->TypeGet());
 
-                JITDUMP("Bashing GT_RET_EXPR [%06u] to refer to temp V%02u\n", compiler->dspTreeID(retExpr),
-                        returnTemp);
+                    JITDUMP("Bashing GT_RET_EXPR [%06u] to refer to temp V%02u\n", compiler->dspTreeID(retExpr),
+                            returnTemp);
 
-                retExpr->ReplaceWith(tempTree, compiler);
+                    retExpr->ReplaceWith(tempTree, compiler);
+                }
             }
             else if (retExpr != nullptr)
             {
@@ -765,6 +771,13 @@ private:
             InlineCandidateInfo* inlineInfo = origCall->gtInlineCandidateInfo;
             CORINFO_CLASS_HANDLE clsHnd     = inlineInfo->guardedClassHandle;
 
+            // A delegate closed over the first argument of a static method
+            // stores that argument where an instance delegate stores 'this'.
+            const bool isClosedStatic =
+                origCall->IsDelegateInvoke() &&
+                ((compiler->info.compCompHnd->getMethodAttribs(inlineInfo->guardedMethodHandle) & CORINFO_FLG_STATIC) !=
+                 0);
+
             //
             // Copy the 'this' for the devirtualized call to a new temp. For
             // class-based GDV this will allow us to set the exact type on that
@@ -791,7 +804,7 @@ private:
             {
                 compiler->lvaSetClass(thisTemp, clsHnd, true);
             }
-            else
+            else if (!isClosedStatic)
             {
                 compiler->lvaSetClass(thisTemp,
                                       compiler->info.compCompHnd->getMethodClass(inlineInfo->guardedMethodHandle));
@@ -832,6 +845,25 @@ private:
                 // TODO-GDV: To support R2R we need to get the entry point
                 // here. We should unify with the tail of impDevirtualizeCall.
 
+                if (isClosedStatic)
+                {
+                    // The bound first argument becomes an ordinary argument
+                    // of the static method, ahead of the others.
+                    CallArg* const thisArg   = call->gtArgs.GetThisArg();
+                    GenTree* const firstArg  = thisArg->GetEarlyNode();
+                    CallArg* const retBufArg = call->gtArgs.GetRetBufferArg();
+                    call->gtArgs.Remove(thisArg);
+
+                    if (retBufArg != nullptr)
+                    {
+                        call->gtArgs.InsertAfter(compiler, retBufArg, NewCallArg::Primitive(firstArg));
+                    }
+                    else
+                    {
+                        call->gtArgs.PushFront(compiler, NewCallArg::Primitive(firstArg));
+                    }
+                }
+
                 if (origCall->IsVirtual())
                 {
                     // Virtual calls include an implicit null check, which we may
@@ -892,12 +924,13 @@ private:
                 inlineInfo->preexistingSpillTemp = returnTemp;
                 call->gtInlineCandidateInfo      = inlineInfo;
 
-                // If there was a ret expr for this call, we need to create a new one
-                // and append it just after the call.
+                // If there was a ret expr for this call, or the call returns a value
+                // via a temp, we need to create a new one and append it just after
+                // the call.
                 //
                 // Note the original GT_RET_EXPR has been bashed to a temp.
                 // we set all this up in FixupRetExpr().
-                if (oldRetExpr != nullptr)
+                if ((oldRetExpr != nullptr) || (returnTemp != BAD_VAR_NUM))
                 {
                     GenTree* retExpr =
                         compiler->gtNewInlineCandidateReturnExpr(call, call->TypeGet(), thenBlock->bbFlags);
@@ -927,11 +960,38 @@ private:
             GenTreeCall* call    = origCall;
             Statement*   newStmt = compiler->gtNewStmt(call, stmt->GetDebugInfo());
 
-            call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
             call->SetIsGuarded();
 
             JITDUMP("Residual call [%06u] moved to block " FMT_BB "\n", compiler->dspTreeID(call), elseBlock->bbNum);
 
+            // If there is another class to guess for, the residual call stays a
+            // candidate for it, and gets expanded in turn when we reach the else
+            // block. Its result goes to the same return temp.
+            //
+            InlineCandidateInfo* const nextInfo = origCall->gtInlineCandidateInfo->guardedNextCandidate;
+
+            if (nextInfo != nullptr)
+            {
+                assert(m_targetLclNum == BAD_VAR_NUM);
+                JITDUMP("Residual call [%06u] will guess for class %s next\n", compiler->dspTreeID(call),
+                        compiler->eeGetClassName(nextInfo->guardedClassHandle));
+
+                nextInfo->retExpr              = nullptr;
+                nextInfo->preexistingSpillTemp = returnTemp;
+                call->gtInlineCandidateInfo    = nextInfo;
+                call->gtCallMoreFlags &= ~GTF_CALL_M_GUARDED_DEVIRT_CHAIN;
+                call->SetGuardedDevirtualizationCandidate();
+
+                compiler->fgInsertStmtAtEnd(elseBlock, newStmt);
+
+                // Set the original statement to a nop.
+                //
+                stmt->SetRootNode(compiler->gtNewNothingNode());
+                return;
+            }
+
+            call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
+
             if (returnTemp != BAD_VAR_NUM)
             {
                 GenTree* assign = compiler->gtNewTempAssign(returnTemp, call);
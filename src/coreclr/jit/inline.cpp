@@ -833,6 +833,7 @@ InlineStrategy::InlineStrategy(Compiler* compiler)
     , m_UnprofitableCandidateCount(0)
     , m_ImportCount(0)
     , m_InlineCount(0)
+    , m_ProfileDrivenILSize(0)
     , m_MaxInlineSize(DEFAULT_MAX_INLINE_SIZE)
     , m_MaxInlineDepth(DEFAULT_MAX_INLINE_DEPTH)
     , m_InitialTimeBudget(0)
@@ -1120,6 +1121,12 @@ void InlineStrategy::NoteOutcome(InlineContext* context)
     {
         m_InlineCount++;
 
+        if ((context->GetObservation() == InlineObservation::CALLSITE_IS_PROFITABLE_INLINE) &&
+            (context->GetILSize() > static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxIL())))
+        {
+            m_ProfileDrivenILSize += context->GetILSize();
+        }
+
 #if defined(DEBUG) || defined(INLINE_DATA)
 
         // Keep track of the inline targeted for data collection or,
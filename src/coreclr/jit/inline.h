@@ -586,9 +586,15 @@ struct HandleHistogramProfileCandidateInfo
     unsigned  probeIndex;
 };
 
+struct InlineCandidateInfo;
+
 // GuardedDevirtualizationCandidateInfo provides information about
 // a potential target of a virtual or interface call.
 //
+// Calls with more than one likely class chain the guesses via
+// guardedNextCandidate, in order of decreasing likelihood. The likelihood
+// of a chained guess is the one it has when the previous guesses failed.
+//
 struct GuardedDevirtualizationCandidateInfo : HandleHistogramProfileCandidateInfo
 {
     CORINFO_CLASS_HANDLE  guardedClassHandle;
@@ -596,6 +602,7 @@ struct GuardedDevirtualizationCandidateInfo : HandleHistogramProfileCandidateInf
     CORINFO_METHOD_HANDLE guardedMethodUnboxedEntryHandle;
     unsigned              likelihood;
     bool                  requiresInstMethodTableArg;
+    InlineCandidateInfo*  guardedNextCandidate;
 };
 
 // InlineCandidateInfo provides basic information about a particular
@@ -938,6 +945,13 @@ public:
         return m_InlineCount;
     }
 
+    // IL size of successful discretionary inlines that were over the
+    // non-profile IL limit, and so were only considered because of PGO.
+    unsigned GetProfileDrivenILSize() const
+    {
+        return m_ProfileDrivenILSize;
+    }
+
     // Return the current code size estimate for this method
     int GetCurrentSizeEstimate() const
     {
@@ -1084,6 +1098,7 @@ private:
     unsigned          m_UnprofitableCandidateCount;
     unsigned          m_ImportCount;
     unsigned          m_InlineCount;
+    unsigned          m_ProfileDrivenILSize;
     unsigned          m_MaxInlineSize;
     unsigned          m_MaxInlineDepth;
     int               m_InitialTimeBudget;
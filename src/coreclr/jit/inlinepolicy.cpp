@@ -1346,7 +1346,8 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             unsigned maxCodeSize = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxIL());
 
             // TODO: Enable for PgoSource::Static as well if it's not the generic profile we bundle.
-            if (m_HasProfile && (m_RootCompiler->fgHaveTrustedProfileData()))
+            const bool hasTrustedProfile = m_HasProfile && (m_RootCompiler->fgHaveTrustedProfileData());
+            if (hasTrustedProfile)
             {
                 maxCodeSize = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxILProf());
             }
@@ -1363,8 +1364,28 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             }
             else if (m_CodeSize <= maxCodeSize)
             {
-                // Candidate, pending profitability evaluation
-                SetCandidate(InlineObservation::CALLEE_IS_DISCRETIONARY_INLINE);
+                // With a profile, the root's inlining so far can rule out a discretionary
+                // inline. Prejit root mode has no call site. The call site's frequency is
+                // only observed later, see NoteDouble.
+                const bool     useProfile = hasTrustedProfile && !m_IsPrejitRoot;
+                const unsigned budget     = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyProfILBudget());
+
+                if (useProfile && (m_CodeSize > static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxIL())) &&
+                    (m_RootCompiler->m_inlineStrategy->GetProfileDrivenILSize() + m_CodeSize > budget))
+                {
+                    // This callee is only a candidate because of the raised limit with profile
+                    // data. Once the root has used its budget for such callees, the remaining
+                    // sites fall back to the regular limit. This bounds the code size and JIT
+                    // time growth of the hottest methods, which see the most large inlinees.
+                    JITDUMP("\nProfile-driven IL budget exceeded: %u + %u > %u\n",
+                            m_RootCompiler->m_inlineStrategy->GetProfileDrivenILSize(), m_CodeSize, budget);
+                    SetFailure(InlineObservation::CALLSITE_OVER_PROFILE_IL_BUDGET);
+                }
+                else
+                {
+                    // Candidate, pending profitability evaluation
+                    SetCandidate(InlineObservation::CALLEE_IS_DISCRETIONARY_INLINE);
+                }
             }
             else
             {
@@ -1404,7 +1425,7 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
 }
 
 //------------------------------------------------------------------------
-// NoteInt: handle an observed double value
+// NoteDouble: handle an observed double value
 //
 // Arguments:
 //    obs      - the current obsevation
@@ -1415,6 +1436,24 @@ void ExtendedDefaultPolicy::NoteDouble(InlineObservation obs, double value)
     // So far, CALLSITE_PROFILE_FREQUENCY is the only "double" property.
     assert(obs == InlineObservation::CALLSITE_PROFILE_FREQUENCY);
     m_ProfileFrequency = value;
+
+    // The frequency is observed after the callee's IL size, once the inline is
+    // known to be a discretionary candidate. Prejit root mode has no call site.
+    if (InlDecisionIsCandidate(m_Decision) && (m_Observation == InlineObservation::CALLEE_IS_DISCRETIONARY_INLINE) &&
+        !m_IsPrejitRoot && m_HasProfile && m_RootCompiler->fgHaveTrustedProfileData())
+    {
+        const double coldFreq = (double)JitConfig.JitExtDefaultPolicyProfColdFreq() / 1000.0;
+
+        if (m_ProfileFrequency < coldFreq)
+        {
+            // The profile says this call site (next to) never runs, so a discretionary
+            // inline would only grow the root. This keeps the cold parts of Tier1 code
+            // with dynamic PGO small, at the cost of a call if the profile turns out
+            // not to be representative.
+            JITDUMP("\nCallsite profile frequency %g is below cold threshold %g\n", m_ProfileFrequency, coldFreq);
+            SetFailure(InlineObservation::CALLSITE_IS_COLD);
+        }
+    }
 }
 
 //------------------------------------------------------------------------
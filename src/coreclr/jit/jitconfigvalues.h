@@ -52,6 +52,10 @@ CONFIG_INTEGER(JitAlignLoopMinBlockWeight,
                W("JitAlignLoopMinBlockWeight"),
                DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT) // Minimum weight needed for the first block of a loop to make it a
                                                     // candidate for alignment.
+CONFIG_INTEGER(JitAlignLoopMinIterCount,
+               W("JitAlignLoopMinIterCount"),
+               DEFAULT_ALIGN_LOOP_MIN_ITER_COUNT) // Minimum average number of iterations per entry, as measured by the
+                                                  // profile data, needed to make a loop a candidate for alignment.
 CONFIG_INTEGER(JitAlignLoopMaxCodeSize,
                W("JitAlignLoopMaxCodeSize"),
                DEFAULT_MAX_LOOPSIZE_FOR_ALIGN) // For non-adaptive alignment, minimum loop size (in bytes) for which
@@ -368,6 +372,12 @@ CONFIG_INTEGER(JitDisableSimdVN, W("JitDisableSimdVN"), 0) // Default 0, ValueNu
 //
 CONFIG_INTEGER(JitConstCSE, W("JitConstCSE"), 0)
 
+// Default 0, use the default CSE heuristic, based on weighted ref count cutoffs.
+// If 1, use the profile driven CSE heuristic for methods with profile data (e.g. Tier1 and OSR with PGO).
+// If 2, use the profile driven CSE heuristic for all methods.
+//
+CONFIG_INTEGER(JitCSEHeuristic, W("JitCSEHeuristic"), 0)
+
 #define CONST_CSE_ENABLE_ARM 0
 #define CONST_CSE_DISABLE_ALL 1
 #define CONST_CSE_ENABLE_ARM_NO_SHARING 2
@@ -418,6 +428,9 @@ CONFIG_INTEGER(JitNoRngChks, W("JitNoRngChks"), 0) // If 1, don't generate range
 CONFIG_INTEGER(JitDoAssertionProp, W("JitDoAssertionProp"), 1) // Perform assertion propagation optimization
 CONFIG_INTEGER(JitDoCopyProp, W("JitDoCopyProp"), 1)   // Perform copy propagation on variables that appear redundant
 CONFIG_INTEGER(JitDoEarlyProp, W("JitDoEarlyProp"), 1) // Perform Early Value Propagation
+// Perform if-conversion to conditional selects: 0 = never, 1 = only for branches profile data shows
+// to be unpredictable, 2 = also for branches outside of loops that have no profile data (for testing)
+CONFIG_INTEGER(JitDoIfConversion, W("JitDoIfConversion"), 1)
 CONFIG_INTEGER(JitDoLoopHoisting, W("JitDoLoopHoisting"), 1)   // Perform loop hoisting on loop invariant values
 CONFIG_INTEGER(JitDoLoopInversion, W("JitDoLoopInversion"), 1) // Perform loop inversion on "for/while" loops
 CONFIG_INTEGER(JitDoRangeAnalysis, W("JitDoRangeAnalysis"), 1) // Perform range check analysis
@@ -500,10 +513,31 @@ CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"), 7)
 CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, W("JitExtDefaultPolicyProfTrust"), 0x7)
 CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"), 0x2A)
 
+// With trusted profile data, discretionary inlines at call sites executed less often than
+// ProfColdFreq / 1000 times per call of the root method are rejected outright, and the IL of
+// inlines larger than MaxIL (only allowed because of the profile) is limited to ProfILBudget
+// bytes per root method. They are checked when the call site's frequency and the callee's IL
+// size are observed, and show up as CALLSITE_IS_COLD and CALLSITE_OVER_PROFILE_IL_BUDGET
+// failures. They make Tier1 code with dynamic PGO smaller and quicker to JIT; the cost is a
+// call in code the profile saw as cold, and in the hottest methods, fewer large inlines beyond
+// the first ProfILBudget bytes.
+// Setting ProfColdFreq to 0 and ProfILBudget to a large value restores the previous behavior.
+CONFIG_INTEGER(JitExtDefaultPolicyProfColdFreq, W("JitExtDefaultPolicyProfColdFreq"), 1)
+CONFIG_INTEGER(JitExtDefaultPolicyProfILBudget, W("JitExtDefaultPolicyProfILBudget"), 0x1000)
+
 CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
 CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 0)
+CONFIG_INTEGER(JitEnablePhysicalPromotion, W("JitEnablePhysicalPromotion"), 0)
+CONFIG_INTEGER(JitVectorizeLoops, W("JitVectorizeLoops"), 0)
+// With profile data, a branch is only converted into a conditional select if its less
+// likely successor is reached at least this percentage of the time.
+CONFIG_INTEGER(JitIfConversionMinLikelihood, W("JitIfConversionMinLikelihood"), 20)
+CONFIG_INTEGER(JitExtTspLayout, W("JitExtTspLayout"), 0)
+// If 1, loops without a call in optimized code also get a GC poll on their back edges, so that threads
+// running them reach a safe point without being interrupted.
+CONFIG_INTEGER(JitGCPollLoops, W("JitGCPollLoops"), 0)
 
 CONFIG_INTEGER(JitEECallTimingInfo, W("JitEECallTimingInfo"), 0)
 
@@ -518,6 +552,7 @@ CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualiza
 // Various policies for GuardedDevirtualization
 CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B) // 75
 CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, W("JitGuardedDevirtualizationChainStatements"), 4)
+CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, W("JitGuardedDevirtualizationMaxTypeChecks"), 1)
 #if defined(DEBUG)
 CONFIG_STRING(JitGuardedDevirtualizationRange, W("JitGuardedDevirtualizationRange"))
 CONFIG_INTEGER(JitRandomGuardedDevirtualization, W("JitRandomGuardedDevirtualization"), 0)
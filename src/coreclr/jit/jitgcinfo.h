@@ -325,6 +325,7 @@ public:
 
     WriteBarrierForm gcIsWriteBarrierCandidate(GenTreeStoreInd* store);
     WriteBarrierForm gcWriteBarrierFormFromTargetAddress(GenTree* tgtAddr);
+    bool gcIsHeapAddressVN(ValueNum vn);
 
     bool gcIsWriteBarrierStoreIndNode(GenTreeStoreInd* store)
     {
@@ -323,7 +323,10 @@ void Compiler::fgPerNodeLocalVarLiveness(GenTree* tree)
             {
                 CorInfoHelpFunc helpFunc = eeGetHelperNum(call->gtCallMethHnd);
 
-                if (!s_helperCallProperties.MutatesHeap(helpFunc) && !s_helperCallProperties.MayRunCctor(helpFunc))
+                // A "hoistable" helper that may run a cctor has been checked to not run a precise-init one,
+                // value numbering and the loop side effects do not treat it as a heap mutation either.
+                if (!s_helperCallProperties.MutatesHeap(helpFunc) &&
+                    (!s_helperCallProperties.MayRunCctor(helpFunc) || ((call->gtFlags & GTF_CALL_HOISTABLE) != 0)))
                 {
                     modHeap = false;
                 }
@@ -1624,6 +1624,9 @@ void Compiler::optPerformStaticOptimizations(unsigned loopNum, LoopCloneContext*
                     }
                 }
 
+                // Let the vectorizer know that the iterator indexed accesses of this loop are in range.
+                optLoopTable[loopNum].lpFlags |= LPFLG_FAST_PATH;
+
                 DBEXEC(dynamicPath, optDebugLogLoopCloning(arrIndexInfo->arrIndex.useBlock, arrIndexInfo->stmt));
             }
             break;
@@ -0,0 +1,698 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "jitpch.h"
+
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+//------------------------------------------------------------------------
+// Loop Vectorization
+//
+// This phase vectorizes simple counted loops that apply an element-wise
+// operation to arrays, such as
+//
+//    for (int i = 0; i < a.Length; i++)
+//        a[i] = b[i] * c[i] + x;
+//
+// It runs right after loop cloning and only considers loops in which
+// cloning removed the bounds checks on the iterator (LPFLG_FAST_PATH).
+// The cloning conditions guarantee that the arrays are non-null and
+// invariant in the loop, and that every index from the iterator's initial
+// value up to the limit is in range, so a whole vector of elements can be
+// loaded and stored at once without further checks. Since every access is
+// indexed by exactly the iterator, each lane only depends on the same lane
+// of earlier statements, and the arrays aliasing each other cannot change
+// the result.
+//
+// The loop
+//
+//    H:  ...                           (falls into T)
+//    T:  a[i] = f(b[i], ...)
+//        i = i + 1
+//        if (i < n) goto T
+//    X:
+//
+// becomes
+//
+//    H:  ...
+//    VH: if (i + W > n) goto VS
+//    VB: a[i..i+W) = F(b[i..i+W), ...)
+//        i = i + W
+//        if (i + W <= n) goto VB
+//    VE: if (i >= n) goto X
+//    VS:                               (new loop head, falls into T)
+//    T:  a[i] = f(b[i], ...)           (now the scalar epilogue)
+//        i = i + 1
+//        if (i < n) goto T
+//    X:
+//
+// where W is the number of elements in a Vector256 or a Vector128. The
+// vector loop is not added to the loop table, like the slow path of a
+// cloned loop.
+//
+// Restrictions:
+//  * T must be the only block of the loop and may only contain array
+//    stores of int, long, float or double elements, the increment of the
+//    iterator and the loop test.
+//  * Stored values may combine array elements at the iterator, constants
+//    and locals that are not assigned in the loop with add, subtract,
+//    multiply, divide (floating point only) and bitwise operators (integral
+//    only).
+//  * Reductions and spans are not handled.
+//------------------------------------------------------------------------
+
+#if defined(FEATURE_HW_INTRINSICS) && (defined(TARGET_XARCH) || defined(TARGET_ARM64))
+
+class LoopVectorizer
+{
+    // Largest number of statements and nodes per statement in a loop
+    // body that the vectorizer will look at.
+    static const unsigned MaxStores    = 4;
+    static const unsigned MaxTreeNodes = 16;
+
+    Compiler*   m_compiler;
+    unsigned    m_loopNum;
+    unsigned    m_iterLclNum;
+    var_types   m_elemType;
+    CorInfoType m_elemJitType;
+    var_types   m_simdType;
+    unsigned    m_simdSize;
+    unsigned    m_nodeCount;
+
+public:
+    LoopVectorizer(Compiler* compiler, unsigned loopNum)
+        : m_compiler(compiler)
+        , m_loopNum(loopNum)
+        , m_iterLclNum(BAD_VAR_NUM)
+        , m_elemType(TYP_UNDEF)
+        , m_elemJitType(CORINFO_TYPE_UNDEF)
+        , m_simdType(TYP_UNDEF)
+        , m_simdSize(0)
+        , m_nodeCount(0)
+    {
+    }
+
+    bool Run();
+
+private:
+    bool IsCandidateLoop();
+    bool IsSupportedElemType(var_types type);
+    bool IsSupportedOper(genTreeOps oper);
+
+    GenTreeArrAddr* MatchElemAddr(GenTree* addr);
+    GenTreeArrAddr* MatchElemLoad(GenTree* tree);
+    bool IsIterIndex(GenTree* tree);
+    bool IsVectorizableValue(GenTree* tree);
+    bool IsVectorizableStore(GenTree* tree);
+
+    GenTree* VectorizeValue(GenTree* tree);
+    GenTree* VectorizeStore(GenTree* tree);
+    GenTree* NewIterPlusWidth();
+    GenTree* NewLimit();
+    void NewCondBlockStmt(BasicBlock* block, GenTree* cond);
+};
+
+//------------------------------------------------------------------------
+// Run: vectorize the loop if it has a supported shape.
+//
+// Returns:
+//    True if the loop was vectorized.
+//
+bool LoopVectorizer::Run()
+{
+    if (!IsCandidateLoop())
+    {
+        return false;
+    }
+
+    Compiler::LoopDsc& loop = m_compiler->optLoopTable[m_loopNum];
+    BasicBlock* const  head = loop.lpHead;
+    BasicBlock* const  body = loop.lpTop;
+    BasicBlock* const  exit = body->bbNext;
+
+    ArrayStack<Statement*> stores(m_compiler->getAllocator(CMK_LoopOpt));
+
+    for (Statement* const stmt : body->Statements())
+    {
+        GenTree* const root = stmt->GetRootNode();
+        if ((root == loop.lpIterTree) || ((stmt == body->lastStmt()) && (root->gtGetOp1() == loop.lpTestTree)))
+        {
+            continue;
+        }
+
+        if ((stores.Height() == (int)MaxStores) || !IsVectorizableStore(root))
+        {
+            JITDUMP(FMT_LP ": " FMT_STMT " can not be vectorized\n", m_loopNum, stmt->GetID());
+            return false;
+        }
+
+        stores.Push(stmt);
+    }
+
+    // The iterator increment must be right before the loop test, so it
+    // is the last thing the body does besides the test.
+    if ((stores.Height() == 0) || (body->lastStmt()->GetPrevStmt()->GetRootNode() != loop.lpIterTree))
+    {
+        return false;
+    }
+
+    JITDUMP("Vectorizing " FMT_LP " with %u byte vectors of %s\n", m_loopNum, m_simdSize, varTypeName(m_elemType));
+
+    BasicBlock* const vecHead = m_compiler->fgNewBBafter(BBJ_COND, head, /* extendRegion */ true);
+    BasicBlock* const vecBody = m_compiler->fgNewBBafter(BBJ_COND, vecHead, /* extendRegion */ true);
+    BasicBlock* const vecExit = m_compiler->fgNewBBafter(BBJ_COND, vecBody, /* extendRegion */ true);
+    BasicBlock* const newHead = m_compiler->fgNewBBafter(BBJ_NONE, vecExit, /* extendRegion */ true);
+
+    vecHead->inheritWeight(head);
+    vecBody->inheritWeight(body);
+    vecExit->inheritWeight(head);
+    newHead->inheritWeight(head);
+
+    vecHead->bbNatLoopNum = loop.lpParent;
+    vecBody->bbNatLoopNum = loop.lpParent;
+    vecExit->bbNatLoopNum = loop.lpParent;
+    newHead->bbNatLoopNum = loop.lpParent;
+
+    vecHead->bbJumpDest = newHead;
+    vecBody->bbJumpDest = vecBody;
+    vecExit->bbJumpDest = exit;
+
+    m_compiler->fgRemoveRefPred(body, head);
+    m_compiler->fgAddRefPred(vecHead, head);
+    m_compiler->fgAddRefPred(vecBody, vecHead);
+    m_compiler->fgAddRefPred(newHead, vecHead);
+    m_compiler->fgAddRefPred(vecBody, vecBody);
+    m_compiler->fgAddRefPred(vecExit, vecBody);
+    m_compiler->fgAddRefPred(exit, vecExit);
+    m_compiler->fgAddRefPred(newHead, vecExit);
+    m_compiler->fgAddRefPred(body, newHead);
+
+    // VH: if (i + W > n) goto VS
+    NewCondBlockStmt(vecHead, m_compiler->gtNewOperNode(GT_GT, TYP_INT, NewIterPlusWidth(), NewLimit()));
+
+    // VB: the vectorized stores, i = i + W, if (i + W <= n) goto VB
+    for (int i = 0; i < stores.Height(); i++)
+    {
+        Statement* const stmt    = stores.Bottom(i);
+        Statement* const vecStmt = m_compiler->fgNewStmtFromTree(VectorizeStore(stmt->GetRootNode()),
+                                                                 stmt->GetDebugInfo());
+        m_compiler->fgInsertStmtAtEnd(vecBody, vecStmt);
+        m_compiler->fgMorphBlockStmt(vecBody, vecStmt DEBUGARG("Loop vectorization store"));
+    }
+
+    GenTree* const iterIncr =
+        m_compiler->gtNewAssignNode(m_compiler->gtNewLclvNode(m_iterLclNum, TYP_INT), NewIterPlusWidth());
+    Statement* const iterStmt = m_compiler->fgNewStmtFromTree(iterIncr);
+    m_compiler->fgInsertStmtAtEnd(vecBody, iterStmt);
+    m_compiler->fgMorphBlockStmt(vecBody, iterStmt DEBUGARG("Loop vectorization iterator"));
+
+    NewCondBlockStmt(vecBody, m_compiler->gtNewOperNode(GT_LE, TYP_INT, NewIterPlusWidth(), NewLimit()));
+
+    // VE: if (i >= n) goto X
+    NewCondBlockStmt(vecExit, m_compiler->gtNewOperNode(GT_GE, TYP_INT,
+                                                        m_compiler->gtNewLclvNode(m_iterLclNum, TYP_INT),
+                                                        NewLimit()));
+
+#if FEATURE_LOOP_ALIGN
+    // The vector loop is the one that runs most of the iterations now.
+    if (body->isLoopAlign())
+    {
+        body->bbFlags &= ~BBF_LOOP_ALIGN;
+        vecBody->bbFlags |= BBF_LOOP_ALIGN;
+    }
+#endif
+
+    // The scalar loop is entered with whatever the vector loop left in the
+    // iterator, and its old head no longer immediately precedes it.
+    head->bbFlags &= ~BBF_LOOP_PREHEADER;
+    m_compiler->optUpdateLoopHead(m_loopNum, head, newHead);
+    loop.lpFlags &= ~(LPFLG_CONST_INIT | LPFLG_HAS_PREHEAD);
+    loop.lpInitBlock = nullptr;
+
+    m_compiler->setUsesSIMDTypes(true);
+    return true;
+}
+
+//------------------------------------------------------------------------
+// IsCandidateLoop: check the loop structure and pick the vector type.
+//
+// Returns:
+//    True if the loop has the shape described at the top of this file.
+//
+bool LoopVectorizer::IsCandidateLoop()
+{
+    Compiler::LoopDsc& loop = m_compiler->optLoopTable[m_loopNum];
+
+    if ((loop.lpFlags & (LPFLG_ITER | LPFLG_FAST_PATH | LPFLG_REMOVED)) != (LPFLG_ITER | LPFLG_FAST_PATH))
+    {
+        return false;
+    }
+
+    if ((loop.lpFlags & (LPFLG_CONST_LIMIT | LPFLG_VAR_LIMIT | LPFLG_ARRLEN_LIMIT)) == 0)
+    {
+        return false;
+    }
+
+    if ((loop.lpChild != BasicBlock::NOT_IN_LOOP) || (loop.lpTop != loop.lpBottom) || !loop.lpIsTopEntry() ||
+        (loop.lpExitCnt != 1))
+    {
+        return false;
+    }
+
+    BasicBlock* const head = loop.lpHead;
+    BasicBlock* const body = loop.lpTop;
+
+    if (!body->KindIs(BBJ_COND) || (body->bbJumpDest != body) || (body->bbNext == nullptr) ||
+        !BasicBlock::sameEHRegion(head, body) || !BasicBlock::sameEHRegion(body, body->bbNext))
+    {
+        return false;
+    }
+
+    if (!head->KindIs(BBJ_NONE) && !(head->KindIs(BBJ_COND) && (head->bbJumpDest != body)))
+    {
+        return false;
+    }
+
+    // New blocks go between the head and the loop, so they must not end
+    // up outside of a parent that shares the loop's top.
+    if ((loop.lpParent != BasicBlock::NOT_IN_LOOP) && (m_compiler->optLoopTable[loop.lpParent].lpTop == body))
+    {
+        return false;
+    }
+
+    if ((loop.lpIterOper() != GT_ADD) || (loop.lpIterConst() != 1) || loop.lpIterTree->gtGetOp2()->gtOverflow() ||
+        (loop.lpTestOper() != GT_LT) || loop.lpIsReversed() || (loop.lpIterOperType() != TYP_INT))
+    {
+        return false;
+    }
+
+    GenTree* const lastStmtRoot = body->lastStmt()->GetRootNode();
+    if (!lastStmtRoot->OperIs(GT_JTRUE) || (lastStmtRoot->gtGetOp1() != loop.lpTestTree))
+    {
+        return false;
+    }
+
+    m_iterLclNum = loop.lpIterVar();
+    return true;
+}
+
+//------------------------------------------------------------------------
+// IsSupportedElemType: see if arrays of a type can be vectorized, and
+//   pick the vector size for them.
+//
+bool LoopVectorizer::IsSupportedElemType(var_types type)
+{
+    switch (type)
+    {
+        case TYP_INT:
+            m_elemJitType = CORINFO_TYPE_INT;
+            break;
+#ifdef TARGET_64BIT
+        case TYP_LONG:
+            m_elemJitType = CORINFO_TYPE_LONG;
+            break;
+#endif
+        case TYP_FLOAT:
+            m_elemJitType = CORINFO_TYPE_FLOAT;
+            break;
+        case TYP_DOUBLE:
+            m_elemJitType = CORINFO_TYPE_DOUBLE;
+            break;
+        default:
+            return false;
+    }
+
+    m_elemType = type;
+    m_simdSize = 16;
+#if defined(TARGET_XARCH)
+    if (m_compiler->compOpportunisticallyDependsOn(InstructionSet_AVX2))
+    {
+        m_simdSize = 32;
+    }
+#endif
+    m_simdType = Compiler::getSIMDTypeForSize(m_simdSize);
+    return true;
+}
+
+//------------------------------------------------------------------------
+// IsSupportedOper: see if an operator can be applied lane-wise to vectors
+//   of the element type with the same result as the scalar loop.
+//
+bool LoopVectorizer::IsSupportedOper(genTreeOps oper)
+{
+    switch (oper)
+    {
+        case GT_ADD:
+        case GT_SUB:
+            return true;
+
+        case GT_MUL:
+            if (varTypeIsFloating(m_elemType))
+            {
+                return true;
+            }
+#if defined(TARGET_XARCH)
+            // Vector multiplies of longs and, without SSE4.1, of ints are
+            // emulated with sequences that need the importer.
+            return (m_elemType == TYP_INT) &&
+                   ((m_simdSize == 32) || m_compiler->compOpportunisticallyDependsOn(InstructionSet_SSE41));
+#else
+            return m_elemType == TYP_INT;
+#endif
+
+        case GT_DIV:
+            return varTypeIsFloating(m_elemType);
+
+        case GT_AND:
+        case GT_OR:
+        case GT_XOR:
+            return varTypeIsIntegral(m_elemType);
+
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------
+// IsIterIndex: see if a tree is the iterator, widened to native int on
+//   64 bit targets.
+//
+bool LoopVectorizer::IsIterIndex(GenTree* tree)
+{
+#ifdef TARGET_64BIT
+    if (!tree->OperIs(GT_CAST) || tree->gtOverflow() || (tree->AsCast()->CastToType() != TYP_LONG))
+    {
+        return false;
+    }
+    tree = tree->AsCast()->CastOp();
+#endif
+    return tree->OperIs(GT_LCL_VAR) && (tree->AsLclVarCommon()->GetLclNum() == m_iterLclNum);
+}
+
+//------------------------------------------------------------------------
+// MatchElemAddr: match the address of an array element indexed by the
+//   iterator whose bounds check has been removed.
+//
+// Arguments:
+//    addr - the address
+//
+// Returns:
+//    The ARR_ADDR node, or nullptr if the address has another shape.
+//
+// Notes:
+//    Accepts the shapes fgMorphIndexAddr creates, with a removed bounds
+//    check left as a NOP:
+//      [COMMA(NOP, )] ARR_ADDR(ADD(arr, ADD(scaledIndex, offset)))
+//      [COMMA(NOP, )] ARR_ADDR(ADD(ADD(arr, offset), scaledIndex))
+//
+GenTreeArrAddr* LoopVectorizer::MatchElemAddr(GenTree* addr)
+{
+    if (addr->OperIs(GT_COMMA) && addr->gtGetOp1()->OperIs(GT_NOP))
+    {
+        addr = addr->gtGetOp2();
+    }
+
+    if (!addr->OperIs(GT_ARR_ADDR))
+    {
+        return nullptr;
+    }
+
+    GenTreeArrAddr* const arrAddr = addr->AsArrAddr();
+    var_types const       type    = arrAddr->GetElemType();
+    if ((m_elemType == TYP_UNDEF) ? !IsSupportedElemType(type) : (type != m_elemType))
+    {
+        return nullptr;
+    }
+
+    GenTree* const add = arrAddr->Addr();
+    if (!add->OperIs(GT_ADD))
+    {
+        return nullptr;
+    }
+
+    GenTree* base = add->gtGetOp1();
+    GenTree* rest = add->gtGetOp2();
+    GenTree* scaledIndex;
+    GenTree* offset;
+
+    if (base->OperIs(GT_ADD))
+    {
+        scaledIndex = rest;
+        offset      = base->gtGetOp2();
+        base        = base->gtGetOp1();
+    }
+    else if (rest->OperIs(GT_ADD))
+    {
+        scaledIndex = rest->gtGetOp1();
+        offset      = rest->gtGetOp2();
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    if (!base->OperIs(GT_LCL_VAR) || !base->TypeIs(TYP_REF) || (base->AsLclVarCommon()->GetLclNum() == m_iterLclNum))
+    {
+        return nullptr;
+    }
+
+    if (!offset->IsCnsIntOrI() || (offset->AsIntCon()->IconValue() != arrAddr->GetFirstElemOffset()))
+    {
+        return nullptr;
+    }
+
+    unsigned const elemSize = genTypeSize(type);
+    if (scaledIndex->OperIs(GT_MUL) && scaledIndex->gtGetOp2()->IsIntegralConst(elemSize))
+    {
+        return IsIterIndex(scaledIndex->gtGetOp1()) ? arrAddr : nullptr;
+    }
+
+    if (scaledIndex->OperIs(GT_LSH) && scaledIndex->gtGetOp2()->IsIntegralConst(genLog2(elemSize)))
+    {
+        return IsIterIndex(scaledIndex->gtGetOp1()) ? arrAddr : nullptr;
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------
+// MatchElemLoad: match a load of an array element indexed by the iterator.
+//
+// Returns:
+//    The ARR_ADDR node of the load, or nullptr if the tree is not such a
+//    load.
+//
+GenTreeArrAddr* LoopVectorizer::MatchElemLoad(GenTree* tree)
+{
+    if (tree->OperIs(GT_COMMA) && tree->gtGetOp1()->OperIs(GT_NOP))
+    {
+        tree = tree->gtGetOp2();
+    }
+
+    if (!tree->OperIs(GT_IND) || ((tree->gtFlags & GTF_IND_VOLATILE) != 0))
+    {
+        return nullptr;
+    }
+
+    GenTreeArrAddr* const arrAddr = MatchElemAddr(tree->AsIndir()->Addr());
+    if ((arrAddr == nullptr) || !tree->TypeIs(m_elemType))
+    {
+        return nullptr;
+    }
+
+    return arrAddr;
+}
+
+//------------------------------------------------------------------------
+// IsVectorizableValue: see if a stored value can be computed lane-wise.
+//
+bool LoopVectorizer::IsVectorizableValue(GenTree* tree)
+{
+    if (++m_nodeCount > MaxTreeNodes)
+    {
+        return false;
+    }
+
+    if (MatchElemLoad(tree) != nullptr)
+    {
+        return true;
+    }
+
+    if (genActualType(tree) != genActualType(m_elemType))
+    {
+        return false;
+    }
+
+    switch (tree->OperGet())
+    {
+        case GT_CNS_INT:
+        case GT_CNS_LNG:
+        case GT_CNS_DBL:
+            return !tree->IsIconHandle();
+
+        case GT_LCL_VAR:
+            // The loop only assigns the iterator, so any other local is invariant.
+            return tree->AsLclVarCommon()->GetLclNum() != m_iterLclNum;
+
+        default:
+            break;
+    }
+
+    if (!tree->OperIsBinary() || tree->gtOverflowEx() || !IsSupportedOper(tree->OperGet()))
+    {
+        return false;
+    }
+
+    return IsVectorizableValue(tree->gtGetOp1()) && IsVectorizableValue(tree->gtGetOp2());
+}
+
+//------------------------------------------------------------------------
+// IsVectorizableStore: see if a statement is an array element store that
+//   can be vectorized.
+//
+bool LoopVectorizer::IsVectorizableStore(GenTree* tree)
+{
+    if (tree->OperIs(GT_COMMA) && tree->gtGetOp1()->OperIs(GT_NOP))
+    {
+        tree = tree->gtGetOp2();
+    }
+
+    if (!tree->OperIs(GT_ASG) || ((tree->gtGetOp2()->gtFlags & (GTF_ASG | GTF_CALL)) != 0))
+    {
+        return false;
+    }
+
+    GenTree* const dst = tree->gtGetOp1();
+    if (!dst->OperIs(GT_IND) || ((dst->gtFlags & GTF_IND_VOLATILE) != 0) ||
+        (MatchElemAddr(dst->AsIndir()->Addr()) == nullptr) || !dst->TypeIs(m_elemType))
+    {
+        return false;
+    }
+
+    m_nodeCount = 0;
+    return IsVectorizableValue(tree->gtGetOp2());
+}
+
+//------------------------------------------------------------------------
+// VectorizeValue: create the vector equivalent of a stored value.
+//
+// Notes:
+//    The SIMD nodes are marked GTF_DONT_CSE: the vectorizer does not set up
+//    the struct handles that CSE temps of SIMD types need.
+//
+GenTree* LoopVectorizer::VectorizeValue(GenTree* tree)
+{
+    GenTree* result;
+
+    GenTreeArrAddr* const arrAddr = MatchElemLoad(tree);
+    if (arrAddr != nullptr)
+    {
+        result = m_compiler->gtNewIndir(m_simdType, m_compiler->gtCloneExpr(arrAddr->Addr()));
+        result->gtFlags |= GTF_GLOB_REF;
+    }
+    else if (tree->OperIsConst() || tree->OperIs(GT_LCL_VAR))
+    {
+        result = m_compiler->gtNewSimdCreateBroadcastNode(m_simdType, m_compiler->gtCloneExpr(tree), m_elemJitType,
+                                                          m_simdSize, /* isSimdAsHWIntrinsic */ false);
+    }
+    else
+    {
+        GenTree* const op1 = VectorizeValue(tree->gtGetOp1());
+        GenTree* const op2 = VectorizeValue(tree->gtGetOp2());
+        result             = m_compiler->gtNewSimdBinOpNode(tree->OperGet(), m_simdType, op1, op2, m_elemJitType,
+                                                m_simdSize, /* isSimdAsHWIntrinsic */ false);
+    }
+
+    result->gtFlags |= GTF_DONT_CSE;
+    return result;
+}
+
+//------------------------------------------------------------------------
+// VectorizeStore: create the vector equivalent of an element store.
+//
+GenTree* LoopVectorizer::VectorizeStore(GenTree* tree)
+{
+    if (tree->OperIs(GT_COMMA))
+    {
+        tree = tree->gtGetOp2();
+    }
+
+    GenTreeArrAddr* const arrAddr = MatchElemAddr(tree->gtGetOp1()->AsIndir()->Addr());
+    GenTree* const        dst = m_compiler->gtNewIndir(m_simdType, m_compiler->gtCloneExpr(arrAddr->Addr()));
+    dst->gtFlags |= GTF_GLOB_REF;
+    return m_compiler->gtNewAssignNode(dst, VectorizeValue(tree->gtGetOp2()));
+}
+
+//------------------------------------------------------------------------
+// NewIterPlusWidth: create "i + W".
+//
+GenTree* LoopVectorizer::NewIterPlusWidth()
+{
+    unsigned const width = m_simdSize / genTypeSize(m_elemType);
+    return m_compiler->gtNewOperNode(GT_ADD, TYP_INT, m_compiler->gtNewLclvNode(m_iterLclNum, TYP_INT),
+                                     m_compiler->gtNewIconNode(width));
+}
+
+//------------------------------------------------------------------------
+// NewLimit: create a copy of the loop limit.
+//
+GenTree* LoopVectorizer::NewLimit()
+{
+    return m_compiler->gtCloneExpr(m_compiler->optLoopTable[m_loopNum].lpLimit());
+}
+
+//------------------------------------------------------------------------
+// NewCondBlockStmt: add the conditional jump that ends a new block.
+//
+void LoopVectorizer::NewCondBlockStmt(BasicBlock* block, GenTree* cond)
+{
+    cond->gtFlags |= GTF_RELOP_JMP_USED;
+    GenTree* const   jmpTrue = m_compiler->gtNewOperNode(GT_JTRUE, TYP_VOID, cond);
+    Statement* const stmt    = m_compiler->fgNewStmtFromTree(jmpTrue);
+    m_compiler->fgInsertStmtAtEnd(block, stmt);
+    m_compiler->fgMorphBlockStmt(block, stmt DEBUGARG("Loop vectorization condition"));
+}
+
+#endif // FEATURE_HW_INTRINSICS && (TARGET_XARCH || TARGET_ARM64)
+
+//------------------------------------------------------------------------
+// optVectorizeLoops: vectorize element-wise array loops whose bounds checks
+//   have been removed by loop cloning.
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus Compiler::optVectorizeLoops()
+{
+#if defined(FEATURE_HW_INTRINSICS) && (defined(TARGET_XARCH) || defined(TARGET_ARM64))
+    if ((optLoopCount == 0) || !IsBaselineSimdIsaSupported() ||
+        ((JitConfig.JitVectorizeLoops() == 0) && !compStressCompile(STRESS_VECTORIZE_LOOPS, 25)))
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    unsigned loopsVectorized = 0;
+    for (unsigned loopNum = 0; loopNum < optLoopCount; loopNum++)
+    {
+        LoopVectorizer vectorizer(this, loopNum);
+        if (vectorizer.Run())
+        {
+            loopsVectorized++;
+        }
+    }
+
+    if (loopsVectorized == 0)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    JITDUMP("Vectorized %u loops, recomputing reachability and dominators\n", loopsVectorized);
+    constexpr bool computePreds = false;
+    fgUpdateChangedFlowGraph(computePreds);
+    return PhaseStatus::MODIFIED_EVERYTHING;
+#else
+    return PhaseStatus::MODIFIED_NOTHING;
+#endif
+}
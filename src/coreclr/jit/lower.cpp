@@ -238,6 +238,12 @@ GenTree* Lowering::LowerNode(GenTree* node)
         case GT_JTRUE:
             return LowerJTrue(node->AsOp());
 
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+        case GT_SELECT:
+            LowerSelect(node->AsConditional());
+            break;
+#endif // TARGET_XARCH || TARGET_ARM64
+
         case GT_JMP:
             LowerJmpMethod(node);
             break;
@@ -1354,9 +1360,12 @@ void Lowering::LowerArg(GenTreeCall* call, CallArg* callArg, bool late)
     {
 
 #if defined(TARGET_ARMARCH) || defined(TARGET_LOONGARCH64)
-        if (call->IsVarargs() || comp->opts.compUseSoftFP)
+        if (call->IsVarargs() || comp->opts.compUseSoftFP ||
+            (TargetArchitecture::IsArm64 && arg->OperIs(GT_FIELD_LIST)))
         {
             // For vararg call or on armel, reg args should be all integer.
+            // On arm64 a struct that is not an HFA is passed in integer registers even
+            // when its promoted fields are floating point.
             // Insert copies as needed to move float value to integer register.
             GenTree* newNode = LowerFloatArg(ppArg, callArg);
             if (newNode != nullptr)
@@ -1419,7 +1428,7 @@ GenTree* Lowering::LowerFloatArg(GenTree** pArg, CallArg* callArg)
                     break;
                 }
                 GenTree* node = use.GetNode();
-                if (varTypeIsFloating(node))
+                if (varTypeIsFloating(node) && genIsValidIntReg(currRegNumber))
                 {
                     GenTree* intNode = LowerFloatArgReg(node, currRegNumber);
                     assert(intNode != nullptr);
@@ -1427,12 +1436,14 @@ GenTree* Lowering::LowerFloatArg(GenTree** pArg, CallArg* callArg)
                     ReplaceArgWithPutArgOrBitcast(&use.NodeRef(), intNode);
                 }
 
+#ifndef TARGET_64BIT
                 if (node->TypeGet() == TYP_DOUBLE)
                 {
                     currRegNumber = REG_NEXT(REG_NEXT(currRegNumber));
                     regIndex += 2;
                 }
                 else
+#endif // !TARGET_64BIT
                 {
                     currRegNumber = REG_NEXT(currRegNumber);
                     regIndex += 1;
@@ -3148,6 +3159,55 @@ GenTree* Lowering::LowerJTrue(GenTreeOp* jtrue)
     return nullptr;
 }
 
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+//------------------------------------------------------------------------
+// Lowering::LowerSelect: Lowers a SELECT node.
+//
+// Arguments:
+//    select - the SELECT node
+//
+// Notes:
+//    The condition has already been lowered and it may no longer be an
+//    integer compare, e.g. LowerCompare may have turned it into a SETCC
+//    or replaced it by one of its operands. In that case the condition
+//    value is compared against 0 so that the select can always emit the
+//    compare itself, just before the cmov/csel that consumes the flags.
+//
+void Lowering::LowerSelect(GenTreeConditional* select)
+{
+    assert(select->OperIs(GT_SELECT));
+
+    GenTree* cond = select->gtCond;
+
+    if (!cond->OperIsCompare() || varTypeIsFloating(cond->gtGetOp1()))
+    {
+        assert(varTypeIsIntegralOrI(cond));
+
+        GenTree* zero = comp->gtNewZeroConNode(genActualType(cond));
+        GenTree* cmp  = comp->gtNewOperNode(GT_NE, TYP_INT, cond, zero);
+        BlockRange().InsertAfter(cond, zero, cmp);
+        ContainCheckCompare(cmp->AsOp());
+
+        select->gtCond = cmp;
+    }
+
+    ContainCheckSelect(select);
+}
+
+//------------------------------------------------------------------------
+// ContainCheckSelect: determine whether the sources of a SELECT should be contained.
+//
+// Arguments:
+//    node - pointer to the node
+//
+void Lowering::ContainCheckSelect(GenTreeConditional* node)
+{
+    // The compare is generated by the select, the values need to be in registers.
+    assert(node->gtCond->OperIsCompare());
+    node->gtCond->SetContained();
+}
+#endif // TARGET_XARCH || TARGET_ARM64
+
 //----------------------------------------------------------------------------------------------
 // LowerNodeCC: Lowers a node that produces a boolean value by setting the condition flags.
 //
@@ -6839,6 +6899,12 @@ void Lowering::ContainCheckNode(GenTree* node)
             ContainCheckJTrue(node->AsOp());
             break;
 
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+        case GT_SELECT:
+            ContainCheckSelect(node->AsConditional());
+            break;
+#endif // TARGET_XARCH || TARGET_ARM64
+
         case GT_ADD:
         case GT_SUB:
 #if !defined(TARGET_64BIT)
@@ -85,6 +85,9 @@ private:
     void ContainCheckLclHeap(GenTreeOp* node);
     void ContainCheckRet(GenTreeUnOp* ret);
     void ContainCheckJTrue(GenTreeOp* node);
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+    void ContainCheckSelect(GenTreeConditional* node);
+#endif
 
     void ContainCheckBitCast(GenTree* node);
     void ContainCheckCallOperands(GenTreeCall* call);
@@ -133,6 +136,9 @@ private:
     GenTree* OptimizeConstCompare(GenTree* cmp);
     GenTree* LowerCompare(GenTree* cmp);
     GenTree* LowerJTrue(GenTreeOp* jtrue);
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+    void LowerSelect(GenTreeConditional* select);
+#endif
     GenTreeCC* LowerNodeCC(GenTree* node, GenCondition condition);
     void LowerJmpMethod(GenTree* jmp);
     void LowerRet(GenTreeUnOp* ret);
@@ -3302,13 +3302,15 @@ void LinearScan::spillInterval(Interval* interval, RefPosition* fromRefPosition
     //
     // Note: Only mark "singleDefSpill" for those intervals who ever get spilled. The intervals that are never spilled
     // will not be marked as "singleDefSpill" and hence won't get spilled at the first definition.
+    //
+    // Spilling at the def is only beneficial if the def is no hotter than the point where we are spilling. This
+    // hoists spills out of loops when the value is defined before the loop, but if the def itself is in a hot
+    // block (e.g. a loop body) and the spill point is colder (e.g. a loop exit), keep the spill where it is so
+    // that we don't add a store to the hot block.
     if (interval->isSingleDef && RefTypeIsDef(interval->firstRefPosition->refType) &&
-        !interval->firstRefPosition->spillAfter)
+        !interval->firstRefPosition->spillAfter &&
+        (blockInfo[interval->firstRefPosition->bbNum].weight <= blockInfo[fromRefPosition->bbNum].weight))
     {
-        // TODO-CQ: Check if it is beneficial to spill at def, meaning, if it is a hot block don't worry about
-        // doing the spill. Another option is to track number of refpositions and a interval has more than X
-        // refpositions
-        // then perform this optimization.
         interval->firstRefPosition->singleDefSpill = true;
     }
 
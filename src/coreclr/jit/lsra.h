@@ -1847,6 +1847,10 @@ private:
     int BuildPutArgReg(GenTreeUnOp* node);
     int BuildCall(GenTreeCall* call);
     int BuildCmp(GenTree* tree);
+    int BuildCmpOperands(GenTree* tree);
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+    int BuildSelect(GenTreeConditional* select);
+#endif
     int BuildBlockStore(GenTreeBlk* blkNode);
     int BuildModDiv(GenTree* tree);
     int BuildIntrinsic(GenTree* tree);
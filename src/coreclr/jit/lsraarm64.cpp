@@ -419,6 +419,11 @@ int LinearScan::BuildNode(GenTree* tree)
             srcCount = BuildCmp(tree);
             break;
 
+        case GT_SELECT:
+            assert(dstCount == 1);
+            srcCount = BuildSelect(tree->AsConditional());
+            break;
+
         case GT_CKFINITE:
             srcCount = 1;
             assert(dstCount == 1);
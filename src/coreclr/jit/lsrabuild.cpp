@@ -3990,10 +3990,6 @@ int LinearScan::BuildCmp(GenTree* tree)
 {
     assert(tree->OperIsCompare() || tree->OperIs(GT_CMP) || tree->OperIs(GT_JCMP));
     regMaskTP dstCandidates = RBM_NONE;
-    regMaskTP op1Candidates = RBM_NONE;
-    regMaskTP op2Candidates = RBM_NONE;
-    GenTree*  op1           = tree->gtGetOp1();
-    GenTree*  op2           = tree->gtGetOp2();
 
 #ifdef TARGET_X86
     // If the compare is used by a jump, we just need to set the condition codes. If not, then we need
@@ -4002,6 +3998,38 @@ int LinearScan::BuildCmp(GenTree* tree)
     {
         dstCandidates = allByteRegs();
     }
+#endif // TARGET_X86
+
+    int srcCount = BuildCmpOperands(tree);
+    if (tree->TypeGet() != TYP_VOID)
+    {
+        BuildDef(tree, dstCandidates);
+    }
+    return srcCount;
+}
+
+//------------------------------------------------------------------------
+// BuildCmpOperands: Set the register requirements for a compare's operands.
+//
+// Arguments:
+//    tree      - The compare node of interest
+//
+// Return Value:
+//    The number of sources consumed by this node.
+//
+// Notes:
+//    This is also used for a compare that is contained in a GT_SELECT,
+//    in which case the compare itself does not produce a value.
+//
+int LinearScan::BuildCmpOperands(GenTree* tree)
+{
+    assert(tree->OperIsCompare() || tree->OperIs(GT_CMP) || tree->OperIs(GT_JCMP));
+    regMaskTP op1Candidates = RBM_NONE;
+    regMaskTP op2Candidates = RBM_NONE;
+    GenTree*  op1           = tree->gtGetOp1();
+    GenTree*  op2           = tree->gtGetOp2();
+
+#ifdef TARGET_X86
     bool needByteRegs = false;
     if (varTypeIsByte(tree))
     {
@@ -4048,9 +4076,34 @@ int LinearScan::BuildCmp(GenTree* tree)
 
     int srcCount = BuildOperandUses(op1, op1Candidates);
     srcCount += BuildOperandUses(op2, op2Candidates);
-    if (tree->TypeGet() != TYP_VOID)
-    {
-        BuildDef(tree, dstCandidates);
-    }
     return srcCount;
 }
+
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+//------------------------------------------------------------------------
+// BuildSelect: Set the register requirements for a GT_SELECT.
+//
+// Arguments:
+//    select    - The node of interest
+//
+// Return Value:
+//    The number of sources consumed by this node.
+//
+// Notes:
+//    The condition is a contained compare that is emitted by the select
+//    itself, so its operands are used here. The two values are used after
+//    the compare operands and the result is defined last, so it may share
+//    a register with any of the sources.
+//
+int LinearScan::BuildSelect(GenTreeConditional* select)
+{
+    assert(select->OperIs(GT_SELECT));
+    assert(select->gtCond->isContained());
+
+    int srcCount = BuildCmpOperands(select->gtCond);
+    srcCount += BuildOperandUses(select->gtOp1);
+    srcCount += BuildOperandUses(select->gtOp2);
+    BuildDef(select);
+    return srcCount;
+}
+#endif // defined(TARGET_XARCH) || defined(TARGET_ARM64)
@@ -3824,6 +3824,15 @@ GenTree* Compiler::fgMorphMultiregStructArg(CallArg* arg)
 
                 var_types fieldType = lvaGetDesc(fieldLclNum)->TypeGet();
                 var_types regType   = genActualType(elems[inx].Type);
+#ifdef TARGET_ARM64
+                // Floating point fields of structs passed in integer registers are moved
+                // to their registers with bitcasts in lowering (see LowerFloatArg).
+                if (varTypeIsFloating(fieldType) && !varTypeUsesFloatReg(regType) &&
+                    (genTypeSize(fieldType) <= genTypeSize(regType)))
+                {
+                    continue;
+                }
+#endif // TARGET_ARM64
                 if (varTypeUsesFloatReg(fieldType) != varTypeUsesFloatReg(regType))
                 {
                     // TODO-LSRA - It currently doesn't support the passing of floating point LCL_VARS in the
@@ -14352,6 +14361,17 @@ GenTree* Compiler::fgMorphTree(GenTree* tree, MorphAddrContext* mac)
             tree->gtFlags |= tree->AsCmpXchg()->gtOpComparand->gtFlags & GTF_ALL_EFFECT;
             break;
 
+        case GT_SELECT:
+            tree->AsConditional()->gtCond = fgMorphTree(tree->AsConditional()->gtCond);
+            tree->AsConditional()->gtOp1  = fgMorphTree(tree->AsConditional()->gtOp1);
+            tree->AsConditional()->gtOp2  = fgMorphTree(tree->AsConditional()->gtOp2);
+
+            tree->gtFlags &= ~GTF_ALL_EFFECT;
+            tree->gtFlags |= tree->AsConditional()->gtCond->gtFlags & GTF_ALL_EFFECT;
+            tree->gtFlags |= tree->AsConditional()->gtOp1->gtFlags & GTF_ALL_EFFECT;
+            tree->gtFlags |= tree->AsConditional()->gtOp2->gtFlags & GTF_ALL_EFFECT;
+            break;
+
         case GT_STORE_DYN_BLK:
             tree = fgMorphStoreDynBlock(tree->AsStoreDynBlk());
             break;
@@ -390,7 +390,9 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 CORINFO_CLASS_HANDLE clsHnd     = op2->AsAllocObj()->gtAllocObjClsHnd;
 
                 // Don't attempt to do stack allocations inside basic blocks that may be in a loop.
-                if (IsObjectStackAllocationEnabled() && !basicBlockHasBackwardJump &&
+                // OSR methods can see the object through locals that were live in the Tier0
+                // frame, where it was allocated on the heap, so don't stack allocate there either.
+                if (IsObjectStackAllocationEnabled() && !basicBlockHasBackwardJump && !comp->opts.IsOSR() &&
                     CanAllocateLclVarOnStack(lclNum, clsHnd))
                 {
                     JITDUMP("Allocating local variable V%02u on the stack\n", lclNum);
@@ -642,6 +644,9 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
+                // The inliner null checks 'this' before the body of an inlined instance method,
+                // so this is how most objects that are only used by inlinees get consumed.
                 canLclVarEscapeViaParentStack = false;
                 break;
 
@@ -749,6 +754,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
                 break;
 
             case GT_COMMA:
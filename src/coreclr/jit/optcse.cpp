@@ -1720,6 +1720,7 @@ void Compiler::optValnumCSE_Availablity()
 //
 class CSE_Heuristic
 {
+protected:
     Compiler* m_pCompiler;
     unsigned  m_addCSEcount;
 
@@ -1751,7 +1752,7 @@ public:
     // the aggressive, moderate and conservative CSE promotions. Count the number of enregisterable variables.
     // Determine if the method has a large or huge stack frame.
     //
-    void Initialize()
+    virtual void Initialize()
     {
         m_addCSEcount = 0; /* Count of the number of LclVars for CSEs that we added */
 
@@ -2299,7 +2300,7 @@ public:
     // Given a CSE candidate decide whether it passes or fails the profitability heuristic
     // return true if we believe that it is profitable to promote this candidate to a CSE
     //
-    bool PromotionCheck(CSE_Candidate* candidate)
+    virtual bool PromotionCheck(CSE_Candidate* candidate)
     {
         bool result = false;
 
@@ -3076,7 +3077,14 @@ public:
                         ValueNum oldVN = exp->gtVNPair.GetConservative();
                         if (!vnStore->IsVNConstant(theConservativeVN) && vnStore->IsVNCheckedBound(oldVN))
                         {
-                            vnStore->SetVNIsCheckedBound(theConservativeVN);
+                            if (vnStore->IsVNNonNegativeCheckedBound(oldVN))
+                            {
+                                vnStore->SetVNIsCheckedBound(theConservativeVN);
+                            }
+                            else
+                            {
+                                vnStore->SetVNIsComparedCheckedBound(theConservativeVN);
+                            }
                         }
 
                         GenTree* cmp;
@@ -3422,6 +3430,191 @@ public:
     }
 };
 
+//  The following class handles the CSE heuristics for methods with profile data. Rather than
+//  comparing weighted ref counts against cutoffs derived from the other locals, it relies on
+//  the block weights and on an estimate of the register pressure where the CSE occurs:
+//
+//  * A CSE whose occurrences are all in run rarely blocks is only made if it saves code.
+//  * A CSE is expected to get a register if, in each block it occurs in, the number of
+//    locals live into the block leaves a register free; otherwise it is costed as a stack temp.
+//  * Saving and restoring a callee saved register for a CSE live across a call happens once
+//    per call of the method, so it is costed at the weight of the method entry. CSEs in hot
+//    loops are not penalized by it the way the default heuristic does.
+//
+//  Struct and SIMD CSEs, and methods optimized for size, are left to the default heuristic.
+//
+class CSE_HeuristicPGO : public CSE_Heuristic
+{
+    // Estimated number of integer and floating point locals live into each block, by bbNum.
+    unsigned* m_intPressure;
+    unsigned* m_floatPressure;
+
+public:
+    CSE_HeuristicPGO(Compiler* pCompiler)
+        : CSE_Heuristic(pCompiler), m_intPressure(nullptr), m_floatPressure(nullptr)
+    {
+    }
+
+    void Initialize() override
+    {
+        CSE_Heuristic::Initialize();
+
+        if (!m_pCompiler->fgLocalVarLivenessDone)
+        {
+            JITDUMP("No liveness, using the default CSE heuristic\n");
+            return;
+        }
+
+        const unsigned bbCount = m_pCompiler->fgBBNumMax + 1;
+        m_intPressure          = new (m_pCompiler, CMK_CSE) unsigned[bbCount]();
+        m_floatPressure        = new (m_pCompiler, CMK_CSE) unsigned[bbCount]();
+
+        for (BasicBlock* const block : m_pCompiler->Blocks())
+        {
+            VarSetOps::Iter iter(m_pCompiler, block->bbLiveIn);
+            unsigned        varIndex = 0;
+            while (iter.NextElem(&varIndex))
+            {
+                LclVarDsc* const varDsc = m_pCompiler->lvaGetDescByTrackedIndex(varIndex);
+
+                if (varDsc->lvDoNotEnregister)
+                {
+                    continue;
+                }
+
+                if (varTypeUsesFloatReg(varDsc->TypeGet()))
+                {
+                    m_floatPressure[block->bbNum]++;
+                }
+                else
+                {
+                    m_intPressure[block->bbNum]++;
+                }
+            }
+        }
+    }
+
+    bool PromotionCheck(CSE_Candidate* candidate) override
+    {
+        if ((m_intPressure == nullptr) || (CodeOptKind() == Compiler::SMALL_CODE) ||
+            varTypeIsStruct(candidate->Expr()->TypeGet()))
+        {
+            return CSE_Heuristic::PromotionCheck(candidate);
+        }
+
+#ifdef DEBUG
+        int stressResult = optConfigBiasedCSE();
+        if (stressResult > 0)
+        {
+            candidate->SetStressCSE();
+            return true;
+        }
+
+        if (m_pCompiler->optConfigDisableCSE2())
+        {
+            return false; // skip this CSE
+        }
+#endif
+
+        const bool isFloat   = varTypeUsesFloatReg(candidate->Expr()->TypeGet());
+        unsigned*  pressures = isFloat ? m_floatPressure : m_intPressure;
+        unsigned   pressure  = 0;
+        bool       allRare   = true;
+
+        for (Compiler::treeStmtLst* lst = candidate->CseDsc()->csdTreeList; lst != nullptr; lst = lst->tslNext)
+        {
+            BasicBlock* const block = lst->tslBlock;
+            pressure                = max(pressure, pressures[block->bbNum]);
+            allRare &= block->isRunRarely();
+        }
+
+        bool result;
+
+        if (allRare)
+        {
+            // Only the code size matters. A def also stores to the CSE temp and a use becomes
+            // a reference to the temp; both take about 2 bytes.
+            //
+            candidate->SetConservative();
+
+            const unsigned useCount = candidate->CseDsc()->csdUseCount;
+            const unsigned defCount = candidate->CseDsc()->csdDefCount;
+            const unsigned size     = candidate->Size();
+
+            result = (size > 2) && ((useCount * (size - 2)) > (defCount * 2));
+
+            JITDUMP("Cold CSE: def=%u, use=%u, size=%u: %s\n", defCount, useCount, size,
+                    result ? "saves code" : "does not save code");
+        }
+        else
+        {
+            unsigned regCount;
+            if (candidate->LiveAcrossCall())
+            {
+                regCount = isFloat ? CNT_CALLEE_SAVED_FLOAT : CNT_CALLEE_ENREG;
+            }
+            else
+            {
+                regCount = isFloat ? (CNT_CALLEE_SAVED_FLOAT + CNT_CALLEE_TRASH_FLOAT)
+                                   : (CNT_CALLEE_ENREG + CNT_CALLEE_TRASH);
+            }
+
+            const bool canEnregister = pressure < regCount;
+
+            weight_t defCost;
+            weight_t useCost;
+            weight_t extraCost = 0;
+
+            if (canEnregister)
+            {
+                candidate->SetAggressive();
+                defCost = 1;
+                useCost = 1;
+
+                if (candidate->LiveAcrossCall())
+                {
+                    // The callee saved register has to be saved and restored by the prolog and the epilog.
+                    extraCost = 2 * m_pCompiler->fgFirstBB->getBBWeight(m_pCompiler);
+                }
+            }
+            else
+            {
+                candidate->SetConservative();
+                defCost = 2;
+                useCost = candidate->LiveAcrossCall() ? 3 : 2;
+            }
+
+            const weight_t noCost  = candidate->UseCount() * candidate->Cost();
+            const weight_t yesCost = (candidate->DefCount() * defCost) + (candidate->UseCount() * useCost) + extraCost;
+
+            result = yesCost <= noCost;
+
+            JITDUMP("Hot CSE: pressure=%u of %u regs%s, defCnt=%f, useCnt=%f, cost=%u, extra=%f: (%f <= %f) %s\n",
+                    pressure, regCount, candidate->LiveAcrossCall() ? " (across call)" : "", candidate->DefCount(),
+                    candidate->UseCount(), candidate->Cost(), extraCost, yesCost, noCost,
+                    result ? "passes" : "fails");
+        }
+
+        if (result)
+        {
+            // The new CSE temp is live in the blocks it occurs in. This is a lower bound,
+            // it may well be live in blocks between the defs and the uses.
+            //
+            BasicBlock* lastBlock = nullptr;
+            for (Compiler::treeStmtLst* lst = candidate->CseDsc()->csdTreeList; lst != nullptr; lst = lst->tslNext)
+            {
+                if (lst->tslBlock != lastBlock)
+                {
+                    lastBlock = lst->tslBlock;
+                    pressures[lastBlock->bbNum]++;
+                }
+            }
+        }
+
+        return result;
+    }
+};
+
 /*****************************************************************************
  *
  *  Routine for performing the Value Number based CSE using our heuristics
@@ -3438,12 +3631,26 @@ void Compiler::optValnumCSE_Heuristic()
     }
 #endif // DEBUG
 
-    CSE_Heuristic cse_heuristic(this);
+    // JitCSEHeuristic picks the profile driven heuristic for methods with profile data (1), or for
+    // all methods (2).
+    //
+    const int      heuristicKind = JitConfig.JitCSEHeuristic();
+    CSE_Heuristic* cse_heuristic;
+
+    if ((heuristicKind == 2) || ((heuristicKind == 1) && fgHaveProfileData()))
+    {
+        JITDUMP("Using the profile driven CSE heuristic\n");
+        cse_heuristic = new (this, CMK_CSE) CSE_HeuristicPGO(this);
+    }
+    else
+    {
+        cse_heuristic = new (this, CMK_CSE) CSE_Heuristic(this);
+    }
 
-    cse_heuristic.Initialize();
-    cse_heuristic.SortCandidates();
-    cse_heuristic.ConsiderCandidates();
-    cse_heuristic.Cleanup();
+    cse_heuristic->Initialize();
+    cse_heuristic->SortCandidates();
+    cse_heuristic->ConsiderCandidates();
+    cse_heuristic->Cleanup();
 }
 
 /*****************************************************************************
@@ -2735,6 +2735,10 @@ NO_MORE_LOOPS:
 // The `first` block of the loop is marked with the BBF_LOOP_ALIGN flag to indicate this
 // (the loop table itself is not changed).
 //
+// When the loop has profile data, the measured average number of iterations per loop entry
+// must also meet a threshold: a loop that is entered often but only runs for an iteration
+// or two does not benefit from the padding.
+//
 // Depends on the loop table, and on block weights being set.
 //
 void Compiler::optIdentifyLoopsForAlignment()
@@ -2749,7 +2753,56 @@ void Compiler::optIdentifyLoopsForAlignment()
             {
                 BasicBlock* top       = optLoopTable[loopInd].lpTop;
                 weight_t    topWeight = top->getBBWeight(this);
-                if (topWeight >= (opts.compJitAlignLoopMinBlockWeight * BB_UNITY_WEIGHT))
+                bool        isHot     = topWeight >= (opts.compJitAlignLoopMinBlockWeight * BB_UNITY_WEIGHT);
+
+                if (isHot && top->hasProfileWeight())
+                {
+                    BasicBlock* const entry       = optLoopTable[loopInd].lpEntry;
+                    weight_t          entryWeight = BB_ZERO_WEIGHT;
+                    bool              entryKnown  = true;
+
+                    for (flowList* const edge : entry->PredEdges())
+                    {
+                        BasicBlock* const predBlock = edge->getBlock();
+
+                        if (optLoopTable[loopInd].lpContains(predBlock))
+                        {
+                            continue;
+                        }
+
+                        if (!predBlock->hasProfileWeight())
+                        {
+                            entryKnown = false;
+                        }
+                        else if (predBlock->NumSucc() == 1)
+                        {
+                            entryWeight += predBlock->bbWeight;
+                        }
+                        else if (fgHaveValidEdgeWeights)
+                        {
+                            entryWeight += edge->edgeWeightMin();
+                        }
+                        else
+                        {
+                            entryKnown = false;
+                        }
+                    }
+
+                    if (entryKnown && (entryWeight > BB_ZERO_WEIGHT))
+                    {
+                        weight_t const iterCount = top->bbWeight / entryWeight;
+
+                        if (iterCount < opts.compJitAlignLoopMinIterCount)
+                        {
+                            JITDUMP(";; Skip alignment for " FMT_LP " that starts at " FMT_BB
+                                    ", it only iterates " FMT_WT " times per entry.\n",
+                                    loopInd, top->bbNum, iterCount);
+                            isHot = false;
+                        }
+                    }
+                }
+
+                if (isHot)
                 {
                     // Sometimes with JitOptRepeat > 1, we might end up finding the loops twice. In such
                     // cases, make sure to count them just once.
@@ -2761,7 +2814,7 @@ void Compiler::optIdentifyLoopsForAlignment()
                                 top->bbNum, top->getBBWeight(this));
                     }
                 }
-                else
+                else if (topWeight < (opts.compJitAlignLoopMinBlockWeight * BB_UNITY_WEIGHT))
                 {
                     JITDUMP(";; Skip alignment for " FMT_LP " that starts at " FMT_BB " weight=" FMT_WT ".\n", loopInd,
                             top->bbNum, topWeight);
@@ -5248,7 +5301,8 @@ PhaseStatus Compiler::optOptimizeFlow()
 //   suitable phase status
 //
 // Notes:
-//   Reorders using profile data, if available.
+//   Reorders using profile data, if available. When JitExtTspLayout is set,
+//   the resulting layout is refined by fgExtTspLayout.
 //
 PhaseStatus Compiler::optOptimizeLayout()
 {
@@ -5258,6 +5312,7 @@ PhaseStatus Compiler::optOptimizeLayout()
 
     madeChanges |= fgUpdateFlowGraph(/* allowTailDuplication */ false);
     madeChanges |= fgReorderBlocks(/* useProfile */ true);
+    madeChanges |= fgExtTspLayout();
     madeChanges |= fgUpdateFlowGraph();
 
     // fgReorderBlocks can cause IR changes even if it does not modify
@@ -8441,7 +8496,16 @@ bool Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
             {
                 GenTree* lhs = tree->AsOp()->gtOp1->gtEffectiveVal(/*commaOnly*/ true);
 
-                if (lhs->OperGet() == GT_IND)
+                GenTreeLclVarCommon* lclVarTree = nullptr;
+                bool                 isEntire   = false;
+
+                // Struct stores to fields and array elements are value numbered precisely (see
+                // "fgValueNumberBlockAssignment"), so treat them just like primitive indirect stores here.
+                const bool isHeapBlkStore = lhs->OperIsBlk() && ((lhs->gtFlags & GTF_IND_VOLATILE) == 0) &&
+                                            (lhs->AsIndir()->Size() != 0) &&
+                                            !tree->DefinesLocal(this, &lclVarTree, &isEntire);
+
+                if ((lhs->OperGet() == GT_IND) || isHeapBlkStore)
                 {
                     GenTree* arg = lhs->AsOp()->gtOp1->gtEffectiveVal(/*commaOnly*/ true);
 
@@ -8511,11 +8575,9 @@ bool Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
                 }
                 else if (lhs->OperIsBlk())
                 {
-                    GenTreeLclVarCommon* lclVarTree;
-                    bool                 isEntire;
                     if (!tree->DefinesLocal(this, &lclVarTree, &isEntire))
                     {
-                        // For now, assume arbitrary side effects on GcHeap/ByrefExposed...
+                        // Volatile or layout-less block stores: assume arbitrary side effects on GcHeap/ByrefExposed...
                         memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
                     }
                     else if (lvaVarAddrExposed(lclVarTree->GetLclNum()))
@@ -9897,6 +9959,17 @@ PhaseStatus Compiler::optOptimizeBools()
 
 typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, unsigned> LclVarRefCounts;
 
+// The bytes of a local covered by the field stores seen before any other reference to it. Once
+// the local has a reference that is not such a store the entry is poisoned and no longer updated.
+struct LclVarFieldDefs
+{
+    uint64_t coveredBytes;
+    unsigned defCount;
+    bool     poisoned;
+};
+
+typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, LclVarFieldDefs> LclVarFieldDefsMap;
+
 //------------------------------------------------------------------------------------------
 // optRemoveRedundantZeroInits: Remove redundant zero intializations.
 //
@@ -9917,6 +9990,9 @@ typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, unsigned> Lc
 //            either the local has no gc pointers or there are no gc-safe points between the prolog and the assignment,
 //         then the local is marked with lvHasExplicitInit which tells the codegen not to insert zero initialization
 //         for this local in the prolog.
+//    A struct local that is not promoted can also be marked with lvHasExplicitInit when it is defined field by
+//    field: the stores are recorded while they are the only references to the local and once they cover all
+//    of it the conditions of 2. are checked as if the last store was an assignment to the entire local.
 
 void Compiler::optRemoveRedundantZeroInits()
 {
@@ -9927,12 +10003,13 @@ void Compiler::optRemoveRedundantZeroInits()
     }
 #endif // DEBUG
 
-    CompAllocator   allocator(getAllocator(CMK_ZeroInit));
-    LclVarRefCounts refCounts(allocator);
-    BitVecTraits    bitVecTraits(lvaCount, this);
-    BitVec          zeroInitLocals = BitVecOps::MakeEmpty(&bitVecTraits);
-    bool            hasGCSafePoint = false;
-    bool            canThrow       = false;
+    CompAllocator      allocator(getAllocator(CMK_ZeroInit));
+    LclVarRefCounts    refCounts(allocator);
+    LclVarFieldDefsMap fieldDefs(allocator);
+    BitVecTraits       bitVecTraits(lvaCount, this);
+    BitVec             zeroInitLocals = BitVecOps::MakeEmpty(&bitVecTraits);
+    bool               hasGCSafePoint = false;
+    bool               canThrow       = false;
 
     assert(fgStmtListThreaded);
 
@@ -10044,6 +10121,55 @@ void Compiler::optRemoveRedundantZeroInits()
                         // pRefCount can't be null because the local node on the lhs of the assignment
                         // must have already been seen.
                         assert(pRefCount != nullptr);
+
+                        // Field stores to tracked locals may be removed as dead stores later on, so
+                        // they cannot be relied on to initialize gc pointers.
+                        bool                   markedByFieldDefs = false;
+                        LclVarFieldDefs* const pFieldDefs        = fieldDefs.LookupPointer(lclNum);
+                        if (!isEntire && lclVar->OperIs(GT_LCL_FLD) && !lclDsc->lvPromoted &&
+                            !lclDsc->lvIsStructField && (lclDsc->lvExactSize <= 64) &&
+                            (!lclDsc->lvTracked || !lclDsc->HasGCPtr()) &&
+                            ((pFieldDefs == nullptr) || !pFieldDefs->poisoned))
+                        {
+                            // Only field stores that are the sole references to the local so far count.
+                            unsigned const prevDefs = (pFieldDefs != nullptr) ? pFieldDefs->defCount : 0;
+
+                            if ((*pRefCount != prevDefs + 1) || lclDsc->lvHasExplicitInit)
+                            {
+                                // The local had some other reference, later stores do not count.
+                                fieldDefs.Set(lclNum, {0, 0, true}, LclVarFieldDefsMap::Overwrite);
+                            }
+                            else
+                            {
+                                LclVarFieldDefs  newFieldDefs = {0, 0, false};
+                                LclVarFieldDefs& defs         = (pFieldDefs != nullptr) ? *pFieldDefs : newFieldDefs;
+
+                                unsigned const offs    = lclVar->AsLclFld()->GetLclOffs();
+                                unsigned const size    = lclVar->AsLclFld()->GetSize();
+                                unsigned const lclSize = lclDsc->lvExactSize;
+                                assert((offs + size) <= lclSize);
+
+                                uint64_t const sizeMask = (size == 64) ? UINT64_MAX : ((uint64_t(1) << size) - 1);
+                                defs.coveredBytes |= sizeMask << offs;
+                                defs.defCount++;
+                                fieldDefs.Set(lclNum, defs, LclVarFieldDefsMap::Overwrite);
+
+                                uint64_t const lclMask = (lclSize == 64) ? UINT64_MAX : ((uint64_t(1) << lclSize) - 1);
+
+                                if ((defs.coveredBytes == lclMask) && (!canThrow || !lclDsc->lvLiveInOutOfHndlr) &&
+                                    (!lclDsc->HasGCPtr() ||
+                                     (!GetInterruptible() && !hasGCSafePoint && !compMethodRequiresPInvokeFrame())))
+                                {
+                                    // The field stores define the entire local before it is used or reported
+                                    // to the gc, the same as a single assignment would.
+                                    lclDsc->lvHasExplicitInit = 1;
+                                    markedByFieldDefs         = true;
+                                    JITDUMP("Marking V%02u as having an explicit init by %u field stores\n", lclNum,
+                                            defs.defCount);
+                                }
+                            }
+                        }
+
                         if (*pRefCount != 1)
                         {
                             break;
@@ -10106,11 +10232,21 @@ void Compiler::optRemoveRedundantZeroInits()
                                     }
                                 }
 
+                                if (removedExplicitZeroInit && markedByFieldDefs)
+                                {
+                                    // The store completing the field stores is gone, they no longer define the local.
+                                    lclDsc->lvHasExplicitInit = 0;
+                                }
+
                                 if (isEntire)
                                 {
                                     BitVecOps::AddElemD(&bitVecTraits, zeroInitLocals, lclNum);
                                 }
                                 *pRefCount = 0;
+
+                                // Resetting the count would let later references line up with the recorded
+                                // field stores again, which may include the one just removed.
+                                fieldDefs.Set(lclNum, {0, 0, true}, LclVarFieldDefsMap::Overwrite);
                             }
                         }
 
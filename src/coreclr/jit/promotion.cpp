@@ -0,0 +1,901 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "jitpch.h"
+
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+#include "jitstd/algorithm.h"
+
+//------------------------------------------------------------------------
+// Physical Promotion
+//
+// Struct promotion (fgPromoteStructs) replaces a struct local by one local
+// per field, and gives up on structs that have too many fields, that have
+// overlapping fields, or that are only partially accessed. Such structs stay
+// in memory, and every access to one of their fields is a memory access,
+// even in the hottest loop of the method.
+//
+// This phase runs after global morph, by which point field accesses of
+// those structs are LCL_FLD nodes. It picks the primitive fields that are
+// accessed often enough, weighted by block weights so profile data is taken
+// into account, and gives each of them a "replacement" local of its own.
+// Accesses of those fields are then rewritten to use the replacements.
+//
+// The struct's memory remains the home of its fields at block boundaries.
+// Within a block, a replacement is read back from the struct before its
+// first use, and is written back to the struct at the end of the block and
+// before anything in the block can observe the memory it replaces (a use of
+// the whole struct, or an access overlapping the replacement). Replacements
+// therefore never live across blocks.
+//
+// Block copies and zero inits whose destination has replacements are split
+// into one assignment per replacement plus copies of the remaining bytes,
+// so the promoted fields can stay in registers across the copy.
+//
+// Restrictions:
+//  * Only unpromoted, non address exposed TYP_STRUCT locals whose address
+//    is not taken after morph are considered.
+//  * Only TYP_INT, TYP_LONG, TYP_REF, TYP_BYREF, TYP_FLOAT and TYP_DOUBLE
+//    fields get replacements, and replacements never overlap.
+//  * Within EH regions replacements are only used for reads, so the struct
+//    memory is up to date whenever an exception can be thrown.
+//
+// Possible enhancements:
+//  * Use liveness to keep replacements in registers across blocks.
+//  * Support small typed and SIMD fields.
+//------------------------------------------------------------------------
+
+// A primitive field of a struct local that has a local of its own.
+struct Replacement
+{
+    unsigned  Offset;
+    var_types AccessType;
+    unsigned  LclNum;
+    // The struct memory may hold a newer value than the replacement local.
+    bool NeedsReadBack;
+    // The replacement local may hold a newer value than the struct memory.
+    bool NeedsWriteBack;
+    // The statement being rewritten accesses the replacement's bytes in
+    // a way that must go through the struct memory.
+    bool Blocked;
+
+    Replacement(unsigned offset, var_types accessType, unsigned lclNum)
+        : Offset(offset)
+        , AccessType(accessType)
+        , LclNum(lclNum)
+        , NeedsReadBack(true)
+        , NeedsWriteBack(false)
+        , Blocked(false)
+    {
+    }
+
+    bool Overlaps(unsigned offset, unsigned size) const
+    {
+        return (offset < Offset + genTypeSize(AccessType)) && (Offset < offset + size);
+    }
+};
+
+// A primitive typed access of a candidate struct local, with the summed
+// weight of the blocks it appears in.
+struct Access
+{
+    unsigned  Offset;
+    var_types AccessType;
+    weight_t  CountWtd;
+
+    Access(unsigned offset, var_types accessType, weight_t countWtd)
+        : Offset(offset), AccessType(accessType), CountWtd(countWtd)
+    {
+    }
+};
+
+// An appearance of a struct local with replacements in the statement
+// being rewritten.
+struct LocalUse
+{
+    GenTree**    Use;
+    unsigned     LclNum;
+    unsigned     Offset;
+    unsigned     Size;
+    Replacement* Match;
+    bool         IsDef;
+};
+
+typedef jitstd::vector<Access>      AccessList;
+typedef jitstd::vector<Replacement> ReplacementList;
+
+class PhysicalPromotion
+{
+    // Most pieces a decomposed block copy may copy outside of replacements.
+    // Copies with more are left as they are.
+    static const unsigned MaxRemainderChunks = 4;
+
+    Compiler*                m_compiler;
+    unsigned                 m_numLocals;
+    AccessList**             m_accesses;
+    ReplacementList**        m_replacements;
+    jitstd::vector<unsigned> m_promotedLocals;
+    ArrayStack<LocalUse>     m_uses;
+
+public:
+    PhysicalPromotion(Compiler* compiler)
+        : m_compiler(compiler)
+        , m_numLocals(compiler->lvaCount)
+        , m_accesses(nullptr)
+        , m_replacements(nullptr)
+        , m_promotedLocals(compiler->getAllocator(CMK_Promotion))
+        , m_uses(compiler->getAllocator(CMK_Promotion))
+    {
+    }
+
+    PhaseStatus Run();
+
+    void RecordAccess(GenTreeLclVarCommon* lcl, weight_t weight);
+    void RecordUse(GenTree** use);
+
+private:
+    bool IsCandidate(unsigned lclNum);
+    bool PickReplacements(unsigned lclNum);
+    void RewriteBlock(BasicBlock* block);
+    void RewriteStatement(BasicBlock* block, Statement* stmt);
+    bool TryDecomposeCopy(BasicBlock* block, Statement* stmt);
+
+    Replacement* FindReplacement(unsigned lclNum, unsigned offset, var_types type);
+    GenTree*     CreateWriteBack(unsigned structLclNum, const Replacement& rep);
+    GenTree*     CreateReadBack(unsigned structLclNum, const Replacement& rep);
+    void         InsertBefore(BasicBlock* block, Statement* stmt, GenTree* tree);
+
+    static bool IsPromotableType(var_types type)
+    {
+        switch (type)
+        {
+            case TYP_INT:
+            case TYP_LONG:
+            case TYP_REF:
+            case TYP_BYREF:
+            case TYP_FLOAT:
+            case TYP_DOUBLE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool HasReplacements(unsigned lclNum) const
+    {
+        return (lclNum < m_numLocals) && (m_replacements[lclNum] != nullptr);
+    }
+};
+
+//------------------------------------------------------------------------
+// AccessCollector: visitor that records the accesses of candidate locals
+//   in a statement.
+//
+class AccessCollector final : public GenTreeVisitor<AccessCollector>
+{
+    PhysicalPromotion* m_promotion;
+    weight_t           m_weight;
+
+public:
+    enum
+    {
+        DoPreOrder    = true,
+        DoLclVarsOnly = true,
+    };
+
+    AccessCollector(Compiler* compiler, PhysicalPromotion* promotion, weight_t weight)
+        : GenTreeVisitor<AccessCollector>(compiler), m_promotion(promotion), m_weight(weight)
+    {
+    }
+
+    fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+    {
+        m_promotion->RecordAccess((*use)->AsLclVarCommon(), m_weight);
+        return fgWalkResult::WALK_CONTINUE;
+    }
+};
+
+//------------------------------------------------------------------------
+// UseCollector: visitor that records the appearances of locals with
+//   replacements in a statement.
+//
+class UseCollector final : public GenTreeVisitor<UseCollector>
+{
+    PhysicalPromotion* m_promotion;
+
+public:
+    enum
+    {
+        DoPreOrder    = true,
+        DoLclVarsOnly = true,
+    };
+
+    UseCollector(Compiler* compiler, PhysicalPromotion* promotion)
+        : GenTreeVisitor<UseCollector>(compiler), m_promotion(promotion)
+    {
+    }
+
+    fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+    {
+        m_promotion->RecordUse(use);
+        return fgWalkResult::WALK_CONTINUE;
+    }
+};
+
+//------------------------------------------------------------------------
+// Run: find struct fields worth promoting and rewrite their accesses.
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus PhysicalPromotion::Run()
+{
+    CompAllocator allocator     = m_compiler->getAllocator(CMK_Promotion);
+    bool          anyCandidates = false;
+
+    m_accesses = new (m_compiler, CMK_Promotion) AccessList*[m_numLocals];
+
+    for (unsigned lclNum = 0; lclNum < m_numLocals; lclNum++)
+    {
+        m_accesses[lclNum] = nullptr;
+        if (IsCandidate(lclNum))
+        {
+            m_accesses[lclNum] = new (m_compiler, CMK_Promotion) AccessList(allocator);
+            anyCandidates      = true;
+        }
+    }
+
+    if (!anyCandidates)
+    {
+        JITDUMP("No struct locals to consider\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    for (BasicBlock* const block : m_compiler->Blocks())
+    {
+        AccessCollector collector(m_compiler, this, block->getBBWeight(m_compiler));
+        for (Statement* const stmt : block->Statements())
+        {
+            collector.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
+    }
+
+    m_replacements = new (m_compiler, CMK_Promotion) ReplacementList*[m_numLocals];
+    for (unsigned lclNum = 0; lclNum < m_numLocals; lclNum++)
+    {
+        m_replacements[lclNum] = nullptr;
+    }
+
+    for (unsigned lclNum = 0; lclNum < m_numLocals; lclNum++)
+    {
+        if ((m_accesses[lclNum] != nullptr) && PickReplacements(lclNum))
+        {
+            m_promotedLocals.push_back(lclNum);
+        }
+    }
+
+    if (m_promotedLocals.size() == 0)
+    {
+        JITDUMP("No struct fields are worth promoting\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    for (BasicBlock* const block : m_compiler->Blocks())
+    {
+        RewriteBlock(block);
+    }
+
+    return PhaseStatus::MODIFIED_EVERYTHING;
+}
+
+//------------------------------------------------------------------------
+// IsCandidate: see if a local may have fields promoted by this phase.
+//
+// Arguments:
+//    lclNum - the local
+//
+// Returns:
+//    True if accesses of the local should be collected.
+//
+bool PhysicalPromotion::IsCandidate(unsigned lclNum)
+{
+    LclVarDsc* const dsc = m_compiler->lvaGetDesc(lclNum);
+
+    if ((dsc->TypeGet() != TYP_STRUCT) || dsc->lvPromoted || dsc->lvIsStructField || dsc->IsAddressExposed())
+    {
+        return false;
+    }
+
+    // Return buffer locals need no check here: the call takes their address,
+    // which RecordAccess rejects.
+    if (dsc->lvIsUnsafeBuffer)
+    {
+        return false;
+    }
+
+    // Jmp calls pass the parameters on in their home locations, and varargs
+    // parameters are not stored in the usual way.
+    if (dsc->lvIsParam && (m_compiler->compJmpOpUsed || m_compiler->info.compIsVarArgs))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// RecordAccess: record an appearance of a local in the IR.
+//
+// Arguments:
+//    lcl    - the local node
+//    weight - weight of the block the node appears in
+//
+void PhysicalPromotion::RecordAccess(GenTreeLclVarCommon* lcl, weight_t weight)
+{
+    unsigned const lclNum = lcl->GetLclNum();
+    if ((lclNum >= m_numLocals) || (m_accesses[lclNum] == nullptr))
+    {
+        return;
+    }
+
+    if (lcl->OperIs(GT_LCL_VAR_ADDR, GT_LCL_FLD_ADDR))
+    {
+        JITDUMP("V%02u has its address taken, not promoting its fields\n", lclNum);
+        m_accesses[lclNum] = nullptr;
+        return;
+    }
+
+    // Uses of the whole struct and other non primitive accesses are handled
+    // by writing back replacements around them; they do not need recording.
+    if (!lcl->OperIs(GT_LCL_FLD) || !IsPromotableType(lcl->TypeGet()))
+    {
+        return;
+    }
+
+    unsigned const  offset = lcl->GetLclOffs();
+    var_types const type   = lcl->TypeGet();
+
+    for (Access& access : *m_accesses[lclNum])
+    {
+        if ((access.Offset == offset) && (access.AccessType == type))
+        {
+            access.CountWtd += weight;
+            return;
+        }
+    }
+
+    m_accesses[lclNum]->push_back(Access(offset, type, weight));
+}
+
+//------------------------------------------------------------------------
+// PickReplacements: decide which fields of a struct local to promote and
+//   create replacement locals for them.
+//
+// Arguments:
+//    lclNum - the struct local
+//
+// Returns:
+//    True if any replacements were created.
+//
+// Notes:
+//    Accesses are considered hottest first. An access is promoted when it
+//    does not overlap an access that has been promoted already, and when
+//    it is executed often enough for the read back and write back of the
+//    replacement to be paid for.
+//
+bool PhysicalPromotion::PickReplacements(unsigned lclNum)
+{
+    AccessList& accesses = *m_accesses[lclNum];
+
+    jitstd::sort(accesses.begin(), accesses.end(),
+                 [](const Access& a1, const Access& a2) { return a1.CountWtd > a2.CountWtd; });
+
+    ReplacementList* replacements = nullptr;
+
+    for (const Access& access : accesses)
+    {
+        if (access.CountWtd < 2 * BB_UNITY_WEIGHT)
+        {
+            break;
+        }
+
+        if (m_compiler->lvaCount >= (unsigned)JitConfig.JitMaxLocalsToTrack())
+        {
+            JITDUMP("Too many locals, not creating more replacements\n");
+            break;
+        }
+
+        bool overlaps = false;
+        if (replacements != nullptr)
+        {
+            for (const Replacement& rep : *replacements)
+            {
+                if (rep.Overlaps(access.Offset, genTypeSize(access.AccessType)))
+                {
+                    overlaps = true;
+                    break;
+                }
+            }
+        }
+
+        if (overlaps)
+        {
+            continue;
+        }
+
+        if (replacements == nullptr)
+        {
+            replacements =
+                new (m_compiler, CMK_Promotion) ReplacementList(m_compiler->getAllocator(CMK_Promotion));
+        }
+
+        unsigned const repLclNum = m_compiler->lvaGrabTemp(false DEBUGARG("physical promotion replacement"));
+        m_compiler->lvaGetDesc(repLclNum)->lvType = access.AccessType;
+        replacements->push_back(Replacement(access.Offset, access.AccessType, repLclNum));
+
+        JITDUMP("V%02u.[%03u..%03u) (%s, weight " FMT_WT ") promoted to V%02u\n", lclNum, access.Offset,
+                access.Offset + genTypeSize(access.AccessType), varTypeName(access.AccessType), access.CountWtd,
+                repLclNum);
+    }
+
+    if (replacements == nullptr)
+    {
+        return false;
+    }
+
+    jitstd::sort(replacements->begin(), replacements->end(),
+                 [](const Replacement& r1, const Replacement& r2) { return r1.Offset < r2.Offset; });
+
+    m_replacements[lclNum] = replacements;
+    m_compiler->lvaSetVarDoNotEnregister(lclNum DEBUGARG(DoNotEnregisterReason::LocalField));
+    return true;
+}
+
+//------------------------------------------------------------------------
+// FindReplacement: find the replacement of an exact field access.
+//
+// Arguments:
+//    lclNum - the struct local
+//    offset - offset of the access
+//    type   - type of the access
+//
+// Returns:
+//    The replacement, or nullptr if the access has none.
+//
+Replacement* PhysicalPromotion::FindReplacement(unsigned lclNum, unsigned offset, var_types type)
+{
+    if (!HasReplacements(lclNum))
+    {
+        return nullptr;
+    }
+
+    for (Replacement& rep : *m_replacements[lclNum])
+    {
+        if ((rep.Offset == offset) && (rep.AccessType == type))
+        {
+            return &rep;
+        }
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------
+// RecordUse: record an appearance of a local with replacements in the
+//   statement being rewritten.
+//
+// Arguments:
+//    use - the use edge of the local node
+//
+void PhysicalPromotion::RecordUse(GenTree** use)
+{
+    GenTreeLclVarCommon* const lcl    = (*use)->AsLclVarCommon();
+    unsigned const             lclNum = lcl->GetLclNum();
+
+    if (!HasReplacements(lclNum))
+    {
+        return;
+    }
+
+    LocalUse localUse;
+    localUse.Use    = use;
+    localUse.LclNum = lclNum;
+    localUse.IsDef  = (lcl->gtFlags & GTF_VAR_DEF) != 0;
+
+    if (lcl->OperIs(GT_LCL_FLD))
+    {
+        localUse.Offset = lcl->GetLclOffs();
+        localUse.Size   = lcl->AsLclFld()->GetSize();
+        localUse.Match  = FindReplacement(lclNum, localUse.Offset, lcl->TypeGet());
+    }
+    else
+    {
+        assert(lcl->OperIs(GT_LCL_VAR));
+        localUse.Offset = 0;
+        localUse.Size   = m_compiler->lvaLclExactSize(lclNum);
+        localUse.Match  = nullptr;
+    }
+
+    m_uses.Push(localUse);
+}
+
+//------------------------------------------------------------------------
+// CreateWriteBack: create an assignment storing a replacement back to the
+//   struct memory.
+//
+GenTree* PhysicalPromotion::CreateWriteBack(unsigned structLclNum, const Replacement& rep)
+{
+    GenTree* dst = m_compiler->gtNewLclFldNode(structLclNum, rep.AccessType, rep.Offset);
+    GenTree* src = m_compiler->gtNewLclvNode(rep.LclNum, rep.AccessType);
+    return m_compiler->gtNewAssignNode(dst, src);
+}
+
+//------------------------------------------------------------------------
+// CreateReadBack: create an assignment loading a replacement from the
+//   struct memory.
+//
+GenTree* PhysicalPromotion::CreateReadBack(unsigned structLclNum, const Replacement& rep)
+{
+    GenTree* dst = m_compiler->gtNewLclvNode(rep.LclNum, rep.AccessType);
+    GenTree* src = m_compiler->gtNewLclFldNode(structLclNum, rep.AccessType, rep.Offset);
+    return m_compiler->gtNewAssignNode(dst, src);
+}
+
+//------------------------------------------------------------------------
+// InsertBefore: insert a new statement for a tree before a statement.
+//
+void PhysicalPromotion::InsertBefore(BasicBlock* block, Statement* stmt, GenTree* tree)
+{
+    Statement* const newStmt = m_compiler->fgNewStmtFromTree(tree, stmt->GetDebugInfo());
+    m_compiler->fgInsertStmtBefore(block, stmt, newStmt);
+    DISPSTMT(newStmt);
+}
+
+//------------------------------------------------------------------------
+// RewriteBlock: rewrite the accesses of promoted fields in a block.
+//
+// Arguments:
+//    block - the block
+//
+void PhysicalPromotion::RewriteBlock(BasicBlock* block)
+{
+    JITDUMP("Rewriting " FMT_BB "\n", block->bbNum);
+
+    Statement* stmt = block->firstStmt();
+    while (stmt != nullptr)
+    {
+        Statement* const next = stmt->GetNextStmt();
+        if (!TryDecomposeCopy(block, stmt))
+        {
+            RewriteStatement(block, stmt);
+        }
+        stmt = next;
+    }
+
+    // Struct memory must be up to date when leaving the block. Returns and
+    // throws have already written back anything their last statement needs.
+    bool const needsWriteBacks = !block->KindIs(BBJ_RETURN, BBJ_THROW);
+
+    for (unsigned lclNum : m_promotedLocals)
+    {
+        for (Replacement& rep : *m_replacements[lclNum])
+        {
+            if (needsWriteBacks && rep.NeedsWriteBack)
+            {
+                GenTree* const writeBack = CreateWriteBack(lclNum, rep);
+                m_compiler->fgNewStmtNearEnd(block, writeBack);
+                DISPTREE(writeBack);
+            }
+
+            rep.NeedsReadBack  = true;
+            rep.NeedsWriteBack = false;
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// RewriteStatement: rewrite the accesses of promoted fields in a statement,
+//   adding read backs and write backs before it as necessary.
+//
+// Arguments:
+//    block - the block containing the statement
+//    stmt  - the statement
+//
+void PhysicalPromotion::RewriteStatement(BasicBlock* block, Statement* stmt)
+{
+    m_uses.Reset();
+    UseCollector collector(m_compiler, this);
+    collector.WalkTree(stmt->GetRootNodePointer(), nullptr);
+
+    if (m_uses.Height() == 0)
+    {
+        return;
+    }
+
+    // Defs must go to the struct memory if an exception can observe it, or
+    // if there is no place after the statement to write replacements back.
+    bool const defsToMemory = block->hasTryIndex() || block->hasHndIndex() ||
+                              ((stmt == block->lastStmt()) && block->KindIs(BBJ_COND, BBJ_SWITCH, BBJ_RETURN));
+
+    for (int i = 0; i < m_uses.Height(); i++)
+    {
+        LocalUse& use = m_uses.BottomRef(i);
+        if ((use.Match != nullptr) && !(use.IsDef && defsToMemory))
+        {
+            continue;
+        }
+
+        for (Replacement& rep : *m_replacements[use.LclNum])
+        {
+            if (rep.Overlaps(use.Offset, use.Size))
+            {
+                rep.Blocked = true;
+            }
+        }
+    }
+
+    for (int i = 0; i < m_uses.Height(); i++)
+    {
+        LocalUse& use = m_uses.BottomRef(i);
+
+        for (Replacement& rep : *m_replacements[use.LclNum])
+        {
+            if (rep.Blocked && rep.NeedsWriteBack)
+            {
+                InsertBefore(block, stmt, CreateWriteBack(use.LclNum, rep));
+                rep.NeedsWriteBack = false;
+            }
+        }
+
+        Replacement* const rep = use.Match;
+        if ((rep != nullptr) && !rep->Blocked && !use.IsDef && rep->NeedsReadBack)
+        {
+            InsertBefore(block, stmt, CreateReadBack(use.LclNum, *rep));
+            rep->NeedsReadBack = false;
+        }
+    }
+
+    for (int i = 0; i < m_uses.Height(); i++)
+    {
+        LocalUse&          use = m_uses.BottomRef(i);
+        Replacement* const rep = use.Match;
+
+        if ((rep != nullptr) && !rep->Blocked)
+        {
+            GenTree* const lcl    = *use.Use;
+            GenTree* const newLcl = m_compiler->gtNewLclvNode(rep->LclNum, rep->AccessType);
+            newLcl->gtFlags |= lcl->gtFlags & (GTF_VAR_DEF | GTF_DONT_CSE);
+            *use.Use = newLcl;
+
+            if (use.IsDef)
+            {
+                rep->NeedsReadBack  = false;
+                rep->NeedsWriteBack = true;
+            }
+        }
+        else if (use.IsDef)
+        {
+            for (Replacement& overlapped : *m_replacements[use.LclNum])
+            {
+                if (overlapped.Overlaps(use.Offset, use.Size))
+                {
+                    overlapped.NeedsReadBack  = true;
+                    overlapped.NeedsWriteBack = false;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < m_uses.Height(); i++)
+    {
+        for (Replacement& rep : *m_replacements[m_uses.BottomRef(i).LclNum])
+        {
+            rep.Blocked = false;
+        }
+    }
+
+    JITDUMPEXEC(m_compiler->gtDispStmt(stmt));
+}
+
+//------------------------------------------------------------------------
+// TryDecomposeCopy: split a copy or zero init of a struct local with
+//   replacements into assignments of its replacements and of the bytes
+//   between them.
+//
+// Arguments:
+//    block - the block containing the statement
+//    stmt  - the statement
+//
+// Returns:
+//    True if the statement was decomposed and removed.
+//
+bool PhysicalPromotion::TryDecomposeCopy(BasicBlock* block, Statement* stmt)
+{
+    GenTree* const root = stmt->GetRootNode();
+    if (!root->OperIs(GT_ASG) || !root->gtGetOp1()->OperIs(GT_LCL_VAR))
+    {
+        return false;
+    }
+
+    unsigned const dstLclNum = root->gtGetOp1()->AsLclVarCommon()->GetLclNum();
+    if (!HasReplacements(dstLclNum) || block->hasTryIndex() || block->hasHndIndex())
+    {
+        return false;
+    }
+
+    GenTree* src = root->gtGetOp2();
+    if (src->OperIs(GT_INIT_VAL))
+    {
+        src = src->gtGetOp1();
+    }
+
+    bool     isInit    = false;
+    unsigned srcLclNum = BAD_VAR_NUM;
+
+    if (src->IsIntegralConst(0))
+    {
+        isInit = true;
+    }
+    else if (src->OperIs(GT_LCL_VAR))
+    {
+        srcLclNum = src->AsLclVarCommon()->GetLclNum();
+        if ((srcLclNum == dstLclNum) || (m_compiler->lvaGetDesc(srcLclNum)->TypeGet() != TYP_STRUCT) ||
+            m_compiler->lvaGetDesc(srcLclNum)->lvPromoted ||
+            !ClassLayout::AreCompatible(m_compiler->lvaGetDesc(srcLclNum)->GetLayout(),
+                                        m_compiler->lvaGetDesc(dstLclNum)->GetLayout()))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    ClassLayout* const     layout       = m_compiler->lvaGetDesc(dstLclNum)->GetLayout();
+    unsigned const         size         = m_compiler->lvaLclExactSize(dstLclNum);
+    ReplacementList* const replacements = m_replacements[dstLclNum];
+
+    // Compute the pieces of the struct that are not covered by replacements.
+    struct Chunk
+    {
+        unsigned  Offset;
+        var_types Type;
+    };
+
+    Chunk    chunks[MaxRemainderChunks];
+    unsigned numChunks = 0;
+    unsigned start     = 0;
+
+    for (unsigned i = 0; i <= replacements->size(); i++)
+    {
+        unsigned const end = (i < replacements->size()) ? (*replacements)[i].Offset : size;
+        while (start < end)
+        {
+            var_types type;
+            unsigned  remaining = end - start;
+            if (((start % TARGET_POINTER_SIZE) == 0) && (remaining >= TARGET_POINTER_SIZE))
+            {
+                type = layout->GetGCPtrType(start / TARGET_POINTER_SIZE);
+            }
+            else if (((start % 4) == 0) && (remaining >= 4))
+            {
+                type = TYP_INT;
+            }
+            else if (((start % 2) == 0) && (remaining >= 2))
+            {
+                type = TYP_USHORT;
+            }
+            else
+            {
+                type = TYP_UBYTE;
+            }
+
+            if (numChunks == MaxRemainderChunks)
+            {
+                JITDUMP("Too many remainder pieces to decompose " FMT_STMT "\n", stmt->GetID());
+                return false;
+            }
+
+            chunks[numChunks].Offset = start;
+            chunks[numChunks].Type   = type;
+            numChunks++;
+            start += genTypeSize(type);
+        }
+
+        if (i < replacements->size())
+        {
+            start = end + genTypeSize((*replacements)[i].AccessType);
+        }
+    }
+
+    JITDUMP("Decomposing " FMT_STMT " into %u replacement and %u remainder assignments\n", stmt->GetID(),
+            (unsigned)replacements->size(), numChunks);
+
+    // Source fields that are not copied replacement to replacement are read
+    // from the source's memory, so it must be up to date.
+    if (HasReplacements(srcLclNum))
+    {
+        for (Replacement& srcRep : *m_replacements[srcLclNum])
+        {
+            if (srcRep.NeedsWriteBack && (FindReplacement(dstLclNum, srcRep.Offset, srcRep.AccessType) == nullptr))
+            {
+                InsertBefore(block, stmt, CreateWriteBack(srcLclNum, srcRep));
+                srcRep.NeedsWriteBack = false;
+            }
+        }
+    }
+
+    for (Replacement& rep : *replacements)
+    {
+        GenTree* value;
+        if (isInit)
+        {
+            value = m_compiler->gtNewZeroConNode(rep.AccessType);
+        }
+        else
+        {
+            Replacement* const srcRep = FindReplacement(srcLclNum, rep.Offset, rep.AccessType);
+            if ((srcRep != nullptr) && !srcRep->NeedsReadBack)
+            {
+                value = m_compiler->gtNewLclvNode(srcRep->LclNum, rep.AccessType);
+            }
+            else
+            {
+                value = m_compiler->gtNewLclFldNode(srcLclNum, rep.AccessType, rep.Offset);
+            }
+        }
+
+        GenTree* const dst = m_compiler->gtNewLclvNode(rep.LclNum, rep.AccessType);
+        InsertBefore(block, stmt, m_compiler->gtNewAssignNode(dst, value));
+        rep.NeedsReadBack  = false;
+        rep.NeedsWriteBack = true;
+    }
+
+    for (unsigned i = 0; i < numChunks; i++)
+    {
+        var_types const type = chunks[i].Type;
+        GenTree*        value;
+        if (isInit)
+        {
+            value = m_compiler->gtNewZeroConNode(genActualType(type));
+        }
+        else
+        {
+            value = m_compiler->gtNewLclFldNode(srcLclNum, type, chunks[i].Offset);
+        }
+
+        GenTree* const dst = m_compiler->gtNewLclFldNode(dstLclNum, type, chunks[i].Offset);
+        InsertBefore(block, stmt, m_compiler->gtNewAssignNode(dst, value));
+    }
+
+    if (!isInit)
+    {
+        m_compiler->lvaSetVarDoNotEnregister(srcLclNum DEBUGARG(DoNotEnregisterReason::LocalField));
+    }
+
+    m_compiler->fgRemoveStmt(block, stmt);
+    return true;
+}
+
+//------------------------------------------------------------------------
+// fgPhysicalPromotion: promote frequently accessed fields of struct locals
+//   that struct promotion left in memory.
+//
+// Returns:
+//    Suitable phase status.
+//
+PhaseStatus Compiler::fgPhysicalPromotion()
+{
+    if (!opts.OptimizationEnabled() ||
+        ((JitConfig.JitEnablePhysicalPromotion() == 0) && !compStressCompile(STRESS_PHYSICAL_PROMOTION, 25)))
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    PhysicalPromotion promotion(this);
+    return promotion.Run();
+}
@@ -293,6 +293,26 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
         return;
     }
 
+    // If the index is bounded by some other checked bound (e.g. "i < n"), see if the assertions
+    // tell us that bound is itself bounded by the length we are checking against (e.g. "n <= a.Length").
+    if (range.UpperLimit().IsBinOpArray() && (range.UpperLimit().vn != arrLenVn))
+    {
+        JITDUMP("Looking for assertions bounding upper limit " FMT_VN " by the length\n", range.UpperLimit().vn);
+        Range bndRange = Range(Limit(Limit::keDependent));
+        MergeEdgeAssertions(range.UpperLimit().vn, block->bbAssertionIn, &bndRange);
+
+        Limit bndLimit = bndRange.UpperLimit();
+        if ((bndLimit.IsBinOpArray() && (bndLimit.vn == arrLenVn)) || bndLimit.IsConstant())
+        {
+            if (bndLimit.AddConstant(range.UpperLimit().GetConstant()))
+            {
+                range.uLimit = bndLimit;
+                JITDUMP("Upper limit substituted, range is now %s\n",
+                        range.ToString(m_pCompiler->getAllocatorDebugOnly()));
+            }
+        }
+    }
+
     // Is the range between the lower and upper bound values.
     if (BetweenBounds(range, bndsChk->GetArrayLength(), arrSize))
     {
@@ -689,7 +709,7 @@ void RangeCheck::MergeEdgeAssertions(ValueNum normalLclVN, ASSERT_VALARG_TP asse
             int cnstLimit = m_pCompiler->vnStore->CoercedConstantValue<int>(curAssertion->op2.vn);
 
             if ((cnstLimit == 0) && (curAssertion->assertionKind == Compiler::OAK_NOT_EQUAL) &&
-                m_pCompiler->vnStore->IsVNCheckedBound(curAssertion->op1.vn))
+                m_pCompiler->vnStore->IsVNNonNegativeCheckedBound(curAssertion->op1.vn))
             {
                 // we have arr.Len != 0, so the length must be atleast one
                 limit   = Limit(Limit::keConstant, 1);
@@ -1415,7 +1435,7 @@ Range RangeCheck::ComputeRange(BasicBlock* block, GenTree* expr, bool monIncreas
             MergeAssertion(block, use.GetNode(), &argRange DEBUGARG(indent + 1));
             JITDUMP("Merging ranges %s %s:", range.ToString(m_pCompiler->getAllocatorDebugOnly()),
                     argRange.ToString(m_pCompiler->getAllocatorDebugOnly()));
-            range = RangeOps::Merge(range, argRange, monIncreasing);
+            range = RangeOps::Merge(range, argRange, monIncreasing, m_pCompiler->vnStore);
             JITDUMP("%s\n", range.ToString(m_pCompiler->getAllocatorDebugOnly()));
         }
     }
@@ -435,7 +435,8 @@ struct RangeOps
 
     // Given two ranges "r1" and "r2", do a Phi merge. If "monIncreasing" is true,
     // then ignore the dependent variables for the lower bound but not for the upper bound.
-    static Range Merge(Range& r1, Range& r2, bool monIncreasing)
+    // "vnStore" tells which checked bounds are known to be non-negative.
+    static Range Merge(Range& r1, Range& r2, bool monIncreasing, ValueNumStore* vnStore)
     {
         Limit& r1lo = r1.LowerLimit();
         Limit& r1hi = r1.UpperLimit();
@@ -498,14 +499,15 @@ struct RangeOps
         // Widen Upper Limit => Max(k, (a.len + n)) yields (a.len + n),
         // This is correct if k >= 0 and n >= k, since a.len always >= 0
         // (a.len + n) could overflow, but the result (a.len + n) also
-        // preserves the overflow.
+        // preserves the overflow. Bounds that are only compared against
+        // a length may be negative, so they are not widened to.
         if (r1hi.IsConstant() && r1hi.GetConstant() >= 0 && r2hi.IsBinOpArray() &&
-            r2hi.GetConstant() >= r1hi.GetConstant())
+            r2hi.GetConstant() >= r1hi.GetConstant() && vnStore->IsVNNonNegativeCheckedBound(r2hi.vn))
         {
             result.uLimit = r2hi;
         }
         if (r2hi.IsConstant() && r2hi.GetConstant() >= 0 && r1hi.IsBinOpArray() &&
-            r1hi.GetConstant() >= r2hi.GetConstant())
+            r1hi.GetConstant() >= r2hi.GetConstant() && vnStore->IsVNNonNegativeCheckedBound(r1hi.vn))
         {
             result.uLimit = r1hi;
         }
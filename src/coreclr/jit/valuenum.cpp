@@ -5694,6 +5694,29 @@ void ValueNumStore::SetVNIsCheckedBound(ValueNum vn)
     m_checkedBoundVNs.AddOrUpdate(vn, true);
 }
 
+void ValueNumStore::SetVNIsComparedCheckedBound(ValueNum vn)
+{
+    assert(!IsVNConstant(vn));
+
+    // Don't downgrade an actual length.
+    bool isLength;
+    if (!m_checkedBoundVNs.TryGetValue(vn, &isLength))
+    {
+        m_checkedBoundVNs.AddOrUpdate(vn, false);
+    }
+}
+
+bool ValueNumStore::IsVNNonNegativeCheckedBound(ValueNum vn)
+{
+    bool isLength;
+    if (m_checkedBoundVNs.TryGetValue(vn, &isLength))
+    {
+        return isLength;
+    }
+
+    return IsVNArrLen(vn);
+}
+
 ValueNum ValueNumStore::EvalMathFuncUnary(var_types typ, NamedIntrinsic gtMathFN, ValueNum arg0VN)
 {
     assert(arg0VN == VNNormalValue(arg0VN));
@@ -8183,6 +8206,48 @@ void Compiler::fgValueNumberAssignment(GenTreeOp* tree)
     tree->gtVNPair         = vnStore->VNPWithExc(vnStore->VNPForVoid(), asgExcSet);
 }
 
+//------------------------------------------------------------------------
+// fgValueNumberJTrueCheckedBound: Propagate the "checked bound" flag through a
+//    comparison against a checked bound.
+//
+// Arguments:
+//    tree - the GT_JTRUE node
+//
+// Notes:
+//    For a compare like "n > a.Length" the other operand ("n") is flagged as a
+//    checked bound as well. Assertion prop will then create assertions for compares
+//    against it ("i < n"), which range check can relate back to the original bound
+//    via the assertions on "n" itself.
+//
+void Compiler::fgValueNumberJTrueCheckedBound(GenTree* tree)
+{
+    assert(tree->OperIs(GT_JTRUE));
+
+    GenTree* relop = tree->gtGetOp1();
+    if (!relop->OperIs(GT_LT, GT_LE, GT_GT, GT_GE) || relop->IsUnsigned() ||
+        !relop->gtGetOp1()->TypeIs(TYP_INT) || !relop->gtGetOp2()->TypeIs(TYP_INT))
+    {
+        return;
+    }
+
+    ValueNum relopVN = vnStore->VNConservativeNormalValue(relop->gtVNPair);
+    if (!vnStore->IsVNCompareCheckedBound(relopVN))
+    {
+        return;
+    }
+
+    ValueNumStore::CompareCheckedBoundArithInfo info;
+    vnStore->GetCompareCheckedBound(relopVN, &info);
+
+    if (!vnStore->IsVNConstant(info.cmpOp) && !vnStore->IsVNCheckedBound(info.cmpOp) &&
+        (vnStore->TypeOfVN(info.cmpOp) == TYP_INT))
+    {
+        JITDUMP("Flagging " FMT_VN " as a checked bound, it is compared against checked bound " FMT_VN "\n",
+                info.cmpOp, info.vnBound);
+        vnStore->SetVNIsComparedCheckedBound(info.cmpOp);
+    }
+}
+
 //------------------------------------------------------------------------
 // fgValueNumberBlockAssignment: Perform value numbering for block assignments.
 //
@@ -8271,10 +8336,62 @@ void Compiler::fgValueNumberBlockAssignment(GenTree* tree)
             JITDUMP("LHS V%02u not in ssa at [%06u], so no VN assigned\n", lhsLclNum, dspTreeID(lclVarTree));
         }
     }
+    else if (lhs->OperIsIndir() && ((lhs->gtFlags & GTF_IND_VOLATILE) == 0) && (lhs->AsIndir()->Size() != 0))
+    {
+        // Struct stores to instance/static fields and array elements are modeled precisely, just like
+        // the primitive stores in "fgValueNumberAssignment", so that loop side effects (and thus hoisting
+        // and CSE) only need to consider the field or array element type that was actually written.
+        GenTree*  addr        = lhs->AsIndir()->Addr();
+        unsigned  storeSize   = lhs->AsIndir()->Size();
+        GenTree*  baseAddr    = nullptr;
+        FieldSeq* fldSeq      = nullptr;
+        ssize_t   fieldOffset = 0;
+        VNFuncApp funcApp;
+        bool      addrIsVNFunc = vnStore->GetVNFunc(vnStore->VNLiberalNormalValue(addr->gtVNPair), &funcApp);
+
+        ValueNum rhsVN = ValueNumStore::NoVN;
+        if (tree->OperIsInitBlkOp())
+        {
+            ClassLayout* layout = lhs->GetLayout(this);
+            if (rhs->IsIntegralConst(0) && (layout != nullptr) && (layout->GetClassHandle() != NO_CLASS_HANDLE))
+            {
+                rhsVN = vnStore->VNForZeroObj(layout->GetClassHandle());
+            }
+            else
+            {
+                rhsVN = vnStore->VNForExpr(compCurBB, TYP_STRUCT);
+            }
+        }
+        else
+        {
+            assert(tree->OperIsCopyBlkOp());
+            rhsVN = vnStore->VNLiberalNormalValue(rhs->gtVNPair);
+        }
+
+        if (addrIsVNFunc && (funcApp.m_func == VNF_PtrToStatic))
+        {
+            fldSeq      = vnStore->FieldSeqVNToFieldSeq(funcApp.m_args[1]);
+            fieldOffset = vnStore->ConstantValue<ssize_t>(funcApp.m_args[2]);
+
+            fgValueNumberFieldStore(tree, /* baseAddr */ nullptr, fldSeq, fieldOffset, storeSize, rhsVN);
+        }
+        else if (addrIsVNFunc && (funcApp.m_func == VNF_PtrToArrElem))
+        {
+            fgValueNumberArrayElemStore(tree, &funcApp, storeSize, rhsVN);
+        }
+        else if (addr->IsFieldAddr(this, &baseAddr, &fldSeq, &fieldOffset))
+        {
+            assert(fldSeq != nullptr);
+            fgValueNumberFieldStore(tree, baseAddr, fldSeq, fieldOffset, storeSize, rhsVN);
+        }
+        else
+        {
+            fgMutateGcHeap(tree DEBUGARG("INITBLK/COPYBLK - unknown address"));
+        }
+    }
     else
     {
         // For now, arbitrary side effect on GcHeap/ByrefExposed.
-        // TODO-CQ: Why not be complete, and get this case right?
         fgMutateGcHeap(tree DEBUGARG("INITBLK/COPYBLK - non local"));
     }
 
@@ -8818,6 +8935,11 @@ void Compiler::fgValueNumberTree(GenTree* tree)
                     case GT_RETURN:
                     case GT_RETFILT:
                     case GT_NULLCHECK:
+                        if (tree->OperIs(GT_JTRUE))
+                        {
+                            fgValueNumberJTrueCheckedBound(tree);
+                        }
+
                         if (tree->gtGetOp1() != nullptr)
                         {
                             tree->gtVNPair = vnStore->VNPWithExc(vnStore->VNPForVoid(),
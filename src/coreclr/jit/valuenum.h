@@ -770,6 +770,14 @@ public:
     // argument to a GT_BOUNDS_CHECK node.
     void SetVNIsCheckedBound(ValueNum vn);
 
+    // Record that a VN is compared against a checked bound, so that assertions get created for
+    // compares against it as well. Unlike actual lengths, such a bound may be negative.
+    void SetVNIsComparedCheckedBound(ValueNum vn);
+
+    // Returns true if the VN is a checked bound that is known to be non-negative, i. e. it is
+    // not just a bound recorded via "SetVNIsComparedCheckedBound".
+    bool IsVNNonNegativeCheckedBound(ValueNum vn);
+
     // Information about the individual components of a value number representing an unsigned
     // comparison of some value against a checked bound VN.
     struct UnsignedCompareCheckedBoundInfo
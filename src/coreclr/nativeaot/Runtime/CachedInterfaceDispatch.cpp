@@ -55,6 +55,9 @@ extern "C"
     uint32_t CID_g_cCacheReallocates = 0;
     uint32_t CID_g_cCacheAllocates = 0;
     uint32_t CID_g_cCacheDiscards = 0;
+    uint32_t CID_g_cOverflowInserts = 0;
+    uint32_t CID_g_cOverflowHits = 0;
+    uint32_t CID_g_cOverflowInsertsSkipped = 0;
     uint32_t CID_g_cInterfaceDispatches = 0;
     uint32_t CID_g_cbMemoryAllocated = 0;
     uint32_t CID_g_rgAllocatesBySize[CID_MAX_CACHE_SIZE_LOG2 + 1] = { 0 };
@@ -379,6 +382,108 @@ static void DiscardCache(InterfaceDispatchCache * pCache)
 #endif // defined(HOST_AMD64) || defined(HOST_ARM64)
 }
 
+// Mappings for dispatch cells whose cache has reached CID_MAX_CACHE_SIZE. Such cells can't grow their cache
+// any further, so rather than resolving every miss from scratch the mappings are kept in a global, direct
+// mapped table that RhpSearchDispatchCellCache consults when a full cache misses. Entries are immutable once
+// published; an entry displaced from its bucket might still be read by another thread, so like discarded
+// caches it is only recycled at the next GC.
+//
+// Code that keeps missing on colliding mappings without allocating would displace entries without a GC
+// ever recycling them. So once CID_MAX_DISCARDED_OVERFLOW_ENTRIES displaced entries are waiting and none
+// are free, misses are resolved without being recorded until the next GC. This bounds the memory used by
+// the table to about CID_OVERFLOW_TABLE_SIZE + CID_MAX_DISCARDED_OVERFLOW_ENTRIES entries, plus one for
+// each thread that is inserting.
+struct OverflowEntry
+{
+    InterfaceDispatchCell * m_pCell;
+    MethodTable *           m_pInstanceType;
+    PTR_Code                m_pTargetCode;
+    OverflowEntry *         m_pNext;
+};
+
+#define CID_OVERFLOW_TABLE_SIZE_LOG2 10
+#define CID_OVERFLOW_TABLE_SIZE      (1 << CID_OVERFLOW_TABLE_SIZE_LOG2)
+
+#define CID_MAX_DISCARDED_OVERFLOW_ENTRIES CID_OVERFLOW_TABLE_SIZE
+
+static OverflowEntry * volatile g_rgOverflowTable[CID_OVERFLOW_TABLE_SIZE];
+
+// Displaced entries waiting for the next GC, and entries available for reuse. All protected by g_sListLock.
+static OverflowEntry * g_pDiscardedOverflowEntries = NULL;
+static uint32_t g_cDiscardedOverflowEntries = 0;
+static OverflowEntry * g_pFreeOverflowEntries = NULL;
+
+static uint32_t OverflowTableIndex(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    uint32_t hash = (uint32_t)(((uintptr_t)pCell >> 3) ^ ((uintptr_t)pInstanceType >> 3));
+    return (hash * 0x9E3779B1u) >> (32 - CID_OVERFLOW_TABLE_SIZE_LOG2);
+}
+
+static void InsertOverflowEntry(InterfaceDispatchCell * pCell, MethodTable * pInstanceType, PTR_Code pTargetCode)
+{
+    OverflowEntry * pEntry;
+    {
+        CrstHolder lh(&g_sListLock);
+
+        pEntry = g_pFreeOverflowEntries;
+        if (pEntry != NULL)
+        {
+            g_pFreeOverflowEntries = pEntry->m_pNext;
+        }
+        else if (g_cDiscardedOverflowEntries >= CID_MAX_DISCARDED_OVERFLOW_ENTRIES)
+        {
+            // Don't grow the heap for entries that only the next GC can recycle.
+            CID_COUNTER_INC(OverflowInsertsSkipped);
+            return;
+        }
+        else
+        {
+            pEntry = (OverflowEntry *)g_pAllocHeap->Alloc(sizeof(OverflowEntry));
+#ifdef FEATURE_CID_STATS
+            if (pEntry != NULL)
+                CID_g_cbMemoryAllocated += sizeof(OverflowEntry);
+#endif
+        }
+    }
+
+    if (pEntry == NULL)
+    {
+        CID_COUNTER_INC(CacheOutOfMemory);
+        return;
+    }
+
+    pEntry->m_pCell = pCell;
+    pEntry->m_pInstanceType = pInstanceType;
+    pEntry->m_pTargetCode = pTargetCode;
+    pEntry->m_pNext = NULL;
+
+    // The exchange publishes the initialized entry.
+    uint32_t idx = OverflowTableIndex(pCell, pInstanceType);
+    OverflowEntry * pDisplaced = (OverflowEntry *)PalInterlockedExchangePointer((void * volatile *)&g_rgOverflowTable[idx], pEntry);
+    CID_COUNTER_INC(OverflowInserts);
+
+    if (pDisplaced != NULL)
+    {
+        CrstHolder lh(&g_sListLock);
+
+        pDisplaced->m_pNext = g_pDiscardedOverflowEntries;
+        g_pDiscardedOverflowEntries = pDisplaced;
+        g_cDiscardedOverflowEntries++;
+    }
+}
+
+static PTR_Code SearchOverflowTable(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    OverflowEntry * pEntry = g_rgOverflowTable[OverflowTableIndex(pCell, pInstanceType)];
+    if (pEntry != NULL && pEntry->m_pCell == pCell && pEntry->m_pInstanceType == pInstanceType)
+    {
+        CID_COUNTER_INC(OverflowHits);
+        return pEntry->m_pTargetCode;
+    }
+
+    return nullptr;
+}
+
 // Called during a GC to empty the list of discarded caches (which we can now guarantee aren't being accessed)
 // and sort the results into the free lists we maintain for each cache size.
 void ReclaimUnusedInterfaceDispatchCaches()
@@ -430,6 +535,19 @@ void ReclaimUnusedInterfaceDispatchCaches()
 
     // We processed all the discarded entries, so we can simply NULL the list head.
     g_pDiscardedCacheList = NULL;
+
+    // Displaced overflow table entries can't be referenced any more either.
+    OverflowEntry * pEntry = g_pDiscardedOverflowEntries;
+    while (pEntry)
+    {
+        OverflowEntry * pNextEntry = pEntry->m_pNext;
+        pEntry->m_pNext = g_pFreeOverflowEntries;
+        g_pFreeOverflowEntries = pEntry;
+        pEntry = pNextEntry;
+    }
+
+    g_pDiscardedOverflowEntries = NULL;
+    g_cDiscardedOverflowEntries = 0;
 }
 
 // One time initialization of interface dispatch.
@@ -475,12 +593,11 @@ COOP_PINVOKE_HELPER(PTR_Code, RhpUpdateDispatchCellCache, (InterfaceDispatchCell
 
     if (cOldCacheEntries == CID_MAX_CACHE_SIZE)
     {
-        // We already reached the maximum cache size we wish to allocate. For now don't attempt to cache
-        // the mapping we just did: there's no safe way to update the existing cache right now if it
-        // doesn't have an empty entries. There are schemes that would let us do this at the next GC point
-        // but it's not clear whether we should do this or re-tune the cache max size, we need to measure
-        // this.
+        // We already reached the maximum cache size we wish to allocate. There's no safe way to update the
+        // existing cache if it doesn't have an empty entry, so record the mapping in the overflow table
+        // instead, where the next miss for it will find it without resolving the dispatch again.
         CID_COUNTER_INC(CacheSizeOverflows);
+        InsertOverflowEntry(pCell, pInstanceType, pTargetCode);
         return (PTR_Code)pTargetCode;
     }
 
@@ -528,6 +645,9 @@ COOP_PINVOKE_HELPER(PTR_Code, RhpSearchDispatchCellCache, (InterfaceDispatchCell
         for (uint32_t i = 0; i < pCache->m_cEntries; i++, pCacheEntry++)
             if (pCacheEntry->m_pInstanceType == pInstanceType)
                 return (PTR_Code)pCacheEntry->m_pTargetCode;
+
+        if (pCache->m_cEntries == CID_MAX_CACHE_SIZE)
+            return SearchOverflowTable(pCell, pInstanceType);
     }
 
     return nullptr;
@@ -27,7 +27,21 @@
 
 bool RhConfig::ReadConfigValue(_In_z_ const TCHAR *wszName, uint32_t* pValue, bool decimal)
 {
-    TCHAR wszBuffer[CONFIG_VAL_MAXLEN + 1]; // 8 hex digits plus a nul terminator.
+    uint64_t uiResult;
+    if (!ReadConfigValue(wszName, &uiResult, decimal))
+        return false;
+
+    // values that do not fit are treated the same as values that fail to parse
+    if (uiResult > UINT32_MAX)
+        return false;
+
+    *pValue = (uint32_t)uiResult;
+    return true;
+}
+
+bool RhConfig::ReadConfigValue(_In_z_ const TCHAR *wszName, uint64_t* pValue, bool decimal)
+{
+    TCHAR wszBuffer[CONFIG_VAL_MAXLEN + 1]; // 16 hex digits plus a nul terminator.
     const uint32_t cchBuffer = sizeof(wszBuffer) / sizeof(wszBuffer[0]);
 
     uint32_t cchResult = 0;
@@ -48,7 +62,7 @@ bool RhConfig::ReadConfigValue(_In_z_ const TCHAR *wszName, uint32_t* pValue, bo
     if ((cchResult == 0) || (cchResult >= cchBuffer))
         return false; // not found
 
-    uint32_t uiResult = 0;
+    uint64_t uiResult = 0;
 
     for (uint32_t i = 0; i < cchResult; i++)
     {
@@ -110,7 +124,7 @@ uint32_t RhConfig::GetEmbeddedVariable(_In_z_ const TCHAR* configName, _Out_writ
 uint32_t RhConfig::GetConfigVariable(_In_z_ const TCHAR* configName, const ConfigPair* configPairs, _Out_writes_all_(cchOutputBuffer) TCHAR* outputBuffer, _In_ uint32_t cchOutputBuffer)
 {
     //find the first name which matches (case insensitive to be compat with environment variable counterpart)
-    for (int iSettings = 0; iSettings < RCV_Count; iSettings++)
+    for (int iSettings = 0; iSettings < CONFIG_MAX_EMBEDDED_PAIRS; iSettings++)
     {
         if (_tcsicmp(configName, configPairs[iSettings].Key) == 0)
         {
@@ -160,7 +174,7 @@ void RhConfig::ReadEmbeddedSettings()
             return;
         }
 
-        ConfigPair* iniBuff = new (nothrow) ConfigPair[RCV_Count];
+        ConfigPair* iniBuff = new (nothrow) ConfigPair[CONFIG_MAX_EMBEDDED_PAIRS];
         if (iniBuff == NULL)
         {
             //only set if another thread hasn't initialized the buffer yet, otherwise ignore and let the first setter win
@@ -174,7 +188,7 @@ void RhConfig::ReadEmbeddedSettings()
         char* currLine;
 
         //while we haven't reached the max number of config pairs, or the end of the file, read the next line
-        while (iIniBuff < RCV_Count && iBuff < g_compilerEmbeddedSettingsBlob.Size)
+        while (iIniBuff < CONFIG_MAX_EMBEDDED_PAIRS && iBuff < g_compilerEmbeddedSettingsBlob.Size)
         {
             currLine = &g_compilerEmbeddedSettingsBlob.Data[iBuff];
 
@@ -194,7 +208,7 @@ void RhConfig::ReadEmbeddedSettings()
         }
 
         //initialize the remaining config pairs to "\0"
-        while (iIniBuff < RCV_Count)
+        while (iIniBuff < CONFIG_MAX_EMBEDDED_PAIRS)
         {
             iniBuff[iIniBuff].Key[0] = '\0';
             iniBuff[iIniBuff].Value[0] = '\0';
@@ -22,7 +22,8 @@ class RhConfig
 
 #define CONFIG_INI_NOT_AVAIL (void*)0x1  //signal for ini file failed to load
 #define CONFIG_KEY_MAXLEN 50             //arbitrary max length of config keys increase if needed
-#define CONFIG_VAL_MAXLEN 8              //32 bit uint in hex
+#define CONFIG_VAL_MAXLEN 16             //64 bit uint in hex
+#define CONFIG_MAX_EMBEDDED_PAIRS 64     //arbitrary max number of embedded config pairs increase if needed
 
 private:
     struct ConfigPair
@@ -44,6 +45,9 @@ public:
 
     bool ReadConfigValue(_In_z_ const TCHAR* wszName, uint32_t* pValue, bool decimal = false);
 
+    // Reads a value that may not fit in 32 bits, such as the GC heap hard limit or region range.
+    bool ReadConfigValue(_In_z_ const TCHAR* wszName, uint64_t* pValue, bool decimal = false);
+
 #define DEFINE_VALUE_ACCESSOR(_name, defaultVal)        \
     uint32_t Get##_name()                                 \
     {                                                   \
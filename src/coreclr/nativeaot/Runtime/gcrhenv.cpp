@@ -1498,11 +1498,11 @@ bool GCToEEInterface::GetIntConfigValue(const char* privateKey, const char* publ
     const TCHAR* pKey = privateKey;
 #endif
 
-    uint32_t uiValue;
+    uint64_t uiValue;
     if (!g_pRhConfig->ReadConfigValue(pKey, &uiValue))
         return false;
 
-    *value = uiValue;
+    *value = (int64_t)uiValue;
     return true;
 }
 
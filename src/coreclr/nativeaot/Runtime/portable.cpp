@@ -47,6 +47,8 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    int16_t        alloc_quantum_level;
+    uint16_t       alloc_refill_count;
 };
 
 //
@@ -156,9 +158,38 @@ COOP_PINVOKE_HELPER(Array *, RhpNewArray, (MethodTable * pArrayEEType, int numEl
 
 COOP_PINVOKE_HELPER(String *, RhNewString, (MethodTable * pArrayEEType, int numElements))
 {
-    // TODO: Implement. We tail call to RhpNewArray for now since there's a bunch of TODOs in the places
-    // that matter anyway.
-    return (String*)RhpNewArray(pArrayEEType, numElements);
+    Thread * pCurThread = ThreadStore::GetCurrentThread();
+    gc_alloc_context * acontext = pCurThread->GetAllocContext();
+    String * pObject;
+
+    // The component size of a string is known, and limiting the length to MAX_STRING_LENGTH
+    // keeps the size computation below from overflowing even on 32-bit platforms.
+    if ((uint32_t)numElements > MAX_STRING_LENGTH)
+    {
+        ASSERT_UNCONDITIONALLY("NYI");  // TODO: Throw OOM
+    }
+
+    size_t size = STRING_BASE_SIZE + ((size_t)numElements * STRING_COMPONENT_SIZE);
+    size = ALIGN_UP(size, sizeof(uintptr_t));
+
+    uint8_t* alloc_ptr = acontext->alloc_ptr;
+    ASSERT(alloc_ptr <= acontext->alloc_limit);
+    if ((size_t)(acontext->alloc_limit - alloc_ptr) >= size)
+    {
+        acontext->alloc_ptr = alloc_ptr + size;
+        pObject = (String *)alloc_ptr;
+        pObject->set_EEType(pArrayEEType);
+        ((Array *)pObject)->InitArrayLength((uint32_t)numElements);
+        return pObject;
+    }
+
+    pObject = (String *)RhpGcAlloc(pArrayEEType, 0, (uintptr_t)numElements, NULL);
+    if (pObject == nullptr)
+    {
+        ASSERT_UNCONDITIONALLY("NYI");  // TODO: Throw OOM
+    }
+
+    return pObject;
 }
 
 #endif
@@ -633,9 +633,37 @@ uint64_t GetPC(void* context)
 
 #endif // HOST_AMD64
 
+// Small per-thread cache of recent FindProcInfo results. Stack walks for GC and exception
+// dispatch hit the same return addresses over and over, and each miss costs a binary search
+// of the unwind tables by libunwind. Managed code is never unloaded, so entries never go stale.
+struct ProcInfoCacheEntry
+{
+    uintptr_t controlPC;
+    uintptr_t startAddress;
+    uintptr_t lsda;
+};
+
+#define PROC_INFO_CACHE_SIZE 64
+
+static DECLSPEC_THREAD ProcInfoCacheEntry t_procInfoCache[PROC_INFO_CACHE_SIZE];
+
+static inline ProcInfoCacheEntry* GetProcInfoCacheEntry(uintptr_t controlPC)
+{
+    size_t index = ((controlPC >> 2) ^ (controlPC >> 8)) & (PROC_INFO_CACHE_SIZE - 1);
+    return &t_procInfoCache[index];
+}
+
 // Find LSDA and start address for a function at address controlPC
 bool FindProcInfo(uintptr_t controlPC, uintptr_t* startAddress, uintptr_t* lsda)
 {
+    ProcInfoCacheEntry* pEntry = GetProcInfoCacheEntry(controlPC);
+    if (pEntry->controlPC == controlPC && controlPC != 0)
+    {
+        *startAddress = pEntry->startAddress;
+        *lsda = pEntry->lsda;
+        return true;
+    }
+
     unw_proc_info_t procInfo;
 
     if (!GetUnwindProcInfo((PCODE)controlPC, &procInfo))
@@ -653,6 +681,10 @@ bool FindProcInfo(uintptr_t controlPC, uintptr_t* startAddress, uintptr_t* lsda)
 #endif
     *startAddress = procInfo.start_ip;
 
+    pEntry->controlPC = controlPC;
+    pEntry->startAddress = *startAddress;
+    pEntry->lsda = *lsda;
+
     return true;
 }
 
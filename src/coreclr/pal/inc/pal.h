@@ -2653,6 +2653,11 @@ BOOL
 PALAPI
 PAL_GetPhysicalMemoryUsed(size_t* val);
 
+PALIMPORT
+BOOL
+PALAPI
+PAL_GetMemoryPressure(UINT32* val);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -3030,6 +3035,12 @@ PAL_JitWriteProtect(bool writeEnable);
 
 #endif // defined(HOST_OSX) && defined(HOST_ARM64)
 
+PALIMPORT
+BOOL
+PALAPI
+PAL_PrefetchVirtualMemory(
+           IN LPVOID lpAddress,
+           IN SIZE_T dwSize);
 
 PALIMPORT
 BOOL
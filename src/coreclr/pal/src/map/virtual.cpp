@@ -1806,6 +1806,41 @@ PALAPI VOID PAL_JitWriteProtect(bool writeEnable)
 }
 #endif // HOST_OSX && HOST_ARM64
 
+/*++
+Function:
+  PAL_PrefetchVirtualMemory
+
+  Asks the OS to start reading in the pages of a mapped range in the background,
+  so that they don't have to be faulted in one at a time on first access.
+  This is only a hint, the range is left unchanged in any case.
+
+Return value:
+  TRUE if the hint was given, FALSE otherwise
+--*/
+BOOL
+PALAPI
+PAL_PrefetchVirtualMemory(
+           IN LPVOID lpAddress,
+           IN SIZE_T dwSize)
+{
+    BOOL bRetVal = FALSE;
+
+    PERF_ENTRY(PAL_PrefetchVirtualMemory);
+    ENTRY("PAL_PrefetchVirtualMemory(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+    if (dwSize != 0)
+    {
+        UINT_PTR StartBoundary = (UINT_PTR) ALIGN_DOWN(lpAddress, GetVirtualPageSize());
+        SIZE_T MemSize = ALIGN_UP((UINT_PTR)lpAddress + dwSize, GetVirtualPageSize()) - StartBoundary;
+
+        bRetVal = (posix_madvise((LPVOID)StartBoundary, MemSize, POSIX_MADV_WILLNEED) == 0);
+    }
+
+    LOGEXIT("PAL_PrefetchVirtualMemory returning %s.\n", bRetVal == TRUE ? "TRUE" : "FALSE");
+    PERF_EXIT(PAL_PrefetchVirtualMemory);
+    return bRetVal;
+}
+
 #if HAVE_VM_ALLOCATE
 //---------------------------------------------------------------------------------------
 //
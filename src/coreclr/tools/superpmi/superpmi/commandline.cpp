@@ -117,6 +117,14 @@ void CommandLine::DumpHelp(const char* program)
     printf("     For a positive 'limit' number, replay and asm diffs will exit if it sees more than 'limit' failures.\n");
     printf("     Otherwise, all methods will be compiled.\n");
     printf("\n");
+    printf(" -repeatCount <count>\n");
+    printf("     Compile each method context 'count' times with each JIT, to measure JIT throughput.\n");
+    printf("     Only the result of the first compile is used for replay and asm diffs. The executed\n");
+    printf("     instructions and compile time of all the compiles are included in the metrics summaries\n");
+    printf("     (see -baseMetricsSummary/-diffMetricsSummary), which can be compared to find throughput\n");
+    printf("     regressions between two JITs. For a per-phase breakdown, use a JIT built with\n");
+    printf("     FEATURE_JIT_METHOD_PERF and pass '-jitoption JitTimeLogCsv=<file>'.\n");
+    printf("\n");
     printf(" -skipCleanup\n");
     printf("     Skip deletion of temporary files created by child SuperPMI processes with -parallel.\n");
     printf("\n");
@@ -531,6 +539,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                     return false;
                 }
             }
+            else if ((_strnicmp(&argv[i][1], "repeatCount", argLen) == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->repeatCount = atoi(argv[i]);
+
+                if (o->repeatCount < 1)
+                {
+                    LogError("Incorrect count specified for -repeatCount. Count must be > 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_stricmp(&argv[i][1], "skipCleanup") == 0))
             {
                 o->skipCleanup = true;
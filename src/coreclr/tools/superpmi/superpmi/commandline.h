@@ -33,6 +33,7 @@ public:
             , workerCount(-1)
             , indexCount(-1)
             , failureLimit(-1)
+            , repeatCount(1)
             , indexes(nullptr)
             , hash(nullptr)
             , methodStatsTypes(nullptr)
@@ -66,6 +67,7 @@ public:
         int   workerCount; // Number of workers to use for /parallel mode. -1 (or 1) means don't use parallel mode.
         int   indexCount;  // If indexCount is -1 and hash points to nullptr it means compile all.
         int   failureLimit; // Number of failures after which bail out the replay/asmdiffs.
+        int   repeatCount;  // Number of times each method context is compiled by each JIT (for throughput measurement).
         int*  indexes;
         char* hash;
         char* methodStatsTypes;
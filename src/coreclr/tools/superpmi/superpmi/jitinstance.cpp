@@ -436,6 +436,7 @@ JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile, i
     {
         metrics->SuccessfulCompiles++;
         metrics->NumExecutedInstructions += static_cast<long long>(insCountAfter - insCountBefore);
+        metrics->CompileMilliseconds += stj.GetMilliseconds();
 
     }
     else
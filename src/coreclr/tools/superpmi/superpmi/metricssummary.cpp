@@ -43,15 +43,16 @@ bool MetricsSummary::SaveToFile(const char* path)
     int len =
         sprintf_s(
             buffer, sizeof(buffer),
-            "Successful compiles,Failing compiles,Missing compiles,Code bytes,Diffed code bytes,Executed instructions,Diff executed instructions\n"
-            "%d,%d,%d,%lld,%lld,%lld,%lld\n",
+            "Successful compiles,Failing compiles,Missing compiles,Code bytes,Diffed code bytes,Executed instructions,Diff executed instructions,Compile milliseconds\n"
+            "%d,%d,%d,%lld,%lld,%lld,%lld,%f\n",
             SuccessfulCompiles,
             FailingCompiles,
             MissingCompiles,
             NumCodeBytes,
             NumDiffedCodeBytes,
             NumExecutedInstructions,
-            NumDiffExecutedInstructions);
+            NumDiffExecutedInstructions,
+            CompileMilliseconds);
     DWORD numWritten;
     if (!WriteFile(file.get(), buffer, static_cast<DWORD>(len), &numWritten, nullptr) || numWritten != static_cast<DWORD>(len))
     {
@@ -88,17 +89,18 @@ bool MetricsSummary::LoadFromFile(const char* path, MetricsSummary* metrics)
     int scanResult =
         sscanf_s(
             content.data(),
-            "Successful compiles,Failing compiles,Missing compiles,Code bytes,Diffed code bytes,Executed instructions,Diff executed instructions\n"
-            "%d,%d,%d,%lld,%lld,%lld,%lld\n",
+            "Successful compiles,Failing compiles,Missing compiles,Code bytes,Diffed code bytes,Executed instructions,Diff executed instructions,Compile milliseconds\n"
+            "%d,%d,%d,%lld,%lld,%lld,%lld,%lf\n",
             &metrics->SuccessfulCompiles,
             &metrics->FailingCompiles,
             &metrics->MissingCompiles,
             &metrics->NumCodeBytes,
             &metrics->NumDiffedCodeBytes,
             &metrics->NumExecutedInstructions,
-            &metrics->NumDiffExecutedInstructions);
+            &metrics->NumDiffExecutedInstructions,
+            &metrics->CompileMilliseconds);
 
-    return scanResult == 7;
+    return scanResult == 8;
 }
 
 void MetricsSummary::AggregateFrom(const MetricsSummary& other)
@@ -110,4 +112,5 @@ void MetricsSummary::AggregateFrom(const MetricsSummary& other)
     NumDiffedCodeBytes += other.NumDiffedCodeBytes;
     NumExecutedInstructions += other.NumExecutedInstructions;
     NumDiffExecutedInstructions += other.NumDiffExecutedInstructions;
+    CompileMilliseconds += other.CompileMilliseconds;
 }
@@ -22,6 +22,8 @@ public:
     long long NumExecutedInstructions = 0;
     // Number of executed instructions inside contexts that were successfully diffed.
     long long NumDiffExecutedInstructions = 0;
+    // Wall-clock time, in milliseconds, spent in successful compiles (including repeated compiles).
+    double CompileMilliseconds = 0;
 
     bool SaveToFile(const char* path);
     static bool LoadFromFile(const char* path, MetricsSummary* metrics);
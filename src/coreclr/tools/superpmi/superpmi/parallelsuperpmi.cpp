@@ -613,6 +613,12 @@ int doParallelSuperPMI(CommandLine::Options& o)
                                       o.failureLimit);
         }
 
+        if (o.repeatCount > 1)
+        {
+            bytesWritten += sprintf_s(cmdLine + bytesWritten, MAX_CMDLINE_SIZE - bytesWritten, " -repeatCount %d",
+                                      o.repeatCount);
+        }
+
         bytesWritten += sprintf_s(cmdLine + bytesWritten, MAX_CMDLINE_SIZE - bytesWritten, " -v ewmin %s", spmiArgs);
 
         SECURITY_ATTRIBUTES sa;
@@ -129,6 +129,28 @@ void InvokeNearDiffer(NearDiffer*           nearDiffer,
     PAL_ENDTRY
 }
 
+// Compile the method context 'count' additional times, for throughput measurement. The compile results
+// are discarded, leaving 'mc->cr' as it was; only the executed instructions and compile time are
+// accumulated into 'metrics'.
+//
+static void RepeatCompileMethod(JitInstance* jit, MethodContext* mc, int mcIndex, int count, MetricsSummary* metrics)
+{
+    CompileResult* cr = mc->cr;
+
+    for (int i = 0; i < count; i++)
+    {
+        MetricsSummary repeatMetrics;
+        mc->cr = new CompileResult();
+        jit->CompileMethod(mc, mcIndex, /* collectThroughput */ false, &repeatMetrics);
+        delete mc->cr;
+
+        metrics->NumExecutedInstructions += repeatMetrics.NumExecutedInstructions;
+        metrics->CompileMilliseconds += repeatMetrics.CompileMilliseconds;
+    }
+
+    mc->cr = cr;
+}
+
 // Run superpmi. The return value is as follows:
 // 0    : success
 // -1   : general fatal error (e.g., failed to initialize, failed to read files)
@@ -374,6 +396,11 @@ int __cdecl main(int argc, char* argv[])
         LogDebug("Method %d compiled%s in %fms, result %d",
             reader->GetMethodContextIndex(), (o.nameOfJit2 == nullptr) ? "" : " by JIT1", st3.GetMilliseconds(), res);
 
+        if ((res == JitInstance::RESULT_SUCCESS) && (o.repeatCount > 1))
+        {
+            RepeatCompileMethod(jit, mc, reader->GetMethodContextIndex(), o.repeatCount - 1, &baseMetrics);
+        }
+
         totalBaseMetrics.AggregateFrom(baseMetrics);
 
         if ((res == JitInstance::RESULT_SUCCESS) && Logger::IsLogLevelEnabled(LOGLEVEL_DEBUG))
@@ -397,6 +424,11 @@ int __cdecl main(int argc, char* argv[])
             LogDebug("Method %d compiled by JIT2 in %fms, result %d", reader->GetMethodContextIndex(),
                      st4.GetMilliseconds(), res2);
 
+            if ((res2 == JitInstance::RESULT_SUCCESS) && (o.repeatCount > 1))
+            {
+                RepeatCompileMethod(jit2, mc, reader->GetMethodContextIndex(), o.repeatCount - 1, &diffMetrics);
+            }
+
             totalDiffMetrics.AggregateFrom(diffMetrics);
 
             if ((res2 == JitInstance::RESULT_SUCCESS) && Logger::IsLogLevelEnabled(LOGLEVEL_DEBUG))
@@ -627,6 +659,17 @@ int __cdecl main(int argc, char* argv[])
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
+    if (o.repeatCount > 1)
+    {
+        LogVerbose("Compile time (%d compiles per method): %fms%s", o.repeatCount,
+                   totalBaseMetrics.CompileMilliseconds, (o.nameOfJit2 == nullptr) ? "" : " by JIT1");
+        if (o.nameOfJit2 != nullptr)
+        {
+            LogVerbose("Compile time (%d compiles per method): %fms by JIT2", o.repeatCount,
+                       totalDiffMetrics.CompileMilliseconds);
+        }
+    }
+
     if (o.baseMetricsSummaryFile != nullptr)
     {
         totalBaseMetrics.SaveToFile(o.baseMetricsSummaryFile);
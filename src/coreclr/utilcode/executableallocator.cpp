@@ -29,6 +29,10 @@ int64_t ExecutableAllocator::g_mapCreateTimeSum = 0;
 int64_t ExecutableAllocator::g_releaseCount = 0;
 int64_t ExecutableAllocator::g_reserveCount = 0;
 
+int64_t ExecutableAllocator::g_mapRWCount = 0;
+int64_t ExecutableAllocator::g_mapRWCreateCount = 0;
+int64_t ExecutableAllocator::g_mapRWReleaseCount = 0;
+
 ExecutableAllocator::LogEntry ExecutableAllocator::s_usageLog[256];
 int ExecutableAllocator::s_logMaxIndex = 0;
 CRITSEC_COOKIE ExecutableAllocator::s_LoggerCriticalSection;
@@ -91,6 +95,10 @@ void ExecutableAllocator::DumpHolderUsage()
     fprintf(stderr, "Reserve count: %I64d\n", g_reserveCount);
     fprintf(stderr, "Release count: %I64d\n", g_releaseCount);
 
+    fprintf(stderr, "MapRW count: %I64d\n", g_mapRWCount);
+    fprintf(stderr, "RW mappings created: %I64d\n", g_mapRWCreateCount);
+    fprintf(stderr, "RW mappings released: %I64d\n", g_mapRWReleaseCount);
+
     fprintf(stderr, "ExecutableWriterHolder usage:\n");
 
     for (int i = 0; i < s_logMaxIndex; i++)
@@ -259,36 +267,90 @@ bool ExecutableAllocator::Initialize()
     return true;
 }
 
-//#define ENABLE_CACHED_MAPPINGS
+#define ENABLE_CACHED_MAPPINGS
 
 void ExecutableAllocator::UpdateCachedMapping(BlockRW* pBlock)
 {
     LIMITED_METHOD_CONTRACT;
 #ifdef ENABLE_CACHED_MAPPINGS
-    if (m_cachedMapping == NULL)
+    int i;
+    for (i = 0; i < CachedMappingCount - 1; i++)
+    {
+        if ((m_cachedMappings[i] == pBlock) || (m_cachedMappings[i] == NULL))
+        {
+            break;
+        }
+    }
+
+    if (m_cachedMappings[i] != pBlock)
     {
-        m_cachedMapping = pBlock;
+        // Take a reference for the cache, evicting the least recently used mapping if needed
+        if (m_cachedMappings[i] != NULL)
+        {
+            _ASSERTE(i == CachedMappingCount - 1);
+            ReleaseRWBlock(m_cachedMappings[i]->baseRW);
+        }
         pBlock->refCount++;
     }
-    else if (m_cachedMapping != pBlock)
+
+    // Move the block to the front
+    for (; i > 0; i--)
     {
-        void* unmapAddress = NULL;
-        size_t unmapSize;
+        m_cachedMappings[i] = m_cachedMappings[i - 1];
+    }
+    m_cachedMappings[0] = pBlock;
+#endif // ENABLE_CACHED_MAPPINGS
+}
 
-        if (!RemoveRWBlock(m_cachedMapping->baseRW, &unmapAddress, &unmapSize))
+void ExecutableAllocator::RemoveCachedMappings(void* baseRX, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+#ifdef ENABLE_CACHED_MAPPINGS
+    int j = 0;
+    for (int i = 0; i < CachedMappingCount; i++)
+    {
+        BlockRW* pBlock = m_cachedMappings[i];
+        if ((pBlock != NULL) && (pBlock->baseRX >= baseRX) && ((size_t)pBlock->baseRX < ((size_t)baseRX + size)))
         {
-            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
+            ReleaseRWBlock(pBlock->baseRW);
         }
-        if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
+        else
         {
-            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+            m_cachedMappings[j++] = pBlock;
         }
-        m_cachedMapping = pBlock;
-        pBlock->refCount++;
+    }
+
+    for (; j < CachedMappingCount; j++)
+    {
+        m_cachedMappings[j] = NULL;
     }
 #endif // ENABLE_CACHED_MAPPINGS
 }
 
+void ExecutableAllocator::ReleaseRWBlock(void* pRW)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    void* unmapAddress = NULL;
+    size_t unmapSize;
+
+    if (!RemoveRWBlock(pRW, &unmapAddress, &unmapSize))
+    {
+        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
+    }
+
+    if (unmapAddress)
+    {
+#ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
+        InterlockedIncrement64(&g_mapRWReleaseCount);
+#endif
+        if (!VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
+        {
+            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+        }
+    }
+}
+
 void* ExecutableAllocator::FindRWBlock(void* baseRX, size_t size)
 {
     LIMITED_METHOD_CONTRACT;
@@ -453,6 +515,9 @@ void ExecutableAllocator::Release(void* pRX)
 
         if (pBlock != NULL)
         {
+            // Cached RW mappings must not outlive the RX memory they map
+            RemoveCachedMappings(pRX, pBlock->size);
+
             VMToOSInterface::ReleaseDoubleMappedMemory(m_doubleMemoryMapperHandle, pRX, pBlock->offset, pBlock->size);
             // Put the released block into the free block list
             pBlock->baseRX = NULL;
@@ -761,6 +826,7 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size)
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
     StopWatch sw(&g_mapTimeSum);
+    InterlockedIncrement64(&g_mapRWCount);
 #endif
 
     void* result = FindRWBlock(pRX, size);
@@ -785,6 +851,9 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size)
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
         StopWatch sw2(&g_mapCreateTimeSum);
+#endif
+#ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
+        InterlockedIncrement64(&g_mapRWCreateCount);
 #endif
         void* pRW = VMToOSInterface::GetRWMapping(m_doubleMemoryMapperHandle, (BYTE*)pBlock->baseRX + mapOffset, pBlock->offset + mapOffset, mapSize);
 
@@ -834,16 +903,5 @@ void ExecutableAllocator::UnmapRW(void* pRW)
     StopWatch swNoLock(&g_unmapTimeSum);
 #endif
 
-    void* unmapAddress = NULL;
-    size_t unmapSize;
-
-    if (!RemoveRWBlock(pRW, &unmapAddress, &unmapSize))
-    {
-        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
-    }
-
-    if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
-    {
-        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
-    }
+    ReleaseRWBlock(pRW);
 }
@@ -194,8 +194,10 @@ endif
         REPRET
 endif
 
-    ; make sure this is bigger than any of the others
+    ; make sure this is bigger than any of the others, the region barriers
+    ; (JIT_WriteBarrier_[WriteWatch_]Regions64) need more room than the code above
     align 16
+        db 48 dup (0CCh)
         nop
 LEAF_END_MARKED JIT_WriteBarrier, _TEXT
 
@@ -408,4 +408,185 @@ endif
 endif
 
 
+; With regions, the GC maintains a table with the generation of every region,
+; so instead of marking a card for all stores of ephemeral references, we only
+; mark one when the store creates a reference from an older generation to a
+; younger one. Stores into gen0 objects never need a card so we check for those
+; before anything else.
+LEAF_ENTRY JIT_WriteBarrier_Regions64, _TEXT
+        align 8
+        ; Do the move into the GC .  It is correct to take an AV here, the EH code
+        ; figures out that this came from a WriteBarrier and correctly maps it back
+        ; to the managed method which called the WriteBarrier (see setup in
+        ; InitializeExceptionHandling, vm\exceptionhandling.cpp).
+        mov     [rcx], rdx
+
+        mov     r8, rcx
+
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_RegionToGeneration
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Check the generation of the region we stored into. The shift amount
+        ; (the region size) is patched at runtime.
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_RegionShrDest
+        shr     rcx, 16h
+        cmp     byte ptr [rcx + rax], 0h
+        jne     NotGen0
+        REPRET
+
+    NotGen0:
+        NOP_2_BYTE ; padding for alignment of constant
+
+        ; Check that the reference points into the GC heap.
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_Lower
+        mov     r10, 0F0F0F0F0F0F0F0F0h
+        cmp     rdx, r10
+        jb      Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_Upper
+        mov     r10, 0F0F0F0F0F0F0F0F0h
+        cmp     rdx, r10
+        jae     Exit
+
+        ; Only an older to younger reference needs a card.
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_RegionShrSrc
+        shr     rdx, 16h
+        movzx   r11d, byte ptr [rdx + rax]
+        cmp     r11b, byte ptr [rcx + rax]
+        jae     Exit
+
+        NOP_2_BYTE ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_CardTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Touch the card table entry, if not already dirty.
+        shr     r8, 0Bh
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardTable
+        REPRET
+
+    UpdateCardTable:
+        mov     byte ptr [r8 + rax], 0FFh
+ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+        shr     r8, 0Ah
+PATCH_LABEL JIT_WriteBarrier_Regions64_Patch_Label_CardBundleTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardBundleTable
+        REPRET
+
+    UpdateCardBundleTable:
+        mov     byte ptr [r8 + rax], 0FFh
+endif
+        ret
+
+    align 16
+    Exit:
+        REPRET
+LEAF_END_MARKED JIT_WriteBarrier_Regions64, _TEXT
+
+
+ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+
+LEAF_ENTRY JIT_WriteBarrier_WriteWatch_Regions64, _TEXT
+        align 8
+
+        ; Regarding patchable constants:
+        ; - 64-bit constants have to be loaded into a register
+        ; - The constants have to be aligned to 8 bytes so that they can be patched easily
+        ; - The constant loads have been located to minimize NOP padding required to align the constants
+        ; - Using different registers for successive constant loads helps pipeline better. Should we decide to use a special
+        ;   non-volatile calling convention, this should be changed to use just one register.
+
+        ; See comments for JIT_WriteBarrier_Regions64 (above).
+
+        ; Do the move into the GC .  It is correct to take an AV here, the EH code
+        ; figures out that this came from a WriteBarrier and correctly maps it back
+        ; to the managed method which called the WriteBarrier (see setup in
+        ; InitializeExceptionHandling, vm\exceptionhandling.cpp).
+        mov     [rcx], rdx
+
+        ; Update the write watch table if necessary
+        mov     r11, rcx
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_WriteWatchTable
+        mov     r10, 0F0F0F0F0F0F0F0F0h
+        shr     r11, 0Ch ; SoftwareWriteWatch::AddressToTableByteIndexShift
+        NOP_2_BYTE ; padding for alignment of constant
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_RegionToGeneration
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        add     r11, r10
+        cmp     byte ptr [r11], 0h
+        jne     CheckGen0
+        mov     byte ptr [r11], 0FFh
+
+    CheckGen0:
+        mov     r8, rcx
+
+        ; Check the generation of the region we stored into.
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_RegionShrDest
+        shr     rcx, 16h
+        cmp     byte ptr [rcx + rax], 0h
+        jne     NotGen0
+        REPRET
+
+    NotGen0:
+        NOP_2_BYTE ; padding for alignment of constant
+
+        ; Check that the reference points into the GC heap.
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_Lower
+        mov     r10, 0F0F0F0F0F0F0F0F0h
+        cmp     rdx, r10
+        jb      Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_Upper
+        mov     r10, 0F0F0F0F0F0F0F0F0h
+        cmp     rdx, r10
+        jae     Exit
+
+        ; Only an older to younger reference needs a card.
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_RegionShrSrc
+        shr     rdx, 16h
+        movzx   r11d, byte ptr [rdx + rax]
+        cmp     r11b, byte ptr [rcx + rax]
+        jae     Exit
+
+        NOP_2_BYTE ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_CardTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Touch the card table entry, if not already dirty.
+        shr     r8, 0Bh
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardTable
+        REPRET
+
+    UpdateCardTable:
+        mov     byte ptr [r8 + rax], 0FFh
+ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+        shr     r8, 0Ah
+PATCH_LABEL JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_CardBundleTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardBundleTable
+        REPRET
+
+    UpdateCardBundleTable:
+        mov     byte ptr [r8 + rax], 0FFh
+endif
+        ret
+
+    align 16
+    Exit:
+        REPRET
+LEAF_END_MARKED JIT_WriteBarrier_WriteWatch_Regions64, _TEXT
+
+endif
+
+
         end
@@ -20,6 +20,8 @@ extern uint8_t* g_ephemeral_low;
 extern uint8_t* g_ephemeral_high;
 extern uint32_t* g_card_table;
 extern uint32_t* g_card_bundle_table;
+extern uint8_t* g_region_to_generation_table;
+extern uint8_t g_region_shr;
 
 // Patch Labels for the various write barriers
 EXTERN_C void JIT_WriteBarrier_End();
@@ -50,6 +52,18 @@ EXTERN_C void JIT_WriteBarrier_SVR64_PatchLabel_CardBundleTable();
 EXTERN_C void JIT_WriteBarrier_SVR64_End();
 #endif // FEATURE_SVR_GC
 
+EXTERN_C void JIT_WriteBarrier_Regions64(Object **dst, Object *ref);
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_RegionToGeneration();
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_RegionShrDest();
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_Lower();
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_Upper();
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_RegionShrSrc();
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_CardTable();
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+EXTERN_C void JIT_WriteBarrier_Regions64_Patch_Label_CardBundleTable();
+#endif
+EXTERN_C void JIT_WriteBarrier_Regions64_End();
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 EXTERN_C void JIT_WriteBarrier_WriteWatch_PreGrow64(Object **dst, Object *ref);
 EXTERN_C void JIT_WriteBarrier_WriteWatch_PreGrow64_Patch_Label_WriteWatchTable();
@@ -79,6 +93,19 @@ EXTERN_C void JIT_WriteBarrier_WriteWatch_SVR64_PatchLabel_CardBundleTable();
 #endif
 EXTERN_C void JIT_WriteBarrier_WriteWatch_SVR64_End();
 #endif // FEATURE_SVR_GC
+
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64(Object **dst, Object *ref);
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_WriteWatchTable();
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_RegionToGeneration();
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_RegionShrDest();
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_Lower();
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_Upper();
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_RegionShrSrc();
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_CardTable();
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_Patch_Label_CardBundleTable();
+#endif
+EXTERN_C void JIT_WriteBarrier_WriteWatch_Regions64_End();
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 WriteBarrierManager g_WriteBarrierManager;
@@ -152,6 +179,22 @@ void WriteBarrierManager::Validate()
 #endif // FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
 #endif // FEATURE_SVR_GC
 
+    PBYTE pRegionToGenTableImmediate;
+
+    pRegionToGenTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_RegionToGeneration, 2);
+    pLowerBoundImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_Lower, 2);
+    pUpperBoundImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_Upper, 2);
+    pCardTableImmediate        = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_CardTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pRegionToGenTableImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pLowerBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pUpperBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardTableImmediate) & 0x7) == 0);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    pCardBundleTableImmediate  = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_CardBundleTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
+#endif
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     PBYTE pWriteWatchTableImmediate;
 
@@ -194,6 +237,23 @@ void WriteBarrierManager::Validate()
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
 #endif // FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
 #endif // FEATURE_SVR_GC
+
+    pWriteWatchTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_WriteWatchTable, 2);
+    pRegionToGenTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_RegionToGeneration, 2);
+    pLowerBoundImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_Lower, 2);
+    pUpperBoundImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_Upper, 2);
+    pCardTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_CardTable, 2);
+
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pWriteWatchTableImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pRegionToGenTableImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pLowerBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pUpperBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardTableImmediate) & 0x7) == 0);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_CardBundleTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
+#endif
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 }
 
@@ -214,6 +274,8 @@ PCODE WriteBarrierManager::GetCurrentWriteBarrierCode()
         case WRITE_BARRIER_SVR64:
             return GetEEFuncEntryPoint(JIT_WriteBarrier_SVR64);
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_REGIONS64:
+            return GetEEFuncEntryPoint(JIT_WriteBarrier_Regions64);
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             return GetEEFuncEntryPoint(JIT_WriteBarrier_WriteWatch_PreGrow64);
@@ -223,6 +285,8 @@ PCODE WriteBarrierManager::GetCurrentWriteBarrierCode()
         case WRITE_BARRIER_WRITE_WATCH_SVR64:
             return GetEEFuncEntryPoint(JIT_WriteBarrier_WriteWatch_SVR64);
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+            return GetEEFuncEntryPoint(JIT_WriteBarrier_WriteWatch_Regions64);
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         default:
             UNREACHABLE_MSG("unexpected m_currentWriteBarrier!");
@@ -246,6 +310,8 @@ size_t WriteBarrierManager::GetSpecificWriteBarrierSize(WriteBarrierType writeBa
         case WRITE_BARRIER_SVR64:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_SVR64);
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_REGIONS64:
+            return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_Regions64);
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_WriteWatch_PreGrow64);
@@ -255,6 +321,8 @@ size_t WriteBarrierManager::GetSpecificWriteBarrierSize(WriteBarrierType writeBa
         case WRITE_BARRIER_WRITE_WATCH_SVR64:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_WriteWatch_SVR64);
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+            return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_WriteWatch_Regions64);
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_BUFFER:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier);
@@ -350,6 +418,31 @@ int WriteBarrierManager::ChangeWriteBarrierTo(WriteBarrierType newWriteBarrier,
         }
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+        {
+            m_pRegionToGenTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_RegionToGeneration, 2);
+            m_pRegionShrDest = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_RegionShrDest, 3);
+            m_pLowerBoundImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_Lower, 2);
+            m_pUpperBoundImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_Upper, 2);
+            m_pRegionShrSrc = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_RegionShrSrc, 3);
+            m_pCardTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_CardTable, 2);
+
+            // Make sure that we will be bashing the right places (immediates should be hardcoded to 0x0f0f0f0f0f0f0f0f0,
+            // and the shift amounts to 0x16).
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pRegionToGenTableImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0x16 == *(UINT8*)m_pRegionShrDest);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pLowerBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pUpperBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0x16 == *(UINT8*)m_pRegionShrSrc);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardTableImmediate);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            m_pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Regions64, Patch_Label_CardBundleTable, 2);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardBundleTableImmediate);
+#endif
+            break;
+        }
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
         {
@@ -406,6 +499,33 @@ int WriteBarrierManager::ChangeWriteBarrierTo(WriteBarrierType newWriteBarrier,
             break;
         }
 #endif // FEATURE_SVR_GC
+
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+        {
+            m_pWriteWatchTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_WriteWatchTable, 2);
+            m_pRegionToGenTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_RegionToGeneration, 2);
+            m_pRegionShrDest = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_RegionShrDest, 3);
+            m_pLowerBoundImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_Lower, 2);
+            m_pUpperBoundImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_Upper, 2);
+            m_pRegionShrSrc = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_RegionShrSrc, 3);
+            m_pCardTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_CardTable, 2);
+
+            // Make sure that we will be bashing the right places (immediates should be hardcoded to 0x0f0f0f0f0f0f0f0f0,
+            // and the shift amounts to 0x16).
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pWriteWatchTableImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pRegionToGenTableImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0x16 == *(UINT8*)m_pRegionShrDest);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pLowerBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pUpperBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0x16 == *(UINT8*)m_pRegionShrSrc);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardTableImmediate);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            m_pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_WriteWatch_Regions64, Patch_Label_CardBundleTable, 2);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardBundleTableImmediate);
+#endif
+            break;
+        }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
         default:
@@ -440,12 +560,14 @@ void WriteBarrierManager::Initialize()
 #ifdef FEATURE_SVR_GC
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_SVR64));
 #endif // FEATURE_SVR_GC
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_REGIONS64));
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_PREGROW64));
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_POSTGROW64));
 #ifdef FEATURE_SVR_GC
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_SVR64));
 #endif // FEATURE_SVR_GC
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_REGIONS64));
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 #if !defined(CODECOVERAGE)
@@ -476,6 +598,14 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
             }
 #endif
 
+            // The GC only gives us a region to generation table if it's using regions and wants
+            // the barrier to look up the generations; the bounds are then fixed for the process.
+            if (g_region_to_generation_table != nullptr)
+            {
+                writeBarrierType = WRITE_BARRIER_REGIONS64;
+                continue;
+            }
+
             writeBarrierType = GCHeapUtilities::IsServerHeap() ? WRITE_BARRIER_SVR64 : WRITE_BARRIER_PREGROW64;
             continue;
 
@@ -494,6 +624,9 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
             break;
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+            break;
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             if (bReqUpperBoundsCheck)
@@ -509,6 +642,9 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
         case WRITE_BARRIER_WRITE_WATCH_SVR64:
             break;
 #endif // FEATURE_SVR_GC
+
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+            break;
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
         default:
@@ -578,6 +714,16 @@ int WriteBarrierManager::UpdateEphemeralBounds(bool isRuntimeSuspended)
         }
 #endif // FEATURE_SVR_GC
 
+        // The region barriers check the generations themselves, their bounds are the
+        // heap's and are patched in UpdateWriteWatchAndCardTableLocations.
+        case WRITE_BARRIER_REGIONS64:
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+        {
+            break;
+        }
+
         default:
             UNREACHABLE_MSG("unexpected m_currentWriteBarrier in UpdateEphemeralBounds");
     }
@@ -612,6 +758,7 @@ int WriteBarrierManager::UpdateWriteWatchAndCardTableLocations(bool isRuntimeSus
 #ifdef FEATURE_SVR_GC
         case WRITE_BARRIER_WRITE_WATCH_SVR64:
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
             if (*(UINT64*)m_pWriteWatchTableImmediate != (size_t)g_sw_ww_table)
             {
                 ExecutableWriterHolder<UINT64> writeWatchTableImmediateWriterHolder((UINT64*)m_pWriteWatchTableImmediate, sizeof(UINT64));
@@ -625,6 +772,54 @@ int WriteBarrierManager::UpdateWriteWatchAndCardTableLocations(bool isRuntimeSus
     }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
+    switch (m_currentWriteBarrier)
+    {
+        case WRITE_BARRIER_REGIONS64:
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+            if (*(UINT64*)m_pRegionToGenTableImmediate != (size_t)g_region_to_generation_table)
+            {
+                ExecutableWriterHolder<UINT64> regionToGenTableImmediateWriterHolder((UINT64*)m_pRegionToGenTableImmediate, sizeof(UINT64));
+                *regionToGenTableImmediateWriterHolder.GetRW() = (size_t)g_region_to_generation_table;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+
+            if (*m_pRegionShrDest != g_region_shr)
+            {
+                ExecutableWriterHolder<UINT8> regionShrDestWriterHolder(m_pRegionShrDest, sizeof(UINT8));
+                *regionShrDestWriterHolder.GetRW() = g_region_shr;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+
+            if (*m_pRegionShrSrc != g_region_shr)
+            {
+                ExecutableWriterHolder<UINT8> regionShrSrcWriterHolder(m_pRegionShrSrc, sizeof(UINT8));
+                *regionShrSrcWriterHolder.GetRW() = g_region_shr;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+
+            // The references we care about are the ones into the heap, whose range does
+            // not change with regions.
+            if (*(UINT64*)m_pLowerBoundImmediate != (size_t)g_lowest_address)
+            {
+                ExecutableWriterHolder<UINT64> lowerBoundImmediateWriterHolder((UINT64*)m_pLowerBoundImmediate, sizeof(UINT64));
+                *lowerBoundImmediateWriterHolder.GetRW() = (size_t)g_lowest_address;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+
+            if (*(UINT64*)m_pUpperBoundImmediate != (size_t)g_highest_address)
+            {
+                ExecutableWriterHolder<UINT64> upperBoundImmediateWriterHolder((UINT64*)m_pUpperBoundImmediate, sizeof(UINT64));
+                *upperBoundImmediateWriterHolder.GetRW() = (size_t)g_highest_address;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+            break;
+
+        default:
+            break;
+    }
+
     if (*(UINT64*)m_pCardTableImmediate != (size_t)g_card_table)
     {
          ExecutableWriterHolder<UINT64> cardTableImmediateWriterHolder((UINT64*)m_pCardTableImmediate, sizeof(UINT64));
@@ -668,6 +863,10 @@ int WriteBarrierManager::SwitchToWriteWatchBarrier(bool isRuntimeSuspended)
             break;
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+            newWriteBarrierType = WRITE_BARRIER_WRITE_WATCH_REGIONS64;
+            break;
+
         default:
             UNREACHABLE();
     }
@@ -698,6 +897,10 @@ int WriteBarrierManager::SwitchToNonWriteWatchBarrier(bool isRuntimeSuspended)
             break;
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_WRITE_WATCH_REGIONS64:
+            newWriteBarrierType = WRITE_BARRIER_REGIONS64;
+            break;
+
         default:
             UNREACHABLE();
     }
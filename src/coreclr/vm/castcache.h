@@ -176,6 +176,10 @@ private:
 // Considering that typically the cache size is small and that hit rates are high with good locality,
 // just keeping the cache around seems a simple and viable strategy.
 //
+// Some workloads (i.e. thousands of interface types) keep missing in a cache of that size, with new entries
+// continuously evicting each other. When the number of evictions from a table of the maximum size reaches the
+// number of its elements, the table is churning and we allow it to keep growing up to MAXIMUM_CHURN_CACHE_SIZE.
+//
 // Additional behaviors that could be considered, if there are scenarios that could be improved:
 //     - flush the cache based on some heuristics
 //     - shrink the cache based on some heuristics
@@ -183,9 +187,11 @@ private:
 #if DEBUG
     static const DWORD INITIAL_CACHE_SIZE = 8;    // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 512;  // make this lower than release to make it easier to reach this in tests.
+    static const DWORD MAXIMUM_CHURN_CACHE_SIZE = 2048;
 #else
     static const DWORD INITIAL_CACHE_SIZE = 128;  // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 4096; // 4096 * sizeof(CastCacheEntry) is 98304 bytes on 64bit. We will rarely need this much though.
+    static const DWORD MAXIMUM_CHURN_CACHE_SIZE = 65536;
 #endif
 
 // Lower bucket size will cause the table to resize earlier
@@ -250,12 +256,19 @@ private:
         }
         CONTRACTL_END;
 
-        DWORD newSize = CacheElementCount(tableData) * 2;
+        DWORD size = CacheElementCount(tableData);
+        DWORD newSize = size * 2;
         if (newSize <= MAXIMUM_CACHE_SIZE)
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
 
+        // the victim counter is bumped on every eviction from this table
+        if (newSize <= MAXIMUM_CHURN_CACHE_SIZE && VictimCounter(tableData) >= size)
+        {
+            return MaybeReplaceCacheWithLarger(newSize);
+        }
+
         return false;
     }
 
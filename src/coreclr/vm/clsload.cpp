@@ -1944,7 +1944,10 @@ ClassLoader::~ClassLoader()
 
     FreeModules();
 
-    m_UnresolvedClassLock.Destroy();
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCKS; i++)
+    {
+        m_UnresolvedClassLocks[i].Destroy();
+    }
     m_AvailableClassLock.Destroy();
     m_AvailableTypesLock.Destroy();
 }
@@ -2004,7 +2007,11 @@ VOID ClassLoader::Init(AllocMemTracker *pamTracker)
                                                           UNRESOLVED_CLASS_HASH_BUCKETS,
                                                           pamTracker);
 
-    m_UnresolvedClassLock.Init(CrstUnresolvedClassLock);
+    static_assert_no_msg((UNRESOLVED_CLASS_HASH_BUCKETS % UNRESOLVED_CLASS_LOCKS) == 0);
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCKS; i++)
+    {
+        m_UnresolvedClassLocks[i].Init(CrstUnresolvedClassLock);
+    }
 
     // This lock is taken within the classloader whenever we have to enter a
     // type in one of the modules governed by the loader.
@@ -2026,6 +2033,14 @@ VOID ClassLoader::Init(AllocMemTracker *pamTracker)
 
 }
 
+CrstExplicitInit *ClassLoader::GetUnresolvedClassLock(TypeKey *pKey)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Matches the bucket of pKey in m_pUnresolvedClassHash, see UNRESOLVED_CLASS_LOCKS
+    return &m_UnresolvedClassLocks[HashTypeKey(pKey) % UNRESOLVED_CLASS_LOCKS];
+}
+
 #endif // #ifndef DACCESS_COMPILE
 
 /*static*/
@@ -3262,8 +3277,11 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(TypeKey *pTypeKey,
         SString name;
         TypeString::AppendTypeKeyDebug(name, pTypeKey);
         LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: LoadTypeHandleForTypeKey for type %S to level %s\n", name.GetUnicode(), classLoadLevelName[targetLevel]));
-        CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLock);
-        m_pUnresolvedClassHash->Dump();
+        for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCKS; i++)
+        {
+            CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLocks[i]);
+            m_pUnresolvedClassHash->Dump(i, UNRESOLVED_CLASS_LOCKS);
+        }
     }
 #endif
 
@@ -3412,7 +3430,7 @@ ClassLoader::LoadTypeHandleForTypeKey_Body(
     }
 
     ReleaseHolder<PendingTypeLoadEntry> pLoadingEntry;
-    CrstHolderWithState unresolvedClassLockHolder(&m_UnresolvedClassLock, false);
+    CrstHolderWithState unresolvedClassLockHolder(GetUnresolvedClassLock(pTypeKey), false);
 
 retry:
     unresolvedClassLockHolder.Acquire();
@@ -3545,7 +3563,7 @@ retry:
         COMPlusThrowOM();
     }
 
-    // Leave the global lock, so that other threads may now start waiting on our class's lock
+    // Leave the hash lock, so that other threads may now start waiting on our class's lock
     unresolvedClassLockHolder.Release();
 
     EX_TRY
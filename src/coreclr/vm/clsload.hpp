@@ -41,6 +41,11 @@ class SigPointer;
 // Hash table parameter for unresolved class hash
 #define UNRESOLVED_CLASS_HASH_BUCKETS 8
 
+// Number of locks protecting the unresolved class hash. A lock protects the buckets whose index is congruent to
+// its own index, so that loads of types that hash to different buckets do not serialize on a single lock.
+// UNRESOLVED_CLASS_HASH_BUCKETS must be a multiple of this.
+#define UNRESOLVED_CLASS_LOCKS 8
+
 // This is information required to look up a type in the loader. Besides the
 // basic name there is the meta data information for the type, whether the
 // the name is case sensitive, and tokens not to load. This last item allows
@@ -494,7 +499,7 @@ class ClassLoader
 private:
     // Classes for which load is in progress
     PendingTypeLoadTable  * m_pUnresolvedClassHash;
-    CrstExplicitInit        m_UnresolvedClassLock;
+    CrstExplicitInit        m_UnresolvedClassLocks[UNRESOLVED_CLASS_LOCKS];
 
     // Protects addition of elements to module's m_pAvailableClasses.
     // (indeed thus protects addition of elements to any m_pAvailableClasses in any
@@ -533,6 +538,9 @@ public:
 
 private:
 
+    // The lock protecting the entry for pKey in m_pUnresolvedClassHash
+    CrstExplicitInit *GetUnresolvedClassLock(TypeKey *pKey);
+
     VOID PopulateAvailableClassHashTable(Module *pModule,
                                          AllocMemTracker *pamTracker);
 
@@ -58,6 +58,9 @@ VOLATILE_SVAL_IMPL_INIT(LONG, ExecutionManager, m_dwWriterLock, 0);
 CrstStatic ExecutionManager::m_JumpStubCrst;
 CrstStatic ExecutionManager::m_RangeCrst;
 
+Volatile<ExecutionManager::RangeSectionLookup*> ExecutionManager::m_pCodeRangeLookup = NULL;
+ExecutionManager::RangeSectionLookup*           ExecutionManager::m_pRetiredCodeRangeLookups = NULL;
+
 unsigned   ExecutionManager::m_normal_JumpStubLookup;
 unsigned   ExecutionManager::m_normal_JumpStubUnique;
 unsigned   ExecutionManager::m_normal_JumpStubBlockAllocCount;
@@ -4836,6 +4839,41 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
     }
 #endif
 
+#ifndef DACCESS_COMPILE
+    RangeSectionLookup *pLookup = m_pCodeRangeLookup;
+
+    if (pLookup != NULL)
+    {
+        // Find the first section, in order of decreasing LowAddress, that starts at or below addr
+        COUNT_T lo = 0;
+        COUNT_T hi = pLookup->count;
+        while (lo < hi)
+        {
+            COUNT_T mid = lo + (hi - lo) / 2;
+            if (pLookup->sections[mid]->LowAddress <= addr)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+
+        if ((lo < pLookup->count) && (addr < pLookup->sections[lo]->HighAddress))
+        {
+            pCurr = pLookup->sections[lo];
+            pLast = pCurr;
+        }
+        else
+        {
+            // Like the list walk below, remember the section just above addr
+            pCurr = NULL;
+            pLast = (lo > 0) ? pLookup->sections[lo - 1] : NULL;
+        }
+    }
+    else
+#endif
     while (pCurr != NULL)
     {
         // See if addr is in [pCurr->LowAddress .. pCurr->HighAddress)
@@ -5044,6 +5082,8 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
     } CONTRACTL_END;
 
     RangeSection *pnewrange = new RangeSection;
+    NewHolder<RangeSection> pnewrangeHolder(pnewrange);
+    RangeSectionLookup *pLookupsToFree = NULL;
 
     _ASSERTE(pEndRange > pStartRange);
 
@@ -5060,6 +5100,14 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
     {
         CrstHolder ch(&m_RangeCrst); // Acquire the Crst before linking in a new RangeList
 
+        // Allocate the new lookup snapshot first so that failing to allocate it leaves the list unchanged
+        COUNT_T count = 1;
+        for (RangeSection * pCount = m_CodeRangeList; pCount != NULL; pCount = pCount->pnext)
+        {
+            count++;
+        }
+        RangeSectionLookup * pNewLookup = CreateRangeSectionLookup(count, true);
+
         RangeSection * current  = m_CodeRangeList;
         RangeSection * previous = NULL;
 
@@ -5102,9 +5150,142 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
         {
             m_CodeRangeList = pnewrange;
         }
+
+        pnewrangeHolder.SuppressRelease();
+        FillRangeSectionLookup(pNewLookup);
+
+        // Readers may still be using the old snapshot, so it is retired rather than freed
+        RangeSectionLookup * pOldLookup = m_pCodeRangeLookup;
+        m_pCodeRangeLookup = pNewLookup;
+        RetireRangeSectionLookup(pOldLookup);
+
+        RangeSectionLookup ** ppUnused = FindUnusedRangeSectionLookups();
+        if (ppUnused != NULL)
+        {
+            // Lock out the readers that hold the reader lock, they may still be searching them
+            WriterLockHolder wlh;
+            pLookupsToFree = *ppUnused;
+            *ppUnused = NULL;
+        }
+    }
+
+    FreeRangeSectionLookups(pLookupsToFree);
+}
+
+// Returns the GC count that retired snapshots are stamped with
+unsigned ExecutionManager::GetRangeSectionLookupEpoch()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return GCHeapUtilities::IsGCHeapInitialized() ? GCHeapUtilities::GetGCHeap()->GetGcCount() : 0;
+}
+
+// Adds a snapshot that has been replaced in m_pCodeRangeLookup to the retired list
+void ExecutionManager::RetireRangeSectionLookup(RangeSectionLookup* pLookup)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    if (pLookup != NULL)
+    {
+        pLookup->retiredEpoch = GetRangeSectionLookupEpoch();
+        pLookup->pNextRetired = m_pRetiredCodeRangeLookups;
+        m_pRetiredCodeRangeLookups = pLookup;
     }
 }
 
+// Returns the link to the first retired snapshot that only readers holding the reader lock may still
+// be using, or NULL if there is none. The snapshots after it are retired earlier, so they can go too.
+//
+// Threads that do not take the reader lock only search a snapshot while in cooperative mode, or as
+// part of a GC. Once a GC has started and finished after a snapshot was retired, every such thread
+// has been suspended or has finished its GC since, and none of them can still be using it. A GC that
+// was already running when the snapshot was retired does not count, hence the epoch difference of 2.
+ExecutionManager::RangeSectionLookup** ExecutionManager::FindUnusedRangeSectionLookups()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    unsigned epoch = GetRangeSectionLookupEpoch();
+
+    for (RangeSectionLookup ** ppLookup = &m_pRetiredCodeRangeLookups; *ppLookup != NULL; ppLookup = &(*ppLookup)->pNextRetired)
+    {
+        if ((epoch - (*ppLookup)->retiredEpoch) >= 2)
+        {
+            return ppLookup;
+        }
+    }
+
+    return NULL;
+}
+
+// Frees a list of snapshots unlinked by FindUnusedRangeSectionLookups
+void ExecutionManager::FreeRangeSectionLookups(RangeSectionLookup* pLookups)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (pLookups != NULL)
+    {
+        RangeSectionLookup *pNext = pLookups->pNextRetired;
+        delete [] (BYTE *)pLookups;
+        pLookups = pNext;
+    }
+}
+
+// Creates a snapshot of m_CodeRangeList for lookups, the list is expected to hold count sections
+ExecutionManager::RangeSectionLookup* ExecutionManager::CreateRangeSectionLookup(COUNT_T count, bool fThrow)
+{
+    CONTRACTL {
+        if (fThrow) THROWS; else NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    S_SIZE_T cbLookup = S_SIZE_T(offsetof(RangeSectionLookup, sections)) + S_SIZE_T(max(count, (COUNT_T)1)) * S_SIZE_T(sizeof(RangeSection*));
+    if (cbLookup.IsOverflow())
+    {
+        if (fThrow)
+            ThrowOutOfMemory();
+        return NULL;
+    }
+
+    BYTE * pMem = fThrow ? new BYTE[cbLookup.Value()] : new (nothrow) BYTE[cbLookup.Value()];
+    if (pMem == NULL)
+    {
+        return NULL;
+    }
+
+    RangeSectionLookup * pLookup = (RangeSectionLookup *)pMem;
+    pLookup->pNextRetired = NULL;
+    pLookup->retiredEpoch = 0;
+    pLookup->count = count;
+    return pLookup;
+}
+
+// Copies m_CodeRangeList into a snapshot created by CreateRangeSectionLookup
+void ExecutionManager::FillRangeSectionLookup(RangeSectionLookup* pLookup)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    COUNT_T i = 0;
+    for (RangeSection * pCurr = m_CodeRangeList; pCurr != NULL; pCurr = pCurr->pnext)
+    {
+        _ASSERTE(i < pLookup->count);
+        pLookup->sections[i++] = pCurr;
+    }
+    _ASSERTE(i == pLookup->count);
+}
+
 // Deletes a single range starting at pStartRange
 void ExecutionManager::DeleteRange(TADDR pStartRange)
 {
@@ -5114,6 +5295,7 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
     } CONTRACTL_END;
 
     RangeSection *pCurr = NULL;
+    RangeSectionLookup *pLookupsToFree = NULL;
     {
         // Acquire the Crst before unlinking a RangeList.
         // NOTE: The Crst must be acquired BEFORE we grab the writer lock, as the
@@ -5154,6 +5336,33 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
                 head->pLastUsed = NULL;
             }
 
+            // Publish a snapshot without pCurr. If it cannot be allocated, readers fall back to
+            // walking the list.
+            RangeSectionLookup * pOldLookup = m_pCodeRangeLookup;
+            _ASSERTE(pOldLookup == NULL || pOldLookup->count > 0);
+
+            RangeSectionLookup * pNewLookup = NULL;
+            if ((pOldLookup != NULL) && (pOldLookup->count > 1))
+            {
+                pNewLookup = CreateRangeSectionLookup(pOldLookup->count - 1, false);
+                if (pNewLookup != NULL)
+                {
+                    FillRangeSectionLookup(pNewLookup);
+                }
+            }
+            m_pCodeRangeLookup = pNewLookup;
+
+            // The writer lock only locks out the readers that take the reader lock, so the old
+            // snapshot is retired like in AddRange
+            RetireRangeSectionLookup(pOldLookup);
+
+            RangeSectionLookup ** ppUnused = FindUnusedRangeSectionLookups();
+            if (ppUnused != NULL)
+            {
+                pLookupsToFree = *ppUnused;
+                *ppUnused = NULL;
+            }
+
             //
             // Cannot delete pCurr here because we own the WriterLock and if this is
             // a hosted scenario then the hosting api callback cannot occur in a forbid
@@ -5173,6 +5382,8 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
 #endif // defined(TARGET_AMD64)
         delete pCurr;
     }
+
+    FreeRangeSectionLookups(pLookupsToFree);
 }
 
 #endif // #ifndef DACCESS_COMPILE
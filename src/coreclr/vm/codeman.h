@@ -1354,6 +1354,29 @@ private:
         WriterLockHolder();
         ~WriterLockHolder();
     };
+
+    // A snapshot of m_CodeRangeList as an array in the same order (decreasing LowAddress),
+    // so that GetRangeSection can binary search it instead of walking the list. A new snapshot
+    // is published whenever the list changes. Replaced snapshots may still be in use by readers,
+    // so they are retired, stamped with the GC count. The next AddRange or DeleteRange after two
+    // more GCs have started frees them, see FindUnusedRangeSectionLookups.
+    struct RangeSectionLookup
+    {
+        RangeSectionLookup* pNextRetired;
+        unsigned            retiredEpoch;
+        COUNT_T             count;
+        RangeSection*       sections[1];
+    };
+
+    static Volatile<RangeSectionLookup*> m_pCodeRangeLookup;
+    static RangeSectionLookup*           m_pRetiredCodeRangeLookups;   // Protected by m_RangeCrst, newest first
+
+    static RangeSectionLookup* CreateRangeSectionLookup(COUNT_T count, bool fThrow);
+    static void FillRangeSectionLookup(RangeSectionLookup* pLookup);
+    static unsigned GetRangeSectionLookupEpoch();
+    static void RetireRangeSectionLookup(RangeSectionLookup* pLookup);
+    static RangeSectionLookup** FindUnusedRangeSectionLookups();
+    static void FreeRangeSectionLookups(RangeSectionLookup* pLookups);
 #endif
 
 #if defined(_DEBUG)
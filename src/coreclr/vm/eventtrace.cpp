@@ -463,6 +463,10 @@ VOID ETW::GCLog::GCSettingsEvent()
 //---------------------------------------------------------------------------------------
 
 bool s_forcedGCInProgress = false;
+
+// Set from the time ForceBGCForHeapDump asks for a heap dump until the background GC
+// streaming it is done marking
+static Volatile<bool> s_bgcHeapDumpInProgress = false;
 class ForcedGCHolder
 {
 public:
@@ -872,6 +876,17 @@ VOID ETW::GCLog::ForceGC(LONGLONG l64ClientSequenceNumber)
 
     InterlockedExchange64(&s_l64LastClientSequenceNumber, l64ClientSequenceNumber);
 
+#ifndef FEATURE_NATIVEAOT
+    if (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_GCHeapDumpDuringBGC) &&
+        ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                     TRACE_LEVEL_INFORMATION,
+                                     CLR_GCHEAPDUMP_KEYWORD) &&
+        ForceBGCForHeapDump())
+    {
+        return;
+    }
+#endif // FEATURE_NATIVEAOT
+
     ForceGCForDiagnostics();
 }
 
@@ -980,6 +995,167 @@ HRESULT ETW::GCLog::ForceGCForDiagnostics()
     return hr;
 }
 
+#ifndef FEATURE_NATIVEAOT
+//---------------------------------------------------------------------------------------
+//
+// Used by ForceGC when ETW_GCHeapDumpDuringBGC is set. Instead of walking the heap at the
+// end of a blocking GC, this asks the next background GC to hand over the objects it
+// marks and then starts one, so the heap dump is streamed while the runtime keeps
+// running. Only gen2 and UOH objects are reported, and roots are not.
+//
+// Return Value:
+//      true if the background GC was started; false if the caller should fall back to
+//      ForceGCForDiagnostics
+//
+
+// static
+bool ETW::GCLog::ForceBGCForHeapDump()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsGarbageCollectorFullyInitialized());
+
+    // See ForceGCForDiagnostics for why the Thread object is created here
+    if (GetThreadNULLOk() == NULL)
+    {
+        HRESULT hr = E_FAIL;
+        SetupThreadNoThrow(&hr);
+        if (FAILED(hr))
+            return false;
+    }
+
+    ASSERT_NO_EE_LOCKS_HELD();
+
+    s_bgcHeapDumpInProgress = true;
+    if (!GCHeapUtilities::GetGCHeap()->DiagStreamBGCMarkedObjects(&ETW::GCLog::WalkBGCMarkedObjects, NULL))
+    {
+        s_bgcHeapDumpInProgress = false;
+        return false;
+    }
+
+    EX_TRY
+    {
+        GCX_COOP();
+
+        GCHeapUtilities::GetGCHeap()->GarbageCollect(
+            GCHeapUtilities::GetGCHeap()->GetMaxGeneration(),
+            false,  // low_memory_p
+            collection_non_blocking);
+    }
+    EX_CATCH { }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    return true;
+}
+
+struct BGCObjectRefBuffer
+{
+    Object ** pCur;
+    Object ** pEnd;
+};
+
+static bool CountBGCObjectRef(Object * pBO, void * context)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    (*((size_t *)context))++;
+    return true;
+}
+
+static bool SaveBGCObjectRef(Object * pBO, void * context)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The object can be modified while we walk it, so it may have gained references since
+    // they were counted. Stop once the buffer is full.
+    BGCObjectRefBuffer * pBuffer = (BGCObjectRefBuffer *)context;
+    if (pBuffer->pCur == pBuffer->pEnd)
+        return false;
+
+    *(pBuffer->pCur++) = pBO;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Callback of type bgc_mark_walk_fn used by the GC during a background GC started by
+// ForceBGCForHeapDump. Sends a chunk of marked objects and their references as GCBulkNode
+// and GCBulkEdge events. It can run on several background GC threads at once, each call
+// batches into its own context.
+//
+// Arguments:
+//      objects - gen2 and UOH objects marked by the background GC
+//      count - number of objects, 0 when the background GC is done marking
+//      context - unused
+//
+
+// static
+void ETW::GCLog::WalkBGCMarkedObjects(Object ** objects, size_t count, void * context)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+
+        // ObjectReference can take the type log lock
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (count == 0)
+    {
+        s_bgcHeapDumpInProgress = false;
+        return;
+    }
+
+    if (!ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                      TRACE_LEVEL_INFORMATION,
+                                      CLR_GCHEAPDUMP_KEYWORD))
+    {
+        return;
+    }
+
+    ProfilerWalkHeapContext profilerWalkHeapContext(FALSE, NULL);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Object * pObj = objects[i];
+        Object * rgRefsOnStack[32];
+        Object ** rgRefs = rgRefsOnStack;
+        size_t cRefs = 0;
+
+        GCHeapUtilities::GetGCHeap()->DiagWalkObject(pObj, &CountBGCObjectRef, (void *)&cRefs);
+        if (cRefs > ARRAY_SIZE(rgRefsOnStack))
+        {
+            rgRefs = new (nothrow) Object * [cRefs];
+            if (rgRefs == NULL)
+                continue;
+        }
+
+        BGCObjectRefBuffer buffer = { rgRefs, rgRefs + cRefs };
+        GCHeapUtilities::GetGCHeap()->DiagWalkObject(pObj, &SaveBGCObjectRef, (void *)&buffer);
+        cRefs = buffer.pCur - rgRefs;
+
+        TypeHandle th = pObj->GetGCSafeTypeHandleIfPossible();
+        ObjectReference(&profilerWalkHeapContext, pObj, (ULONGLONG)th.AsTAddr(), cRefs, rgRefs);
+
+        if (rgRefs != rgRefsOnStack)
+        {
+            delete [] rgRefs;
+        }
+    }
+
+    EndHeapDump(&profilerWalkHeapContext);
+}
+#endif // FEATURE_NATIVEAOT
+
 
 
 
@@ -2441,7 +2617,7 @@ VOID ETW::GCLog::EndHeapDump(ProfilerWalkHeapContext * profilerWalkHeapContext)
         return;
 
     // If the GC events are enabled, flush any remaining root, node, and / or edge data
-    if (s_forcedGCInProgress &&
+    if ((s_forcedGCInProgress || s_bgcHeapDumpInProgress) &&
         ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
                                      TRACE_LEVEL_INFORMATION,
                                      CLR_GCHEAPDUMP_KEYWORD))
@@ -3147,6 +3323,226 @@ void ETW::TypeSystemLog::SendObjectAllocatedEvent(Object * pObject)
     }
 }
 
+OBJECTHANDLE ETW::AllocationSamplingLog::s_rgTrackedSampleHandles[ETW::AllocationSamplingLog::s_cTrackedSamples];
+UINT64 ETW::AllocationSamplingLog::s_rgTrackedSampleIDs[ETW::AllocationSamplingLog::s_cTrackedSamples];
+INT64 ETW::AllocationSamplingLog::s_nMeanBytesBetweenSamples = 0;
+UINT64 ETW::AllocationSamplingLog::s_nNextSampleID = 0;
+unsigned int ETW::AllocationSamplingLog::s_nLastScannedGCCount = 0;
+
+// Marks a slot of s_rgTrackedSampleHandles that a thread has claimed but not filled yet
+#define ALLOCATION_SAMPLE_SLOT_CLAIMED ((OBJECTHANDLE)1)
+
+//---------------------------------------------------------------------------------------
+//
+// Use this to decide whether to sample allocations
+//
+// Return Value:
+//      nonzero iff the AllocationSampling keyword is enabled.
+//
+
+// static
+BOOL ETW::AllocationSamplingLog::IsEnabled()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                        TRACE_LEVEL_INFORMATION,
+                                        CLR_ALLOCATIONSAMPLING_KEYWORD);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Draws the number of bytes the thread allocates before its next sample. The intervals
+// are exponentially distributed so that samples are a Poisson process over the allocated
+// bytes, which keeps allocation patterns from aliasing with the sampling rate.
+//
+// Arguments:
+//      * pThread - Thread whose random state is used
+//
+
+// static
+INT64 ETW::AllocationSamplingLog::GetNextSamplingInterval(Thread * pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // xorshift64, good enough for sampling and cheap to keep per thread
+    UINT64 x = pThread->m_allocSamplingRandomState;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    pThread->m_allocSamplingRandomState = x;
+
+    // Uniform in (0, 1]
+    double u = (double)((x >> 11) + 1) * (1.0 / 9007199254740992.0);
+    INT64 interval = (INT64)(-log(u) * (double)s_nMeanBytesBetweenSamples);
+    return max(interval, (INT64)1);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Called for every allocation that went through the allocation slow path. The bytes the
+// thread's allocation context got since the last slow path allocation are charged to
+// the thread's sampling budget, and if it runs out this object is sampled. Since the
+// object that goes to the slow path is the one that doesn't fit in what's left of the
+// allocation context, it is picked with a probability proportional to its size, just
+// like an object an exact byte sampler would land in.
+//
+// Arguments:
+//      * pObject - Object that was just allocated
+//      * allocationKind - 0 for SOH, 1 for LOH and 2 for POH, as in GCAllocationKindMap
+//
+
+// static
+void ETW::AllocationSamplingLog::OnAllocationSlowPath(Object * pObject, UINT32 allocationKind)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    // Without per thread allocation contexts we can't tell how much each thread allocated
+    if (!GCHeapUtilities::UseThreadAllocationContexts() || !g_fEEStarted)
+        return;
+
+    Thread * pThread = GetThread();
+    gc_alloc_context * pAllocContext = pThread->GetAllocContext();
+    INT64 allocBytes = pAllocContext->alloc_bytes + pAllocContext->alloc_bytes_uoh;
+
+    if (s_nMeanBytesBetweenSamples == 0)
+    {
+        DWORD dwMeanBytes = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_AllocationSamplingMeanBytes);
+        s_nMeanBytesBetweenSamples = max(dwMeanBytes, (DWORD)1);
+    }
+
+    if (pThread->m_allocSamplingRandomState == 0)
+    {
+        // First slow path allocation of this thread with sampling on
+        pThread->m_allocSamplingRandomState = (((UINT64)GetTickCount64() << 32) ^ (UINT64)(SIZE_T)pThread) | 1;
+        pThread->m_allocSamplingBytesLeft = GetNextSamplingInterval(pThread);
+        pThread->m_allocSamplingLastAllocBytes = allocBytes;
+        return;
+    }
+
+    pThread->m_allocSamplingBytesLeft -= allocBytes - pThread->m_allocSamplingLastAllocBytes;
+    pThread->m_allocSamplingLastAllocBytes = allocBytes;
+    if (pThread->m_allocSamplingBytesLeft > 0)
+        return;
+
+    // A large object or allocation context can cover more than one sampling interval, in
+    // which case this sample stands for all of them.
+    UINT64 cSamples = 0;
+    while (pThread->m_allocSamplingBytesLeft <= 0)
+    {
+        pThread->m_allocSamplingBytesLeft += GetNextSamplingInterval(pThread);
+        cSamples++;
+    }
+
+    ReportFreedSamples();
+
+    UINT64 sampleID = (UINT64)InterlockedIncrement64((LONGLONG *)&s_nNextSampleID);
+    TrackSample(pObject, sampleID);
+
+    TypeHandle th = pObject->GetTypeHandle();
+    ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(NULL, th.AsTAddr(), ETW::TypeSystemLog::kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+
+    FireEtwAllocationSampled(
+        allocationKind,
+        GetClrInstanceId(),
+        (LPVOID) th.AsTAddr(),
+        pObject,
+        pObject->GetSize(),
+        cSamples * (UINT64)s_nMeanBytesBetweenSamples,
+        sampleID);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Keeps a short weak handle to a sampled object so its death can be reported. If too
+// many samples are alive, the new one is not tracked.
+//
+
+// static
+void ETW::AllocationSamplingLog::TrackSample(Object * pObject, UINT64 sampleID)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    for (int i = 0; i < s_cTrackedSamples; i++)
+    {
+        if ((s_rgTrackedSampleHandles[i] != NULL) ||
+            (InterlockedCompareExchangeT(&s_rgTrackedSampleHandles[i], ALLOCATION_SAMPLE_SLOT_CLAIMED, (OBJECTHANDLE)NULL) != NULL))
+        {
+            continue;
+        }
+
+        OBJECTHANDLE handle = NULL;
+        EX_TRY
+        {
+            handle = GetAppDomain()->CreateShortWeakHandle(ObjectToOBJECTREF(pObject));
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        s_rgTrackedSampleIDs[i] = sampleID;
+        VolatileStore(&s_rgTrackedSampleHandles[i], handle);
+        return;
+    }
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Fires AllocationSampleFreed for the tracked samples collected since the last time this
+// was called. This is done lazily from the allocation path rather than at the end of a GC
+// so there's no extra work done while the EE is suspended, and only once per GC.
+//
+
+// static
+void ETW::AllocationSamplingLog::ReportFreedSamples()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    unsigned int gcCount = (unsigned int)GCHeapUtilities::GetGCHeap()->CollectionCount(0);
+    unsigned int lastScannedGCCount = VolatileLoad(&s_nLastScannedGCCount);
+    if ((gcCount == lastScannedGCCount) ||
+        (InterlockedCompareExchangeT(&s_nLastScannedGCCount, gcCount, lastScannedGCCount) != lastScannedGCCount))
+    {
+        return;
+    }
+
+    for (int i = 0; i < s_cTrackedSamples; i++)
+    {
+        OBJECTHANDLE handle = VolatileLoad(&s_rgTrackedSampleHandles[i]);
+        if ((handle == NULL) || (handle == ALLOCATION_SAMPLE_SLOT_CLAIMED) ||
+            (ObjectFromHandle(handle) != NULL))
+        {
+            continue;
+        }
+
+        UINT64 sampleID = s_rgTrackedSampleIDs[i];
+        if (InterlockedCompareExchangeT(&s_rgTrackedSampleHandles[i], (OBJECTHANDLE)NULL, handle) != handle)
+            continue;
+
+        DestroyShortWeakHandle(handle);
+        FireEtwAllocationSampleFreed(GetClrInstanceId(), sampleID, gcCount);
+    }
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Accessor for global hash table crst
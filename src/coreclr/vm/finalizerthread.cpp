@@ -31,11 +31,25 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+// Upper bound on FinalizerThreadCount, the finalizer thread included.
+#define MAX_FINALIZER_THREAD_COUNT 64
+
+DWORD FinalizerThread::s_helperCount = 0;
+CLREvent * FinalizerThread::s_helperStartEvents = NULL;
+CLREvent * FinalizerThread::hEventFinalizerHelpersDone = NULL;
+LONG FinalizerThread::s_helpersBusy = 0;
+LONG FinalizerThread::s_helperFinalizedCount = 0;
+Volatile<bool> FinalizerThread::s_helperOnlyNonCritical = false;
+
+static thread_local DWORD t_finalizerHelperIndex;
+static thread_local bool t_finalizerHelperInPass;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    // Finalizer helper threads count as the finalizer thread, they can't wait for finalization either.
+    return (GetThreadNULLOk() == g_pFinalizerThread) || IsFinalizerThread();
 }
 
 void FinalizerThread::EnableFinalization()
@@ -92,26 +106,237 @@ void FinalizerThread::FinalizeAllObjects()
 
     unsigned int fcount = 0;
 
-    Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+    if (s_helperCount != 0)
+    {
+        // Critical finalizers have to run after the normal finalizers of the objects that became
+        // unreachable with them, so all the threads are done with the normal finalizers before
+        // any of them starts on the critical ones.
+        fcount = FinalizeObjectsWithHelpers(true);
+        fcount += FinalizeObjectsWithHelpers(false);
+    }
+    else
+    {
+        Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+
+        Thread *pThread = GetThread();
+
+        // Finalize everyone
+        while (fobj && !fQuitFinalizer)
+        {
+            fcount++;
+
+            CallFinalizer(fobj);
+
+            // thread abort could be injected by the debugger,
+            // but should not be allowed to "leak" out of expression evaluation
+            _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
+
+            pThread->InternalReset();
+
+            fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+        }
+    }
+    FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
+}
+
+// Runs finalizers on the current thread, which is finalizer thread threadIndex with the finalizer
+// thread being 0, until the queues are empty or all that's left are critical finalizers and
+// onlyNonCritical is set.
+unsigned int FinalizerThread::FinalizeObjectsOnThread(int threadIndex, bool onlyNonCritical)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    unsigned int fcount = 0;
+    int threadCount = (int)s_helperCount + 1;
+
+    Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizableForThread(threadIndex, threadCount, onlyNonCritical);
 
     Thread *pThread = GetThread();
 
-    // Finalize everyone
     while (fobj && !fQuitFinalizer)
     {
         fcount++;
 
         CallFinalizer(fobj);
 
-        // thread abort could be injected by the debugger,
-        // but should not be allowed to "leak" out of expression evaluation
-        _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
+        _ASSERTE(!pThread->IsAbortRequested());
 
         pThread->InternalReset();
 
-        fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+        fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizableForThread(threadIndex, threadCount, onlyNonCritical);
     }
-    FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
+
+    return fcount;
+}
+
+// Has the helper threads and the finalizer thread drain the finalization queues together, and
+// returns once they all are done.
+unsigned int FinalizerThread::FinalizeObjectsWithHelpers(bool onlyNonCritical)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    _ASSERTE(GetThread() == GetFinalizerThread());
+
+    s_helperOnlyNonCritical = onlyNonCritical;
+    s_helperFinalizedCount = 0;
+    s_helpersBusy = (LONG)s_helperCount;
+    hEventFinalizerHelpersDone->Reset();
+
+    for (DWORD i = 0; i < s_helperCount; i++)
+    {
+        s_helperStartEvents[i].Set();
+    }
+
+    unsigned int fcount = FinalizeObjectsOnThread(0, onlyNonCritical);
+
+    {
+        // The finalizers still running on the helpers may need a GC to make progress.
+        GCX_PREEMP();
+        hEventFinalizerHelpersDone->Wait(INFINITE, FALSE);
+    }
+
+    return fcount + (unsigned int)s_helperFinalizedCount;
+}
+
+void FinalizerThread::FinishHelperPass()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    t_finalizerHelperInPass = false;
+    if (InterlockedDecrement(&s_helpersBusy) == 0)
+    {
+        hEventFinalizerHelpersDone->Set();
+    }
+}
+
+VOID FinalizerThread::FinalizerHelperWorker(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    Thread *pThread = GetThread();
+    DWORD index = t_finalizerHelperIndex;
+
+    // Helpers never quit, the finalizer thread may start one more pass while shutting down.
+    while (true)
+    {
+        _ASSERTE(pThread->PreemptiveGCDisabled());
+        pThread->EnablePreemptiveGC();
+        s_helperStartEvents[index].Wait(INFINITE, FALSE);
+        pThread->DisablePreemptiveGC();
+
+        t_finalizerHelperInPass = true;
+
+        unsigned int fcount = FinalizeObjectsOnThread((int)index + 1, s_helperOnlyNonCritical);
+        InterlockedExchangeAdd(&s_helperFinalizedCount, (LONG)fcount);
+
+        FinishHelperPass();
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperStart(void *args)
+{
+    ClrFlsSetThreadType (ThreadType_Finalizer);
+
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    t_finalizerHelperIndex = (DWORD)(size_t)args;
+
+    Thread *pThread = GetThread();
+
+    if (pThread->HasStarted())
+    {
+        INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+        {
+            while (true)
+            {
+                // Same policy for exceptions escaping a finalizer as on the finalizer thread.
+                ManagedThreadBase::FinalizerBase(FinalizerHelperWorker);
+
+                // If we came out on an exception, the finalizer thread is still waiting for
+                // us to finish the pass.
+                if (t_finalizerHelperInPass)
+                {
+                    FinishHelperPass();
+                }
+            }
+        }
+        UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+    }
+
+    // We could not run managed code, but the finalizer thread still waits for us in every pass.
+    while (true)
+    {
+        s_helperStartEvents[t_finalizerHelperIndex].Wait(INFINITE, FALSE);
+        FinishHelperPass();
+    }
+
+    return 0;
+}
+
+// Starts the helper threads asked for with FinalizerThreadCount. If some of them can't be created,
+// finalization goes on with the ones that could.
+void FinalizerThread::FinalizerHelpersCreate()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() == GetFinalizerThread());
+
+    DWORD threadCount = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_FinalizerThreadCount);
+    if (threadCount <= 1)
+    {
+        return;
+    }
+
+    DWORD helperCount = min(threadCount, (DWORD)MAX_FINALIZER_THREAD_COUNT) - 1;
+
+    EX_TRY
+    {
+        hEventFinalizerHelpersDone = new CLREvent();
+        hEventFinalizerHelpersDone->CreateManualEvent(FALSE);
+
+        s_helperStartEvents = new CLREvent[helperCount];
+        for (DWORD i = 0; i < helperCount; i++)
+        {
+            s_helperStartEvents[i].CreateAutoEvent(FALSE);
+        }
+
+        // Only the finalizer thread starts passes, so the count can grow as helpers get created.
+        for (DWORD i = 0; i < helperCount; i++)
+        {
+            Thread *pHelper = SetupUnstartedThread();
+#ifdef FEATURE_COMINTEROP
+            pHelper->SetApartment(Thread::AS_InMTA);
+#endif
+            pHelper->SetBackground(TRUE);
+
+            if (!pHelper->CreateNewThread(0, &FinalizerHelperStart, (void *)(size_t)i, W(".NET Finalizer Helper")))
+            {
+                pHelper->DecExternalCount(FALSE);
+                break;
+            }
+
+            pHelper->StartThread();
+            s_helperCount = i + 1;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    LOG((LF_GC, LL_INFO10, "Finalizer thread started %d helper threads\n", s_helperCount));
 }
 
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
@@ -298,6 +523,8 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         {
             s_InitializedFinalizerThreadForPlatform = TRUE;
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
+
+            FinalizerHelpersCreate();
         }
 
         JitHost::Reclaim();
@@ -34,6 +34,22 @@ class FinalizerThread
 
     static void FinalizeAllObjects();
 
+    // With FinalizerThreadCount above 1, helper threads run finalizers alongside the finalizer
+    // thread. Each pass over the queues is started and waited for by the finalizer thread.
+    static DWORD s_helperCount;
+    static CLREvent *s_helperStartEvents;
+    static CLREvent *hEventFinalizerHelpersDone;
+    static LONG s_helpersBusy;
+    static LONG s_helperFinalizedCount;
+    static Volatile<bool> s_helperOnlyNonCritical;
+
+    static void FinalizerHelpersCreate();
+    static DWORD WINAPI FinalizerHelperStart(void *args);
+    static VOID FinalizerHelperWorker(void *args);
+    static unsigned int FinalizeObjectsOnThread(int threadIndex, bool onlyNonCritical);
+    static unsigned int FinalizeObjectsWithHelpers(bool onlyNonCritical);
+    static void FinishHelperPass();
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -935,6 +935,41 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
     return memStatus.ullTotalPhys;
 }
 
+// Re-read the restricted physical memory limit, which can change while the process is running
+// (e.g. when the memory limit of the container or job object it runs in is adjusted).
+// Return:
+//  the current restricted limit, 0 if the process doesn't run with a restricted limit.
+uint64_t GCToOSInterface::RefreshRestrictedPhysicalMemoryLimit()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    VolatileStore(&g_RestrictedPhysicalMemoryLimit, (size_t)MAX_PTR);
+    return GetRestrictedPhysicalMemoryLimit();
+}
+
+// Get how much the process is stalled waiting on memory.
+// Parameters:
+//  pressure - A number between 0 and 100 that specifies the percentage of time in the last 10 seconds
+//      some threads were stalled because there wasn't enough physical memory.
+// Return:
+//  true if it has succeeded, false if the OS doesn't provide this information
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef TARGET_UNIX
+    UINT32 psi_pressure;
+    if (!PAL_GetMemoryPressure(&psi_pressure))
+        return false;
+
+    *pressure = psi_pressure;
+    return true;
+#else
+    // Windows has no equivalent of Linux pressure stall information
+    return false;
+#endif // TARGET_UNIX
+}
+
 // Get memory status
 // Parameters:
 //  memory_load - A number between 0 and 100 that specifies the approximate percentage of physical memory
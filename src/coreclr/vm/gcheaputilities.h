@@ -30,6 +30,11 @@ extern "C" uint32_t* g_card_bundle_table;
 extern "C" uint8_t* g_ephemeral_low;
 extern "C" uint8_t* g_ephemeral_high;
 
+// Generation of each basic region, skewed so it's indexed by (address >> g_region_shr).
+// nullptr unless the GC maintains it for the region write barriers.
+extern "C" uint8_t* g_region_to_generation_table;
+extern "C" uint8_t g_region_shr;
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 // Table containing the dirty state. This table is translated to exclude the lowest address it represents, see
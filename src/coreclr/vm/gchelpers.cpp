@@ -338,6 +338,13 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    // Sample the allocation for the allocation profiler
+    if (ETW::AllocationSamplingLog::IsEnabled())
+    {
+        UINT32 allocationKind = (flags & GC_ALLOC_LARGE_OBJECT_HEAP) ? 1 : ((flags & GC_ALLOC_PINNED_OBJECT_HEAP) ? 2 : 0);
+        ETW::AllocationSamplingLog::OnAllocationSlowPath(orObject, allocationKind);
+    }
 #endif // FEATURE_EVENT_TRACE
 }
 
@@ -244,6 +244,20 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
     DWORD cbIMap = pOldMT->GetInterfaceMapSize();
     InterfaceInfo_t * pOldIMap = (InterfaceInfo_t *)pOldMT->GetInterfaceMap();
 
+    // If none of the interfaces are instantiated, the interface map does not depend on the instantiation and is
+    // never updated once the type is loaded (see LoadExactInterfaceMap), so we can use the one of the canonical
+    // method table rather than duplicating it. The same lifetime restrictions as for vtable chunks apply.
+    BOOL canShareInterfaceMap = (wNumInterfaces != 0) && !fHasDynamicInterfaceMap &&
+                                MethodTable::CanShareVtableChunksFrom(pOldMT, pLoaderModule);
+    for (WORD iItf = 0; canShareInterfaceMap && iItf < wNumInterfaces; iItf++)
+    {
+        if (pOldIMap[iItf].GetMethodTable()->HasInstantiation())
+            canShareInterfaceMap = FALSE;
+    }
+
+    if (canShareInterfaceMap)
+        cbIMap = 0;
+
     DWORD dwMultipurposeSlotsMask = 0;
     dwMultipurposeSlotsMask |= MethodTable::enum_flag_HasPerInstInfo;
     if (wNumInterfaces != 0)
@@ -425,8 +439,9 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
         *pSizeSlot = cbInstAndDictSlotSize;
     }
 
-    // Copy interface map across
-    InterfaceInfo_t * pInterfaceMap = (InterfaceInfo_t *)(pMemory + cbMT + cbOptional + (fHasDynamicInterfaceMap ? sizeof(DWORD_PTR) : 0));
+    // Copy interface map across, unless it is shared with the canonical method table
+    InterfaceInfo_t * pInterfaceMap = canShareInterfaceMap ? pOldIMap :
+        (InterfaceInfo_t *)(pMemory + cbMT + cbOptional + (fHasDynamicInterfaceMap ? sizeof(DWORD_PTR) : 0));
 
 #ifdef FEATURE_COMINTEROP
     // Extensible RCW's are prefixed with the count of dynamic interfaces.
@@ -436,7 +451,7 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
     }
 #endif // FEATURE_COMINTEROP
 
-    for (WORD iItf = 0; iItf < wNumInterfaces; iItf++)
+    for (WORD iItf = 0; !canShareInterfaceMap && iItf < wNumInterfaces; iItf++)
     {
         OVERRIDE_TYPE_LOAD_LEVEL_LIMIT(CLASS_LOAD_APPROXPARENTS);
         pInterfaceMap[iItf].SetMethodTable(pOldIMap[iItf].GetApproxMethodTable(pOldMT->GetLoaderModule()));
@@ -3492,6 +3492,9 @@ HCIMPL3(CORINFO_MethodPtr, JIT_VirtualFunctionPointer, Object * objectUNSAFE,
 }
 HCIMPLEND
 
+// Marks the call site cache of a VirtualFunctionPointerArgs as being filled in
+#define VIRTUAL_FUNCTION_POINTER_CACHE_CLAIMED ((MethodTable *)1)
+
 HCIMPL2(CORINFO_MethodPtr, JIT_VirtualFunctionPointer_Dynamic, Object * objectUNSAFE, VirtualFunctionPointerArgs * pArgs)
 {
     FCALL_CONTRACT;
@@ -3500,10 +3503,27 @@ HCIMPL2(CORINFO_MethodPtr, JIT_VirtualFunctionPointer_Dynamic, Object * objectUN
 
     if (objRef != NULL)
     {
-        JitGenericHandleCacheKey key(objRef->GetMethodTable(), pArgs->classHnd, pArgs->methodHnd);
+        MethodTable * pMT = objRef->GetMethodTable();
+
+        if (VolatileLoad(&pArgs->cacheMT) == pMT)
+            return pArgs->cacheAddr;
+
+        JitGenericHandleCacheKey key(pMT, pArgs->classHnd, pArgs->methodHnd);
         HashDatum res;
         if (g_pJitGenericHandleCache->GetValueSpeculative(&key,&res))
+        {
+            // Remember the first receiver type seen at this call site. Types that can be
+            // unloaded are not cached since the call site data may outlive them.
+            if ((VolatileLoad(&pArgs->cacheMT) == NULL) && !pMT->Collectible() &&
+                !((MethodDesc *)pArgs->methodHnd)->GetLoaderAllocator()->IsCollectible() &&
+                (InterlockedCompareExchangeT(&pArgs->cacheMT, VIRTUAL_FUNCTION_POINTER_CACHE_CLAIMED, nullptr) == NULL))
+            {
+                pArgs->cacheAddr = (CORINFO_MethodPtr)res;
+                VolatileStore(&pArgs->cacheMT, pMT);
+            }
+
             return (CORINFO_GENERIC_HANDLE)res;
+        }
     }
 
     // Tailcall to the slow helper
@@ -57,12 +57,64 @@ void JitHost::freeStringConfigValue(const WCHAR* value)
 //
 // - Keep up to some limit worth of memory, with loose affinization of memory blocks to threads.
 // - On finalizer thread, release the extra memory that was not used recently.
+// - Each thread also keeps the last small slab it freed, so that back-to-back compilations on the
+//   same thread can reuse it without taking the lock. This is at most one slab per thread. It counts
+//   towards the cache limit, and it is released on thread exit or by the finalizer thread once the
+//   thread has not used it for a flush period.
 //
 
+// Do not cache blocks larger than this in the per-thread cache
+#define JIT_THREAD_SLAB_CACHE_MAX 0x40000
+
+JitHost::ThreadSlabCache::~ThreadSlabCache()
+{
+    if (fRegistered)
+    {
+        CrstHolder lock(&s_theJitHost.m_jitSlabAllocatorCrst);
+
+        for (ThreadSlabCache** ppCache = &s_theJitHost.m_pThreadCaches; *ppCache != NULL; ppCache = &(*ppCache)->pNext)
+        {
+            if (*ppCache == this)
+            {
+                *ppCache = pNext;
+                break;
+            }
+        }
+    }
+
+    Slab* pThreadSlab = InterlockedExchangeT(&pSlab, (Slab*)NULL);
+    if (pThreadSlab != NULL)
+    {
+        InterlockedExchangeAdd64(&s_theJitHost.m_totalCached, -(LONGLONG)pThreadSlab->size);
+        delete [] (BYTE*)pThreadSlab;
+    }
+}
+
+thread_local JitHost::ThreadSlabCache JitHost::t_slabCache;
+
 void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
 {
     size = max(size, sizeof(Slab));
 
+    if (t_slabCache.pSlab != NULL)
+    {
+        // The finalizer thread may take the slab away concurrently
+        Slab* pThreadSlab = InterlockedExchangeT(&t_slabCache.pSlab, (Slab*)NULL);
+        if (pThreadSlab != NULL)
+        {
+            if (pThreadSlab->size >= size && pThreadSlab->size <= 4 * size)
+            {
+                t_slabCache.fUsed = true;
+                InterlockedExchangeAdd64(&m_totalCached, -(LONGLONG)pThreadSlab->size);
+                *pActualSize = pThreadSlab->size;
+                return pThreadSlab;
+            }
+
+            // Only the finalizer thread clears the slot behind our back, so it is still empty
+            t_slabCache.pSlab = pThreadSlab;
+        }
+    }
+
     Thread* pCurrentThread = GetThreadNULLOk();
     if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
     {
@@ -99,7 +151,7 @@ void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
             Slab* p = *ppCandidate;
             *ppCandidate = p->pNext;
 
-            m_totalCached -= p->size;
+            InterlockedExchangeAdd64(&m_totalCached, -(LONGLONG)p->size);
             *pActualSize = p->size;
 
             return p;
@@ -114,13 +166,36 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
 {
     _ASSERTE(actualSize >= sizeof(Slab));
 
+    if (t_slabCache.pSlab == NULL && actualSize <= JIT_THREAD_SLAB_CACHE_MAX &&
+        (ULONGLONG)m_totalCached < g_pConfig->JitHostMaxSlabCache())
+    {
+        if (!t_slabCache.fRegistered)
+        {
+            // Let reclaim find this thread's slab
+            CrstHolder lock(&m_jitSlabAllocatorCrst);
+            t_slabCache.pNext = m_pThreadCaches;
+            m_pThreadCaches = &t_slabCache;
+            t_slabCache.fRegistered = true;
+        }
+
+        Slab* pSlab = (Slab*)slab;
+        pSlab->size = actualSize;
+        pSlab->affinity = GetThreadNULLOk();
+        pSlab->pNext = NULL;
+
+        InterlockedExchangeAdd64(&m_totalCached, (LONGLONG)actualSize);
+        t_slabCache.fUsed = true;
+        InterlockedExchangeT(&t_slabCache.pSlab, pSlab);
+        return;
+    }
+
     if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
     {
         CrstHolder lock(&m_jitSlabAllocatorCrst);
 
-        if (m_totalCached < g_pConfig->JitHostMaxSlabCache()) // Do not cache more than maximum allowed value
+        if ((ULONGLONG)m_totalCached < g_pConfig->JitHostMaxSlabCache()) // Do not cache more than maximum allowed value
         {
-            m_totalCached += actualSize;
+            InterlockedExchangeAdd64(&m_totalCached, (LONGLONG)actualSize);
 
             Slab* pSlab = (Slab*)slab;
             pSlab->size = actualSize;
@@ -141,7 +216,7 @@ void JitHost::init()
 
 void JitHost::reclaim()
 {
-    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
+    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL || m_pThreadCaches != NULL)
     {
         DWORD ticks = ::GetTickCount();
 
@@ -155,6 +230,36 @@ void JitHost::reclaim()
             return;
         m_lastFlush = ticks;
 
+        // Take the slabs of threads that did not use them since the last flush
+        Slab* pIdleThreadSlabs = NULL;
+        {
+            CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+            for (ThreadSlabCache* pCache = m_pThreadCaches; pCache != NULL; pCache = pCache->pNext)
+            {
+                if (pCache->fUsed)
+                {
+                    pCache->fUsed = false;
+                    continue;
+                }
+
+                Slab* pThreadSlab = InterlockedExchangeT(&pCache->pSlab, (Slab*)NULL);
+                if (pThreadSlab != NULL)
+                {
+                    InterlockedExchangeAdd64(&m_totalCached, -(LONGLONG)pThreadSlab->size);
+                    pThreadSlab->pNext = pIdleThreadSlabs;
+                    pIdleThreadSlabs = pThreadSlab;
+                }
+            }
+        }
+
+        while (pIdleThreadSlabs != NULL)
+        {
+            Slab* slabToDelete = pIdleThreadSlabs;
+            pIdleThreadSlabs = slabToDelete->pNext;
+            delete [] (BYTE*)slabToDelete;
+        }
+
         // Flush all slabs in m_pPreviousCachedList
         for (;;)
         {
@@ -169,7 +274,7 @@ void JitHost::reclaim()
                     m_pCurrentCachedList = NULL;
                     break;
                 }
-                m_totalCached -= slabToDelete->size;
+                InterlockedExchangeAdd64(&m_totalCached, -(LONGLONG)slabToDelete->size);
                 m_pPreviousCachedList = slabToDelete->pNext;
             }
 
@@ -17,10 +17,24 @@ private:
         Thread* affinity;
     };
 
+    // The last slab freed by a thread, which reclaim can take away from idle threads
+    struct ThreadSlabCache
+    {
+        Slab* volatile pSlab;       // Only set by the owning thread, cleared with interlocked operations
+        bool fUsed;                 // Reused or refilled since the last flush
+        bool fRegistered;
+        ThreadSlabCache* pNext;     // Protected by m_jitSlabAllocatorCrst
+
+        ~ThreadSlabCache();
+    };
+
+    static thread_local ThreadSlabCache t_slabCache;
+
     CrstStatic m_jitSlabAllocatorCrst;
     Slab* m_pCurrentCachedList;
     Slab* m_pPreviousCachedList;
-    size_t m_totalCached;
+    ThreadSlabCache* m_pThreadCaches;
+    LONGLONG volatile m_totalCached;    // Includes the per-thread slabs, updated with interlocked operations
     DWORD m_lastFlush;
 
     JitHost() {}
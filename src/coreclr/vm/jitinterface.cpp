@@ -1302,7 +1302,12 @@ CorInfoHelpFunc CEEInfo::getSharedStaticsHelper(FieldDesc * pField, MethodTable
         helper += delta;
     }
     else
-    if (!pFieldMT->HasClassConstructor() && !pFieldMT->HasBoxedRegularStatics())
+    if ((!pFieldMT->HasClassConstructor() && !pFieldMT->HasBoxedRegularStatics()) ||
+        // The class has been initialized already (e.g. the method is being rejitted at a higher tier),
+        // so there is nothing left for the helper to trigger. The NOCTOR helper is side-effect free,
+        // which lets the JIT CSE, hoist or remove the static base lookup. Thread statics still have
+        // to be allocated lazily on each thread.
+        (pFieldMT->IsClassInited() && !pField->IsThreadStatic()))
     {
         const int delta = CORINFO_HELP_GETSHARED_GCSTATIC_BASE_NOCTOR - CORINFO_HELP_GETSHARED_GCSTATIC_BASE;
 
@@ -4152,7 +4157,7 @@ TypeCompareState CEEInfo::compareTypesForCast(
     // Casting from a shared type to an unshared type.
     else if (fromHnd.IsCanonicalSubtype() && !toHnd.IsCanonicalSubtype())
     {
-        // Only handle casts to interface types for now
+        // Casts to interface types
         if (toHnd.IsInterface())
         {
             // Do a preliminary check.
@@ -4191,6 +4196,34 @@ TypeCompareState CEEInfo::compareTypesForCast(
                 result = TypeCompareState::MustNot;
             }
         }
+        // Casts between value types and classes only depend on whether the
+        // shared type is a value type, which sharing preserves. __Canon and
+        // shared interfaces may stand for interfaces implemented by a value type.
+        //
+        //    List<__Canon>             -> int                  MustNot
+        //    KeyValuePair<__Canon,int> -> Guid                 MustNot
+        //    KeyValuePair<__Canon,int> -> string               MustNot
+        //    KeyValuePair<__Canon,int> -> KeyValuePair<...>    May
+        //    __Canon                   -> int                  May
+        //
+        else if (!fromHnd.IsTypeDesc() && !toHnd.IsTypeDesc() && (fromHnd != TypeHandle(g_pCanonMethodTableClass)))
+        {
+            MethodTable* pFromMT = fromHnd.AsMethodTable();
+            MethodTable* pToMT   = toHnd.AsMethodTable();
+
+            if (pToMT->IsValueType())
+            {
+                if (pFromMT->IsValueType() ? !pFromMT->HasSameTypeDefAs(pToMT) : !pFromMT->IsInterface())
+                {
+                    result = TypeCompareState::MustNot;
+                }
+            }
+            else if (pFromMT->IsValueType() && (pToMT != g_pObjectClass) && (pToMT != g_pValueTypeClass) &&
+                     (pToMT != g_pEnumClass))
+            {
+                result = TypeCompareState::MustNot;
+            }
+        }
     }
 
     EE_TO_JIT_TRANSITION();
@@ -12601,13 +12634,16 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
     // * Tiered PGO is enabled and we're jitting at Tier0.
     // * Tiered PGO is enabled and we are jitting an OSR method.
     //
+    // unless Tiered PGO already has the data of a previous run for the method.
+    //
     if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0)
         && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
     }
     else if ((g_pConfig->TieredPGO())
-        && (flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) || flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_OSR)))
+        && (flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) || flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_OSR))
+        && !PgoManager::HasTextFormatPgoData(ftn))
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
     }
@@ -784,6 +784,20 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleInfoRecord(unsigned moduleTo, uns
 
                 if (pDomainAssembly)
                 {
+#ifdef TARGET_UNIX
+                    // The application has not loaded the assembly yet, so have the OS read in its
+                    // image in the background rather than fault the pages in one at a time on first use.
+                    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPrefetchImages) != 0)
+                    {
+                        PEAssembly * pPEAssembly = pDomainAssembly->GetPEAssembly();
+                        if (pPEAssembly->HasLoadedPEImage())
+                        {
+                            PEImageLayout * pLayout = pPEAssembly->GetLoadedLayout();
+                            PAL_PrefetchVirtualMemory((LPVOID)pLayout->GetBase(), pLayout->IsMapped() ? pLayout->GetVirtualSize() : pLayout->GetSize());
+                        }
+                    }
+#endif // TARGET_UNIX
+
                     // If we successfully loaded the assembly, enumerate the modules in the assembly
                     // and update all modules status.
                     moduleEnumerator.HandleAssembly(pDomainAssembly);
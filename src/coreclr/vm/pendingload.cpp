@@ -70,7 +70,7 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::AllocNewEntry()
     CONTRACTL_END
 
 #ifdef _DEBUG
-    m_dwDebugMemory += (DWORD) (sizeof(PendingTypeLoadTable::TableEntry));
+    InterlockedExchangeAdd((LONG*)&m_dwDebugMemory, (LONG)sizeof(PendingTypeLoadTable::TableEntry));
 #endif
 
     return (PendingTypeLoadTable::TableEntry *) new (nothrow) BYTE[sizeof(PendingTypeLoadTable::TableEntry)];
@@ -91,7 +91,7 @@ void PendingTypeLoadTable::FreeEntry(PendingTypeLoadTable::TableEntry * pEntry)
     delete[] ((BYTE*)pEntry);
 
 #ifdef _DEBUG
-    m_dwDebugMemory -= (DWORD) (sizeof(PendingTypeLoadTable::TableEntry));
+    InterlockedExchangeAdd((LONG*)&m_dwDebugMemory, -(LONG)sizeof(PendingTypeLoadTable::TableEntry));
 #endif
 }
 
@@ -199,7 +199,8 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::FindItem(TypeKey *pKey)
 
 
 #ifdef _DEBUG
-void PendingTypeLoadTable::Dump()
+// Dump the buckets protected by lock dwLock out of dwNumLocks, the caller must hold that lock
+void PendingTypeLoadTable::Dump(DWORD dwLock, DWORD dwNumLocks)
 {
     CONTRACTL
     {
@@ -209,8 +210,11 @@ void PendingTypeLoadTable::Dump()
     }
     CONTRACTL_END
 
-    LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: table contains:\n"));
-    for (DWORD i = 0; i < m_dwNumBuckets; i++)
+    if (dwLock == 0)
+    {
+        LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: table contains:\n"));
+    }
+    for (DWORD i = dwLock; i < m_dwNumBuckets; i += dwNumLocks)
     {
         for (TableEntry *pSearch = m_pBuckets[i]; pSearch; pSearch = pSearch->pNext)
         {
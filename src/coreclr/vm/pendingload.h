@@ -215,7 +215,8 @@ public:
     BOOL                m_fLockAcquired;
 };
 
-// Hash table used to hold pending type loads
+// Hash table used to hold pending type loads. Accesses to a bucket must hold the ClassLoader lock protecting
+// that bucket (see ClassLoader::GetUnresolvedClassLock)
 // @todo : use shash.h when it supports LoaderHeap/Alloc\MemTracker
 class PendingTypeLoadTable
 {
@@ -253,7 +254,7 @@ public:
     TableEntry* AllocNewEntry();
     void FreeEntry(TableEntry* pEntry);
 #ifdef _DEBUG
-    void            Dump();
+    void            Dump(DWORD dwLock, DWORD dwNumLocks);
 #endif
 
 private:
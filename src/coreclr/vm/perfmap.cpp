@@ -21,20 +21,31 @@
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
+bool PerfMap::s_GenerateJitDump = false;
 
 // Initialize the map for the process - called from EEStartupHelper.
 void PerfMap::Initialize()
 {
     LIMITED_METHOD_CONTRACT;
 
+    const DWORD perfMapType = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapEnabled);
+
     // Only enable the map if requested.
-    if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapEnabled))
+    if (perfMapType != (DWORD)PerfMapType::DISABLED)
     {
-        // Get the current process id.
-        int currentPid = GetCurrentProcessId();
+        if (perfMapType == (DWORD)PerfMapType::JITDUMP)
+        {
+            // Only the jitdump file is written, create a map without a file.
+            s_Current = new PerfMap();
+        }
+        else
+        {
+            // Get the current process id.
+            int currentPid = GetCurrentProcessId();
 
-        // Create the map.
-        s_Current = new PerfMap(currentPid);
+            // Create the map.
+            s_Current = new PerfMap(currentPid);
+        }
 
         int signalNum = (int) CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapIgnoreSignal);
 
@@ -50,21 +61,25 @@ void PerfMap::Initialize()
 
         s_enabled = true;
 
-        const char* jitdumpPath;
-        char jitdumpPathBuffer[4096];
-
-        CLRConfigNoCache value = CLRConfigNoCache::Get("PerfMapJitDumpPath");
-        if (value.IsSet())
+        if (perfMapType != (DWORD)PerfMapType::PERFMAP)
         {
-            jitdumpPath = value.AsString();
-        }
-        else
-        {
-            GetTempPathA(sizeof(jitdumpPathBuffer) - 1, jitdumpPathBuffer);
-            jitdumpPath = jitdumpPathBuffer;
-        }
+            const char* jitdumpPath;
+            char jitdumpPathBuffer[4096];
+
+            CLRConfigNoCache value = CLRConfigNoCache::Get("PerfMapJitDumpPath");
+            if (value.IsSet())
+            {
+                jitdumpPath = value.AsString();
+            }
+            else
+            {
+                GetTempPathA(sizeof(jitdumpPathBuffer) - 1, jitdumpPathBuffer);
+                jitdumpPath = jitdumpPathBuffer;
+            }
 
-        PAL_PerfJitDump_Start(jitdumpPath);
+            s_GenerateJitDump = true;
+            PAL_PerfJitDump_Start(jitdumpPath);
+        }
     }
 }
 
@@ -188,9 +203,10 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         PRECONDITION(codeSize > 0);
     } CONTRACTL_END;
 
-    if (m_FileStream == nullptr || m_ErrorEncountered)
+    const bool writeMapLine = (m_FileStream != nullptr) && !m_ErrorEncountered;
+    if (!writeMapLine && !s_GenerateJitDump)
     {
-        // A failure occurred, do not log.
+        // A failure occurred or there is nothing to write, do not log.
         return;
     }
 
@@ -201,16 +217,21 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         SString name;
         pMethod->GetFullMethodInfo(name);
 
-        // Build the map file line.
         if (optimizationTier != nullptr && s_ShowOptimizationTiers)
         {
             name.AppendPrintf("[%s]", optimizationTier);
         }
-        SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
-        // Write the line.
-        WriteLine(line);
+        if (writeMapLine)
+        {
+            // Build the map file line.
+            SString line;
+            line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
+
+            // Write the line.
+            WriteLine(line);
+        }
+
         PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
@@ -326,7 +347,8 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
 {
     LIMITED_METHOD_CONTRACT;
 
-    if (!s_enabled || s_Current->m_FileStream == nullptr)
+    const bool writeMapLine = s_enabled && (s_Current->m_FileStream != nullptr) && !s_Current->m_ErrorEncountered;
+    if (!writeMapLine && !(s_enabled && s_GenerateJitDump))
     {
         return;
     }
@@ -346,11 +368,17 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         SString name;
         // Build the map file line.
         name.Printf("stub<%d> %s<%s>", ++(s_Current->m_StubsMapped), stubType, stubOwner);
-        SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
-        // Write the line.
-        s_Current->WriteLine(line);
+        if (writeMapLine)
+        {
+            // Build the map file line.
+            SString line;
+            line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
+
+            // Write the line.
+            s_Current->WriteLine(line);
+        }
+
         PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
@@ -16,6 +16,15 @@ class PerfInfo;
 class PerfMap
 {
 private:
+    // The values of DOTNET_PerfMapEnabled
+    enum class PerfMapType
+    {
+        DISABLED = 0,
+        ALL      = 1,
+        JITDUMP  = 2,
+        PERFMAP  = 3
+    };
+
     static Volatile<bool> s_enabled;
 
     // The one and only PerfMap for the process.
@@ -24,6 +33,9 @@ private:
     // Indicates whether optimization tiers should be shown for methods in perf maps
     static bool s_ShowOptimizationTiers;
 
+    // Indicates whether methods and stubs are also written to the jitdump file
+    static bool s_GenerateJitDump;
+
     // The file stream to write the map to.
     CFileStream * m_FileStream;
 
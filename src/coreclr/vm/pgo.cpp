@@ -160,6 +160,99 @@ void CallFClose(FILE* file)
 
 typedef Holder<FILE*, DoNothing, CallFClose> FILEHolder;
 
+void PgoManager::WriteInstrumentationData(FILE* pgoDataFile, uint8_t* data, const ICorJitInfo::PgoInstrumentationSchema &schema)
+{
+    fprintf(pgoDataFile, s_RecordString, schema.InstrumentationKind, schema.ILOffset, schema.Count, schema.Other);
+    for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+    {
+        size_t entryOffset = schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind);
+
+        switch(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
+        {
+            case ICorJitInfo::PgoInstrumentationKind::None:
+                fprintf(pgoDataFile, s_None);
+                break;
+            case ICorJitInfo::PgoInstrumentationKind::FourByte:
+                fprintf(pgoDataFile, s_FourByte, (unsigned)*(uint32_t*)(data + entryOffset));
+                break;
+            case ICorJitInfo::PgoInstrumentationKind::EightByte:
+                // Print a pair of 4 byte values as the PRIu64 specifier isn't generally avaialble
+                fprintf(pgoDataFile, s_EightByte, (unsigned)*(uint32_t*)(data + entryOffset), (unsigned)*(uint32_t*)(data + entryOffset + 4));
+                break;
+            case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
+                {
+                    intptr_t typehandleData = *(intptr_t*)(data + entryOffset);
+                    TypeHandle th = TypeHandle::FromPtr((void*)typehandleData);
+                    if (th.IsNull())
+                    {
+                        fprintf(pgoDataFile, s_TypeHandle, "NULL");
+                    }
+                    else if (ICorJitInfo::IsUnknownHandle(typehandleData))
+                    {
+                        fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
+                    }
+                    else if ((typehandleData & 1) == 1)
+                    {
+                        // Type name read from a previous run that was never resolved, see ReadPgoData
+                        fprintf(pgoDataFile, s_TypeHandle, (char*)(typehandleData - 1));
+                    }
+                    else
+                    {
+                        StackSString ss;
+                        TypeString::AppendType(ss, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+                        if (ss.GetCount() > 8192)
+                        {
+                            fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
+                        }
+                        else
+                        {
+                            fprintf(pgoDataFile, s_TypeHandle, ss.GetUTF8());
+                        }
+                    }
+                    break;
+                }
+            case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
+                {
+                    intptr_t methodHandleData = *(intptr_t*)(data + entryOffset);
+                    MethodDesc* md = reinterpret_cast<MethodDesc*>(methodHandleData);
+                    if (md == nullptr)
+                    {
+                        fprintf(pgoDataFile, "MethodHandle: NULL\n");
+                    }
+                    else if (ICorJitInfo::IsUnknownHandle(methodHandleData))
+                    {
+                        fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
+                    }
+                    else if ((methodHandleData & 1) == 1)
+                    {
+                        // Method name read from a previous run that was never resolved, see ReadPgoData
+                        fprintf(pgoDataFile, "MethodHandle: %s\n", (char*)(methodHandleData - 1));
+                    }
+                    else
+                    {
+                        SString garbage1, tMethodName, garbage2;
+                        md->GetMethodInfo(garbage1, tMethodName, garbage2);
+                        StackSString tTypeName;
+                        TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+                        // Format is:
+                        // MethodName|@|fully_qualified_type_name
+                        if (tTypeName.GetCount() + 1 + tMethodName.GetCount() > 8192)
+                        {
+                            fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
+                        }
+                        else
+                        {
+                            fprintf(pgoDataFile, "MethodHandle: %s|@|%s\n", tMethodName.GetUTF8(), tTypeName.GetUTF8());
+                        }
+                    }
+                    break;
+                }
+            default:
+                break;
+        }
+    }
+}
+
 void PgoManager::WritePgoData()
 {
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, JitInstrumentationDataVerbose))
@@ -182,18 +275,41 @@ void PgoManager::WritePgoData()
         });
     }
 
-    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) == 0)
+    const bool persistPgoData = PersistPgoData();
+
+    if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) == 0) && !persistPgoData)
     {
         return;
     }
 
+    // Methods written from this run's data, whose previous data must not be
+    // written again.
+    PtrSHash<Header, CodeAndMethodHash> instrumentedPgoData;
+
     int pgoDataCount = 0;
-    EnumeratePGOHeaders([&pgoDataCount](HeaderList *pgoData)
+    EnumeratePGOHeaders([&pgoDataCount, &instrumentedPgoData, persistPgoData](HeaderList *pgoData)
     {
         pgoDataCount++;
+        if (persistPgoData && (instrumentedPgoData.Lookup(pgoData->header.GetKey()) == NULL))
+        {
+            instrumentedPgoData.Add(&pgoData->header);
+        }
         return true;
     });
 
+    // Methods that used the data of a previous run were not instrumented again,
+    // so carry their data over to the next run.
+    if (persistPgoData)
+    {
+        for (auto iter = s_textFormatPgoData.Begin(), end = s_textFormatPgoData.End(); iter != end; ++iter)
+        {
+            if (instrumentedPgoData.Lookup((*iter)->GetKey()) == NULL)
+            {
+                pgoDataCount++;
+            }
+        }
+    }
+
     if (pgoDataCount == 0)
     {
         return;
@@ -235,88 +351,9 @@ void PgoManager::WritePgoData()
 
         uint8_t* data = pgoData->header.GetData();
 
-        unsigned lastOffset  = 0;
         auto lambda = [data, pgoDataFile] (const ICorJitInfo::PgoInstrumentationSchema &schema)
         {
-            fprintf(pgoDataFile, s_RecordString, schema.InstrumentationKind, schema.ILOffset, schema.Count, schema.Other);
-            for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
-            {
-                size_t entryOffset = schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind);
-
-                switch(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
-                {
-                    case ICorJitInfo::PgoInstrumentationKind::None:
-                        fprintf(pgoDataFile, s_None);
-                        break;
-                    case ICorJitInfo::PgoInstrumentationKind::FourByte:
-                        fprintf(pgoDataFile, s_FourByte, (unsigned)*(uint32_t*)(data + entryOffset));
-                        break;
-                    case ICorJitInfo::PgoInstrumentationKind::EightByte:
-                        // Print a pair of 4 byte values as the PRIu64 specifier isn't generally avaialble
-                        fprintf(pgoDataFile, s_EightByte, (unsigned)*(uint32_t*)(data + entryOffset), (unsigned)*(uint32_t*)(data + entryOffset + 4));
-                        break;
-                    case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
-                        {
-                            intptr_t typehandleData = *(intptr_t*)(data + entryOffset);
-                            TypeHandle th = TypeHandle::FromPtr((void*)typehandleData);
-                            if (th.IsNull())
-                            {
-                                fprintf(pgoDataFile, s_TypeHandle, "NULL");
-                            }
-                            else if (ICorJitInfo::IsUnknownHandle(typehandleData))
-                            {
-                                fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
-                            }
-                            else
-                            {
-                                StackSString ss;
-                                TypeString::AppendType(ss, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
-                                if (ss.GetCount() > 8192)
-                                {
-                                    fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
-                                }
-                                else
-                                {
-                                    fprintf(pgoDataFile, s_TypeHandle, ss.GetUTF8());
-                                }
-                            }
-                            break;
-                        }
-                    case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
-                        {
-                            intptr_t methodHandleData = *(intptr_t*)(data + entryOffset);
-                            MethodDesc* md = reinterpret_cast<MethodDesc*>(methodHandleData);
-                            if (md == nullptr)
-                            {
-                                fprintf(pgoDataFile, "MethodHandle: NULL\n");
-                            }
-                            else if (ICorJitInfo::IsUnknownHandle(methodHandleData))
-                            {
-                                fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
-                            }
-                            else
-                            {
-                                SString garbage1, tMethodName, garbage2;
-                                md->GetMethodInfo(garbage1, tMethodName, garbage2);
-                                StackSString tTypeName;
-                                TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
-                                // Format is:
-                                // MethodName|@|fully_qualified_type_name
-                                if (tTypeName.GetCount() + 1 + tMethodName.GetCount() > 8192)
-                                {
-                                    fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
-                                }
-                                else
-                                {
-                                    fprintf(pgoDataFile, "MethodHandle: %s|@|%s\n", tMethodName.GetUTF8(), tTypeName.GetUTF8());
-                                }
-                            }
-                            break;
-                        }
-                    default:
-                        break;
-                }
-            }
+            WriteInstrumentationData(pgoDataFile, data, schema);
             return true;
         };
 
@@ -328,6 +365,37 @@ void PgoManager::WritePgoData()
         return true;
     });
 
+    if (persistPgoData)
+    {
+        for (auto iter = s_textFormatPgoData.Begin(), end = s_textFormatPgoData.End(); iter != end; ++iter)
+        {
+            Header *found = *iter;
+
+            if (instrumentedPgoData.Lookup(found->GetKey()) != NULL)
+            {
+                continue;
+            }
+
+            int32_t schemaItems;
+            if (!CountInstrumentationDataSize(found->GetData(), found->SchemaSizeMax(), &schemaItems))
+            {
+                _ASSERTE(!"Invalid instrumentation schema");
+                continue;
+            }
+
+            fprintf(pgoDataFile, s_MethodHeaderString, found->codehash, found->methodhash, found->ilSize, schemaItems);
+            fprintf(pgoDataFile, "MethodName: UNKNOWN\n");
+            fprintf(pgoDataFile, "Signature: UNKNOWN\n");
+
+            uint8_t* data = found->GetData();
+            ReadInstrumentationSchemaWithLayout(found->GetData(), found->SchemaSizeMax(), found->countsOffset, [data, pgoDataFile](const ICorJitInfo::PgoInstrumentationSchema &schema)
+            {
+                WriteInstrumentationData(pgoDataFile, data, schema);
+                return true;
+            });
+        }
+    }
+
     fprintf(pgoDataFile, s_FileTrailerString);
 }
 #endif // DACCESS_COMPILE
@@ -351,11 +419,13 @@ void ReadLineAndDiscard(FILE* file)
 #ifndef DACCESS_COMPILE
 void PgoManager::ReadPgoData()
 {
-    // Skip, if we're not reading, or we're writing profile data, or doing tiered pgo
+    // Skip, if we're not reading, or we're writing profile data, or doing tiered pgo,
+    // unless tiered pgo is persisting its data across runs.
     //
-    if (g_pConfig->TieredPGO() ||
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGOData) == 0))
+    if (!PersistPgoData() &&
+        (g_pConfig->TieredPGO() ||
+         (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
+         (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGOData) == 0)))
     {
         return;
     }
@@ -622,6 +692,31 @@ void PgoManager::ReadPgoData()
         probes += schemaCount;
     }
 }
+bool PgoManager::PersistPgoData()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return g_pConfig->TieredPGO() && (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_PersistPGOData) > 0);
+}
+
+bool PgoManager::HasTextFormatPgoData(MethodDesc* pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (s_textFormatPgoData.GetCount() == 0)
+    {
+        return false;
+    }
+
+    int codehash;
+    unsigned ilSize;
+    if (!GetVersionResilientILCodeHashCode(pMD, &codehash, &ilSize))
+    {
+        return false;
+    }
+
+    return s_textFormatPgoData.Lookup(CodeAndMethodHash(codehash, pMD->GetStableHash())) != NULL;
+}
 #endif // DACCESS_COMPILE
 
 void PgoManager::CreatePgoManager(PgoManager* volatile* ppMgr, bool loaderAllocator)
@@ -18,6 +18,13 @@ public:
     static void Initialize();
     static void Shutdown();
 
+    // True if TieredPGO reads the PGO data of the previous run at startup and
+    // writes its own data back at shutdown (see PersistPGOData)
+    static bool PersistPgoData();
+
+    // True if there is text format PGO data for the method
+    static bool HasTextFormatPgoData(MethodDesc* pMD);
+
 #endif // FEATURE_PGO
 
 public:
@@ -160,6 +167,7 @@ private:
 
     static void ReadPgoData();
     static void WritePgoData();
+    static void WriteInstrumentationData(FILE* pgoDataFile, uint8_t* data, const ICorJitInfo::PgoInstrumentationSchema &schema);
 
 private:
 
@@ -3170,6 +3170,8 @@ PCODE DynamicHelperFixup(TransitionBlock * pTransitionBlock, TADDR * pCell, DWOR
 
                         pArgs->classHnd = (CORINFO_CLASS_HANDLE)th.AsPtr();
                         pArgs->methodHnd = (CORINFO_METHOD_HANDLE)pMD;
+                        pArgs->cacheMT = NULL;
+                        pArgs->cacheAddr = NULL;
 
                         pHelper = DynamicHelpers::CreateHelperWithArg(pModule->GetLoaderAllocator(), (TADDR)pArgs,
                             GetEEFuncEntryPoint(JIT_VirtualFunctionPointer_Dynamic));
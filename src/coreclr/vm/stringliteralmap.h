@@ -42,10 +42,10 @@ public:
     }
 
     // Method to retrieve a string from the map.
-    STRINGREF *GetStringLiteral(EEStringData *pStringData, BOOL bAddIfNotFound, BOOL bAppDomainWontUnload);
+    STRINGREF *GetStringLiteral(EEStringData *pStringData, BOOL bAddIfNotFound);
 
     // Method to explicitly intern a string object.
-    STRINGREF *GetInternedString(STRINGREF *pString, BOOL bAddIfNotFound, BOOL bAppDomainWontUnload);
+    STRINGREF *GetInternedString(STRINGREF *pString, BOOL bAddIfNotFound);
 
 private:
     // Hash tables that maps a Unicode string to a COM+ string handle.
@@ -1608,15 +1608,17 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // From here on, spin for no more than the spin count that has been adapted to this lock
+            const DWORD awareLockSpinCount = awareLock->GetSpinCount();
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < awareLockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= awareLockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1625,6 +1627,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true /* acquiredLock */);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1636,8 +1639,16 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinResult(true /* acquiredLock */);
                 return AwareLock::EnterHelperResult_Entered;
             }
+
+            // Only a spin that ran to completion says something about this lock, stopping early to avoid preempting
+            // waiters does not
+            if (spinIteration >= awareLockSpinCount)
+            {
+                awareLock->RecordSpinResult(false /* acquiredLock */);
+            }
             break;
         }
 
@@ -2632,7 +2643,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = GetSpinCount();
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -452,8 +452,17 @@ private:
 
     DWORD m_waiterStarvationStartTimeMs;
 
+    // The maximum number of spin iterations for this lock, adapted by RecordSpinResult() between a fraction of
+    // g_SpinConstants.dwMonitorSpinCount and that value, depending on whether spinning tends to acquire this lock.
+    // Zero until the first adaptation, meaning that the current g_SpinConstants.dwMonitorSpinCount is used, since
+    // locks may be created before the spin constants are initialized.
+    DWORD m_spinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
+    // The per-lock spin count is adjusted in steps of, and does not go below, this fraction of the maximum spin count
+    static const DWORD SpinCountAdjustmentDivisor = 8;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_Recursion(0),
@@ -463,7 +472,8 @@ private:
 #endif // DACCESS_COMPILE
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(0)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -528,6 +538,10 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+public:
+    DWORD GetSpinCount() const;
+    void RecordSpinResult(bool acquiredLock);
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
     {
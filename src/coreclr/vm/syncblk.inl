@@ -457,6 +457,42 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The spin constants may have been initialized, or changed, after this lock was last adapted
+    DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    return (spinCount == 0) ? maxSpinCount : min(spinCount, maxSpinCount);
+}
+
+// Adapts the spin count of this lock to the result of a spin. A lock that is typically held only briefly is
+// acquired while spinning and keeps spinning for up to the configured maximum, whereas a lock that is typically
+// held for longer spins less before waiting, to avoid burning CPU time. Spinning is never disabled entirely so
+// that the spin count can recover when the usage pattern of the lock changes. Updates are not synchronized, a lost
+// update only delays the adaptation.
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    DWORD minSpinCount = max(maxSpinCount / SpinCountAdjustmentDivisor, (DWORD)1);
+    DWORD spinCount = GetSpinCount();
+
+    if (acquiredLock)
+    {
+        if (spinCount < maxSpinCount)
+        {
+            VolatileStoreWithoutBarrier(&m_spinCount, min(spinCount + minSpinCount, maxSpinCount));
+        }
+    }
+    else if (spinCount > minSpinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, max(spinCount - minSpinCount, minSpinCount));
+    }
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
@@ -1435,6 +1435,9 @@ Thread::Thread()
 
     m_alloc_context.init();
     m_thAllocContextObj = 0;
+    m_allocSamplingBytesLeft = 0;
+    m_allocSamplingLastAllocBytes = 0;
+    m_allocSamplingRandomState = 0;
 
     m_UserInterrupt = 0;
     m_WaitEventLink.m_Next = NULL;
@@ -1412,6 +1412,12 @@ public:
     // we fire the AllocationTick event. It's only for tooling purpose.
     TypeHandle m_thAllocContextObj;
 
+    // State of the Poisson process used to sample this thread's allocations when the
+    // AllocationSampling keyword is enabled (see code:ETW::AllocationSamplingLog)
+    INT64 m_allocSamplingBytesLeft;
+    INT64 m_allocSamplingLastAllocBytes;
+    UINT64 m_allocSamplingRandomState;
+
 #ifndef TARGET_UNIX
 private:
     _NT_TIB *m_pTEB;
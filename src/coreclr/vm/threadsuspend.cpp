@@ -3564,6 +3564,27 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         if (res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION)
         {
             STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Timed out waiting for rendezvous event %d threads remaining\n", countThreads);
+
+            // Name the threads that are holding up the suspension, so that threads stuck in long
+            // running code without GC polls can be found in the stress log.
+#ifdef STRESS_LOG
+            if (StressLog::LogOn(LF_SYNC, LL_INFO1000))
+            {
+                Thread* thread = NULL;
+                while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+                {
+                    if (thread == pCurThread)
+                        continue;
+
+                    if (thread->HasThreadStateOpportunistic(Thread::TS_GCSuspendPending) &&
+                        thread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
+                    {
+                        STRESS_LOG3(LF_SYNC, LL_INFO1000, "    Thread %p ID 0x%x OS ID 0x%x still in cooperative mode\n",
+                            thread, thread->GetThreadId(), (DWORD)thread->m_OSThreadId);
+                    }
+                }
+            }
+#endif // STRESS_LOG
 #ifdef _DEBUG
             DWORD dbgEndTimeout = GetTickCount();
 
@@ -41,6 +41,14 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// When TC_BackgroundWorkerCount is above 1 and the queue grows long, the
+// background worker also starts helper threads (BackgroundHelperStart()) that
+// jit methods from the same queue concurrently, one helper for each
+// MethodsToOptimizePerBackgroundHelper queued methods. Helpers only optimize
+// methods; the tiering delay, call counting completion and call counting stub
+// deletion stay with the background worker. A helper exits once the queue is
+// empty or the tiering delay is activated.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -59,6 +67,8 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREvent TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_backgroundHelperCount = 0;
+UINT32 TieredCompilationManager::s_maxBackgroundHelperCount = 0;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -456,6 +466,10 @@ void TieredCompilationManager::BackgroundWorkerStart()
     UINT64 minWorkDurationTicks = min(ticksPerS * processorCount / 1000, maxWorkDurationTicks); // <proc count> ms (capped)
     UINT64 workDurationTicks = minWorkDurationTicks;
 
+    // The background worker and its helpers together don't use more threads than there are processors
+    DWORD workerCount = min(g_pConfig->TieredCompilation_BackgroundWorkerCount(), (DWORD)processorCount);
+    s_maxBackgroundHelperCount = workerCount > 1 ? workerCount - 1 : 0;
+
     while (true)
     {
         _ASSERTE(s_isBackgroundWorkerRunning);
@@ -524,6 +538,132 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+void TieredCompilationManager::CreateBackgroundHelper()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+    _ASSERTE(s_backgroundHelperCount != 0);
+
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, BackgroundHelperBootstrapper0, newThread, W(".NET Tiered Compilation Helper")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        {
+            LockHolder tieredCompilationLockHolder;
+            --s_backgroundHelperCount;
+        }
+
+        // The background worker keeps processing the queue by itself
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::CreateBackgroundHelper: "
+            "Exception creating a background helper, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+DWORD WINAPI TieredCompilationManager::BackgroundHelperBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+        --s_backgroundHelperCount;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(BackgroundHelperBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::BackgroundHelperBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->BackgroundHelperStart();
+}
+
+// Optimizes methods from the queue alongside the background worker, until the queue is empty or the tiering delay is
+// activated.
+void TieredCompilationManager::BackgroundHelperStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            if (!IsTieringDelayActive())
+            {
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            }
+
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                _ASSERTE(s_backgroundHelperCount != 0);
+                --s_backgroundHelperCount;
+                return;
+            }
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize);
+
+        // Give preference to possibly more important work, as the background worker does
+        ClrSleepEx(0, false);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -690,6 +830,7 @@ bool TieredCompilationManager::DoBackgroundWork(
     do
     {
         bool completeCallCounting = false;
+        bool createBackgroundHelper = false;
         NativeCodeVersion nativeCodeVersionToOptimize;
         {
             LockHolder tieredCompilationLockHolder;
@@ -738,9 +879,22 @@ bool TieredCompilationManager::DoBackgroundWork(
                         break;
                     }
                 }
+                else if (
+                    s_backgroundHelperCount < s_maxBackgroundHelperCount &&
+                    m_countOfMethodsToOptimize >= (s_backgroundHelperCount + 1) * MethodsToOptimizePerBackgroundHelper)
+                {
+                    // The backlog is large enough to keep another thread busy
+                    ++s_backgroundHelperCount;
+                    createBackgroundHelper = true;
+                }
             }
         }
 
+        if (createBackgroundHelper)
+        {
+            CreateBackgroundHelper(); // requires GC_TRIGGERS
+        }
+
         _ASSERTE(completeCallCounting == !!nativeCodeVersionToOptimize.IsNull());
         if (completeCallCounting)
         {
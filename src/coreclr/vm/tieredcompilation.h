@@ -62,6 +62,12 @@ private:
     static void BackgroundWorkerBootstrapper1(LPVOID args);
     void BackgroundWorkerStart();
 
+private:
+    static void CreateBackgroundHelper();
+    static DWORD WINAPI BackgroundHelperBootstrapper0(LPVOID args);
+    static void BackgroundHelperBootstrapper1(LPVOID args);
+    void BackgroundHelperStart();
+
 private:
     bool IsTieringDelayActive();
     bool TryDeactivateTieringDelay();
@@ -119,6 +125,11 @@ private:
     static CLREvent s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+    static UINT32 s_backgroundHelperCount;
+    static UINT32 s_maxBackgroundHelperCount;
+
+    // A background helper is started for each this many methods queued for optimization
+    static const UINT32 MethodsToOptimizePerBackgroundHelper = 32;
 #endif // !DACCESS_COMPILE
 
 private:
@@ -28,6 +28,7 @@ UINT32 g_site_counter = 0;              //# of call sites
 UINT32 g_site_write = 0;                //# of call site backpatch writes
 UINT32 g_site_write_poly = 0;           //# of call site backpatch writes to point to resolve stubs
 UINT32 g_site_write_mono = 0;           //# of call site backpatch writes to point to dispatch stubs
+UINT32 g_site_write_chain = 0;          //# of call site backpatch writes to point to chained dispatch stubs
 
 UINT32 g_stub_lookup_counter = 0;       //# of lookup stubs
 UINT32 g_stub_mono_counter = 0;         //# of dispatch stubs
@@ -225,6 +226,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_mono", g_site_write_mono);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", g_site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", g_site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
@@ -1341,7 +1344,7 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
         DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(pMgr->GetDispatchChainFailTarget(dispatchStub));
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -1985,6 +1988,10 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
             {
                 BackPatchSite(pCallSite, (PCODE)stub);
             }
+            else if (stubKind == SK_DISPATCH && bCreateDispatchStub)
+            {
+                BackPatchSiteWithDispatchChain(pCallSite, target, objectType, token.To_SIZE_T());
+            }
         }
     }
     EX_CATCH
@@ -2478,7 +2485,7 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
         //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
+        PCODE failEntry    = GetDispatchChainFailTarget(dispatchStub);
         ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
@@ -2547,6 +2554,69 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     stats.site_write++;
 }
 
+//----------------------------------------------------------------------------
+/* A call site that points to dispatch stubs which all missed on objectType gets a new dispatch stub for
+objectType chained in front of them, as long as it has fewer than MAX_DISPATCH_CHAIN_LENGTH. This keeps
+call sites that see a few types on the dispatch stub fast path, rather than sending them all through the
+shared resolve cache. The new stub belongs to this call site only, so it is not added to the dispatchers
+table. Once the chain misses often enough, the call site is backpatched to the resolve stub as usual.
+*/
+void VirtualCallStubManager::BackPatchSiteWithDispatchChain(StubCallSite* pCallSite,
+                                                            PCODE         target,
+                                                            MethodTable*  objectType,
+                                                            size_t        token)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(target != NULL);
+    } CONTRACTL_END
+
+    PCODE prior = pCallSite->GetSiteTarget();
+
+    // The call site may have been backpatched to the resolve stub already
+    if (!isDispatchingStub(prior))
+        return;
+
+    UINT32 chainLength = 0;
+    for (PCODE stub = prior; isDispatchingStub(stub); stub = DispatchHolder::FromDispatchEntry(stub)->stub()->failTarget())
+    {
+        if (++chainLength >= MAX_DISPATCH_CHAIN_LENGTH)
+            return;
+    }
+
+    bool reenteredCooperativeGCMode = false;
+    DispatchHolder *pDispatchHolder = GenerateDispatchStub(target, prior, objectType, token, &reenteredCooperativeGCMode);
+    PCODE stub = pDispatchHolder->stub()->entryPoint();
+
+    // Only patch the call site if nobody else did in the meantime
+    if (InterlockedCompareExchangeT(pCallSite->GetIndirectCell(), stub, prior) == prior)
+    {
+        stats.site_write_chain++;
+        stats.site_write++;
+    }
+}
+
+//----------------------------------------------------------------------------
+PCODE VirtualCallStubManager::GetDispatchChainFailTarget(DispatchStub* dispatchStub)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    PCODE failTarget = dispatchStub->failTarget();
+    while (isDispatchingStub(failTarget))
+    {
+        failTarget = DispatchHolder::FromDispatchEntry(failTarget)->stub()->failTarget();
+    }
+    return failTarget;
+}
+
 //----------------------------------------------------------------------------
 void StubCallSite::SetSiteTarget(PCODE newTarget)
 {
@@ -2974,6 +3044,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_mono", stats.site_write_mono);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", stats.site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, ARRAY_SIZE(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", stats.site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
@@ -3018,6 +3090,7 @@ void VirtualCallStubManager::LogStats()
     g_site_write += stats.site_write;
     g_site_write_poly += stats.site_write_poly;
     g_site_write_mono += stats.site_write_mono;
+    g_site_write_chain += stats.site_write_chain;
     g_worker_call += stats.worker_call;
     g_worker_call_no_patch += stats.worker_call_no_patch;
     g_worker_collide_to_mono += stats.worker_collide_to_mono;
@@ -3033,6 +3106,7 @@ void VirtualCallStubManager::LogStats()
     stats.site_write = 0;
     stats.site_write_poly = 0;
     stats.site_write_mono = 0;
+    stats.site_write_chain = 0;
     stats.worker_call = 0;
     stats.worker_call_no_patch = 0;
     stats.worker_collide_to_mono = 0;
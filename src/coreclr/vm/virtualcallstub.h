@@ -186,6 +186,10 @@ typedef VPTR(class VirtualCallStubManager) PTR_VirtualCallStubManager;
 //         pretty fast, but certainly much slower than a normal call). If the method table is not found in
 //         the cache, it calls into the runtime code:VirtualCallStubManager.ResolveWorkerStatic, which
 //         populates it.
+// Before that happens, a call site whose dispatch stub misses on a type that has no entry in the resolve cache
+// yet gets a site specific dispatch stub for that type chained in front of its current dispatch stubs (up to
+// code:MAX_DISPATCH_CHAIN_LENGTH of them), so that call sites that only see a few types stay on the fast path.
+//
 // So the general progression is call site's cells
 //     * start out life pointing to a lookup stub
 //     * On first call they get updated into a dispatch stub. When this misses, it calls a resolve stub,
@@ -601,6 +605,12 @@ public:
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
+    //Chain a new dispatch stub for objectType in front of the dispatch stubs the callsite points to
+    void BackPatchSiteWithDispatchChain(StubCallSite* pCallSite, PCODE target, MethodTable* objectType, size_t token);
+
+    //Follow the failure targets of a chain of dispatch stubs to the fail entry of the resolve stub
+    PCODE GetDispatchChainFailTarget(DispatchStub* dispatchStub);
+
 public:
     /* the following two public functions are to support tracing or stepping thru
     stubs via the debugger. */
@@ -800,6 +810,7 @@ public:
         UINT32 site_write;              //# of call site backpatch writes
         UINT32 site_write_poly;         //# of call site backpatch writes to point to resolve stubs
         UINT32 site_write_mono;         //# of call site backpatch writes to point to dispatch stubs
+        UINT32 site_write_chain;        //# of call site backpatch writes to point to chained dispatch stubs
         UINT32 worker_call;             //# of calls into ResolveWorker
         UINT32 worker_call_no_patch;    //# of times call_worker resulted in no patch
         UINT32 worker_collide_to_mono;  //# of times we converted a poly stub to a mono stub instead of writing the cache entry
@@ -998,6 +1009,9 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define STUB_COLLIDE_MONO_PCT     0
 #endif // !STUB_LOGGING
 
+//maximum number of dispatch stubs a call site may chain before it goes through the resolve stub
+#define MAX_DISPATCH_CHAIN_LENGTH 3
+
 //size and mask of the cache used by resolve stubs
 // CALL_STUB_CACHE_SIZE must be equal to 2^CALL_STUB_CACHE_NUM_BITS
 #define CALL_STUB_CACHE_NUM_BITS 12 //10
@@ -756,6 +756,8 @@ mono_image_init (MonoImage *image)
 				       class_key_extract,
 				       class_next_value);
 	image->field_cache = mono_conc_hashtable_new (NULL, NULL);
+	image->method_cache = mono_conc_hashtable_new (NULL, NULL);
+	image->methodref_cache = mono_conc_hashtable_new (NULL, NULL);
 
 	image->typespec_cache = mono_conc_hashtable_new (NULL, NULL);
 	image->memberref_signatures = g_hash_table_new (NULL, NULL);
@@ -2181,10 +2183,8 @@ mono_image_close_except_pools (MonoImage *image)
 		g_free (image->version);
 	}
 
-	if (image->method_cache)
-		g_hash_table_destroy (image->method_cache);
-	if (image->methodref_cache)
-		g_hash_table_destroy (image->methodref_cache);
+	mono_conc_hashtable_destroy (image->method_cache);
+	mono_conc_hashtable_destroy (image->methodref_cache);
 	mono_internal_hash_table_destroy (&image->class_cache);
 	mono_conc_hashtable_destroy (image->field_cache);
 	if (image->array_cache) {
@@ -1162,61 +1162,62 @@ mono_get_method_full (MonoImage *image, guint32 token, MonoClass *klass,
 	return result;
 }
 
+/*
+ * Returns the cache that holds the method for TOKEN and sets KEY to its key in that
+ * cache, or returns NULL if methods with that token are not cached.
+ */
+static MonoConcurrentHashTable*
+get_method_cache_for_token (MonoImage *image, guint32 token, gpointer *key)
+{
+	if (mono_metadata_token_table (token) == MONO_TABLE_METHOD) {
+		/* Index 0 is not a valid method, and NULL keys can't be stored in the cache */
+		*key = GUINT_TO_POINTER (mono_metadata_token_index (token));
+		return *key ? image->method_cache : NULL;
+	}
+
+	if (image_is_dynamic (image))
+		return NULL;
+
+	*key = GUINT_TO_POINTER (token);
+	return image->methodref_cache;
+}
+
 MonoMethod *
 mono_get_method_checked (MonoImage *image, guint32 token, MonoClass *klass, MonoGenericContext *context, MonoError *error)
 {
 	MonoMethod *result = NULL;
+	MonoConcurrentHashTable *cache;
+	gpointer key = NULL;
 	gboolean used_context = FALSE;
 
 	/* FIXME: method definition lookups for metadata-update probably end up here */
 
-	/* We do everything inside the lock to prevent creation races */
-
 	error_init (error);
 
-	mono_image_lock (image);
-
-	if (mono_metadata_token_table (token) == MONO_TABLE_METHOD) {
-		if (!image->method_cache)
-			image->method_cache = g_hash_table_new (NULL, NULL);
-		result = (MonoMethod *)g_hash_table_lookup (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)));
-	} else if (!image_is_dynamic (image)) {
-		if (!image->methodref_cache)
-			image->methodref_cache = g_hash_table_new (NULL, NULL);
-		result = (MonoMethod *)g_hash_table_lookup (image->methodref_cache, GINT_TO_POINTER (token));
+	/* Lookups don't take the image lock, only insertions do */
+	cache = get_method_cache_for_token (image, token, &key);
+	if (cache) {
+		result = (MonoMethod *)mono_conc_hashtable_lookup (cache, key);
+		if (result)
+			return result;
 	}
-	mono_image_unlock (image);
-
-	if (result)
-		return result;
-
 
 	result = mono_get_method_from_token (image, token, klass, context, &used_context, error);
 	if (!result)
 		return NULL;
 
-	mono_image_lock (image);
-	if (!used_context && !result->is_inflated) {
-		MonoMethod *result2 = NULL;
+	if (cache && !used_context && !result->is_inflated) {
+		MonoMethod *result2;
 
-		if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
-			result2 = (MonoMethod *)g_hash_table_lookup (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)));
-		else if (!image_is_dynamic (image))
-			result2 = (MonoMethod *)g_hash_table_lookup (image->methodref_cache, GINT_TO_POINTER (token));
+		/* If another thread won the creation race, return its method */
+		mono_image_lock (image);
+		result2 = (MonoMethod *)mono_conc_hashtable_insert (cache, key, result);
+		mono_image_unlock (image);
 
-		if (result2) {
-			mono_image_unlock (image);
+		if (result2)
 			return result2;
-		}
-
-		if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
-			g_hash_table_insert (image->method_cache, GINT_TO_POINTER (mono_metadata_token_index (token)), result);
-		else if (!image_is_dynamic (image))
-			g_hash_table_insert (image->methodref_cache, GINT_TO_POINTER (token), result);
 	}
 
-	mono_image_unlock (image);
-
 	return result;
 }
 
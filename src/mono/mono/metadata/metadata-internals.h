@@ -403,11 +403,11 @@ struct _MonoImage {
 	/*
 	 * Indexed by method tokens and typedef tokens.
 	 */
-	GHashTable *method_cache; /*protected by the image lock*/
+	MonoConcurrentHashTable *method_cache; /* lock-free reads, insertions protected by the image lock */
 	MonoInternalHashTable class_cache;
 
 	/* Indexed by memberref + methodspec tokens */
-	GHashTable *methodref_cache; /*protected by the image lock*/
+	MonoConcurrentHashTable *methodref_cache; /* lock-free reads, insertions protected by the image lock */
 
 	/*
 	 * Indexed by fielddef and memberref tokens
@@ -921,6 +921,9 @@ static guint16 sri_vector_methods [] = {
 	SN_Narrow,
 	SN_Negate,
 	SN_OnesComplement,
+	SN_ShiftLeft,
+	SN_ShiftRightArithmetic,
+	SN_ShiftRightLogical,
 	SN_Sqrt,
 	SN_Subtract,
 	SN_Sum,
@@ -1352,6 +1355,36 @@ emit_sri_vector (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsi
 			return NULL;
 		return emit_simd_ins_for_unary_op (cfg, klass, fsig, args, arg0_type, id);
 	} 
+	case SN_ShiftLeft:
+	case SN_ShiftRightArithmetic:
+	case SN_ShiftRightLogical: {
+#ifdef TARGET_ARM64
+		if (!is_element_type_primitive (fsig->params [0]) || type_enum_is_float (arg0_type))
+			return NULL;
+
+		MonoClass *arg_class = mono_class_from_mono_type_internal (fsig->params [0]);
+		MonoType *etype = mono_class_get_context (arg_class)->class_inst->type_argv [0];
+		int esize = mono_class_value_size (mono_class_from_mono_type_internal (etype), NULL);
+		int op;
+
+		if (id == SN_ShiftLeft)
+			op = OP_ARM64_SHL;
+		else if (id == SN_ShiftRightArithmetic && !type_enum_is_unsigned (arg0_type))
+			op = OP_ARM64_SSHR;
+		else
+			op = OP_ARM64_USHR;
+
+		/* The shift count is taken modulo the element width, like for scalar shifts */
+		int count_reg = alloc_ireg (cfg);
+		MONO_EMIT_NEW_BIALU_IMM (cfg, OP_IAND_IMM, count_reg, args [1]->dreg, esize * 8 - 1);
+
+		MonoInst *ins = emit_simd_ins (cfg, klass, op, args [0]->dreg, count_reg);
+		ins->inst_c1 = arg0_type;
+		return ins;
+#else
+		return NULL;
+#endif
+	}
 	case SN_Sum: {
 #ifdef TARGET_ARM64
 		if (!is_element_type_primitive (fsig->params [0]))
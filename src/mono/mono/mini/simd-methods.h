@@ -205,6 +205,7 @@ METHOD(StoreScalar)
 METHOD(StoreAligned)
 METHOD(StoreAlignedNonTemporal)
 METHOD(StoreNonTemporal)
+METHOD(ShiftLeft)
 METHOD(ShiftLeftLogical)
 METHOD(ShiftLeftLogical128BitLane)
 METHOD(ShiftRightArithmetic)
@@ -70,6 +70,21 @@ static guint64 bytes_allocated_detached = 0;
 #define TLAB_TEMP_END	(__thread_info__->tlab_temp_end)
 #define TLAB_REAL_END	(__thread_info__->tlab_real_end)
 
+/*
+ * Returns the size of the TLAB to allocate on a refill. The first TLAB after a
+ * collection is sgen_tlab_size, every further refill doubles it, up to
+ * SGEN_MAX_TLAB_SIZE_FACTOR times sgen_tlab_size.
+ */
+static size_t
+next_tlab_size (SgenThreadInfo *info)
+{
+	if (info->tlab_size < sgen_tlab_size)
+		info->tlab_size = sgen_tlab_size;
+	else if (info->tlab_size < (size_t)sgen_tlab_size * SGEN_MAX_TLAB_SIZE_FACTOR)
+		info->tlab_size *= 2;
+	return info->tlab_size;
+}
+
 static void
 increment_thread_allocation_counter (size_t byte_size)
 {
@@ -269,16 +284,17 @@ sgen_alloc_obj_nolock (GCVTable vtable, size_t size)
 				zero_tlab_if_necessary (p, size);
 			} else {
 				size_t alloc_size = 0;
+				size_t tlab_size = next_tlab_size (__thread_info__);
 				if (TLAB_START)
 					SGEN_LOG (3, "Retire TLAB: %p-%p [%ld]", TLAB_START, TLAB_REAL_END, (long)(TLAB_REAL_END - TLAB_NEXT - size));
 				sgen_nursery_retire_region (p, available_in_tlab);
 
-				p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+				p = (void **)sgen_nursery_alloc_range (tlab_size, size, &alloc_size);
 				if (!p) {
 					/* See comment above in similar case. */
-					sgen_ensure_free_space (sgen_tlab_size, GENERATION_NURSERY);
+					sgen_ensure_free_space (tlab_size, GENERATION_NURSERY);
 					if (!sgen_degraded_mode)
-						p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+						p = (void **)sgen_nursery_alloc_range (tlab_size, size, &alloc_size);
 				}
 				if (!p)
 					return alloc_degraded (vtable, size, TRUE);
@@ -383,7 +399,7 @@ sgen_try_alloc_obj_nolock (GCVTable vtable, size_t size)
 			size_t alloc_size = 0;
 
 			sgen_nursery_retire_region (p, available_in_tlab);
-			new_next = (char *)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+			new_next = (char *)sgen_nursery_alloc_range (next_tlab_size (__thread_info__), size, &alloc_size);
 			p = (void**)new_next;
 			if (!p)
 				return NULL;
@@ -529,6 +545,7 @@ sgen_clear_tlabs (void)
 		info->tlab_next = NULL;
 		info->tlab_temp_end = NULL;
 		info->tlab_real_end = NULL;
+		info->tlab_size = 0;
 	} FOREACH_THREAD_END
 
 	sgen_set_bytes_allocated_attached (total_bytes_allocated_globally);
@@ -569,6 +569,18 @@ sgen_find_next_card (guint8 *card_data, guint8 *end)
 
 	cards = (mword*)card_data;
 	cards_end = (mword*)((mword)end & ~MWORD_MASK);
+
+	/*
+	 * Most cards are clean, so skip them four words at a time. The OR of the words
+	 * compiles to a few independent loads, which is about as fast as a vector
+	 * compare and doesn't need any architecture specific code.
+	 */
+	while (cards + 4 <= cards_end) {
+		if (cards [0] | cards [1] | cards [2] | cards [3])
+			break;
+		cards += 4;
+	}
+
 	while (cards < cards_end) {
 		card = *cards;
 		if (card)
@@ -179,6 +179,14 @@ typedef target_mword SgenDescriptor;
 */
 #define SGEN_MAX_NURSERY_WASTE 512
 
+/*
+ * A thread that refills its TLAB more than once between two nursery collections gets
+ * a TLAB twice as big on each refill, up to this many times sgen_tlab_size.  Heavily
+ * allocating threads then go to the nursery fragments much less often, while threads
+ * that rarely allocate keep small TLABs and don't waste nursery space.
+ */
+#define SGEN_MAX_TLAB_SIZE_FACTOR 16
+
 
 /*
  * Max nursery size that we support.
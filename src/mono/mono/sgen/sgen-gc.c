@@ -781,8 +781,8 @@ sgen_pin_object (GCObject *object, SgenGrayQueue *queue)
 /* Sort the addresses in array in increasing order.
  * Done using a by-the book heap sort. Which has decent and stable performance, is pretty cache efficient.
  */
-void
-sgen_sort_addresses (void **array, size_t size)
+static void
+heap_sort_addresses (void **array, size_t size)
 {
 	size_t i;
 	void *tmp;
@@ -829,6 +829,76 @@ sgen_sort_addresses (void **array, size_t size)
 	}
 }
 
+/*
+ * Sort the addresses in array in increasing order with a least significant digit radix
+ * sort, one byte per pass. Bytes that are the same in all the addresses are skipped,
+ * and since pinned addresses mostly come from the nursery and a few heap sections,
+ * only a handful of passes are needed. tmp must have room for size addresses.
+ */
+static void
+radix_sort_addresses (void **array, void **tmp, size_t size)
+{
+	void **src = array, **dst = tmp;
+	mword varying = 0;
+	size_t i;
+	int shift;
+
+	for (i = 1; i < size; ++i)
+		varying |= (mword)array [i] ^ (mword)array [0];
+
+	for (shift = 0; shift < (int)(sizeof (mword) * 8); shift += 8) {
+		size_t offsets [256];
+		size_t offset = 0;
+		void **swap;
+
+		if (!((varying >> shift) & 0xff))
+			continue;
+
+		memset (offsets, 0, sizeof (offsets));
+		for (i = 0; i < size; ++i)
+			++offsets [((mword)src [i] >> shift) & 0xff];
+
+		for (i = 0; i < 256; ++i) {
+			size_t count = offsets [i];
+			offsets [i] = offset;
+			offset += count;
+		}
+
+		for (i = 0; i < size; ++i)
+			dst [offsets [((mword)src [i] >> shift) & 0xff]++] = src [i];
+
+		swap = src;
+		src = dst;
+		dst = swap;
+	}
+
+	if (src != array)
+		memcpy (array, src, size * sizeof (void*));
+}
+
+/*
+ * Below this many addresses the heap sort is faster than setting up the radix sort.
+ */
+#define SGEN_RADIX_SORT_MIN_ADDRESSES 512
+
+/* Sort the addresses in array in increasing order. */
+void
+sgen_sort_addresses (void **array, size_t size)
+{
+	void **tmp;
+
+	if (size >= SGEN_RADIX_SORT_MIN_ADDRESSES) {
+		tmp = (void **)sgen_alloc_internal_dynamic (size * sizeof (void*), INTERNAL_MEM_TEMPORARY, FALSE);
+		if (tmp) {
+			radix_sort_addresses (array, tmp, size);
+			sgen_free_internal_dynamic (tmp, size * sizeof (void*), INTERNAL_MEM_TEMPORARY);
+			return;
+		}
+	}
+
+	heap_sort_addresses (array, size);
+}
+
 /*
  * Scan the memory between start and end and queue values which could be pointers
  * to the area between start_nursery and end_nursery for later consideration.
@@ -3090,6 +3160,7 @@ void*
 sgen_thread_attach (SgenThreadInfo* info)
 {
 	info->tlab_start = info->tlab_next = info->tlab_temp_end = info->tlab_real_end = NULL;
+	info->tlab_size = 0;
 
 	sgen_client_thread_attach (info);
 
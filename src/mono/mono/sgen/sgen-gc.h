@@ -430,6 +430,9 @@ struct _SgenThreadInfo {
 
 	/* Total bytes allocated by this thread in its lifetime so far. */
 	gint64 total_bytes_allocated;
+
+	/* Size of the next TLAB, or 0 if no TLAB was allocated since the last collection. */
+	size_t tlab_size;
 };
 
 gboolean sgen_is_worker_thread (MonoNativeThreadId thread);
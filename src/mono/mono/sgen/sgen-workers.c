@@ -244,7 +244,8 @@ workers_steal_work (WorkerData *data)
 	int generation = sgen_get_current_collection_generation ();
 	GrayQueueSection *section = NULL;
 	WorkerContext *context = data->context;
-	int i, current_worker;
+	int i, current_worker, best_worker;
+	gint32 best_sections;
 
 	if ((generation == GENERATION_OLD && !major->is_parallel) ||
 			(generation == GENERATION_NURSERY && !minor->is_parallel))
@@ -255,9 +256,29 @@ workers_steal_work (WorkerData *data)
 
 	current_worker = (int) (data - context->workers_data);
 
+	/*
+	 * Try the worker with the most sections first. Stealing from a worker that only
+	 * has a couple of sections left just moves the imbalance around, while the
+	 * worker with the longest queue is the one everybody else ends up waiting for.
+	 * The section counts are read racily, this is only a heuristic.
+	 */
+	best_worker = -1;
+	best_sections = 1;
+	for (i = 1; i < context->active_workers_num; i++) {
+		int steal_worker = (current_worker + i) % context->active_workers_num;
+		gint32 num_sections = context->workers_data [steal_worker].private_gray_queue.num_sections;
+		if (num_sections > best_sections && state_is_working_or_enqueued (context->workers_data [steal_worker].state)) {
+			best_worker = steal_worker;
+			best_sections = num_sections;
+		}
+	}
+
+	if (best_worker != -1)
+		section = sgen_gray_object_steal_section (&context->workers_data [best_worker].private_gray_queue);
+
 	for (i = 1; i < context->active_workers_num && !section; i++) {
 		int steal_worker = (current_worker + i) % context->active_workers_num;
-		if (state_is_working_or_enqueued (context->workers_data [steal_worker].state))
+		if (steal_worker != best_worker && state_is_working_or_enqueued (context->workers_data [steal_worker].state))
 			section = sgen_gray_object_steal_section (&context->workers_data [steal_worker].private_gray_queue);
 	}
 
@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <pal.h>
@@ -95,6 +96,11 @@ namespace
         return rc;
     }
 
+    double elapsed_ms(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+    {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    }
+
     int create_hostpolicy_context(
         hostpolicy_init_t &hostpolicy_init,
         const int argc,
@@ -417,16 +423,29 @@ SHARED_API int HOSTPOLICY_CALLTYPE corehost_main(const int argc, const pal::char
     if (rc != StatusCode::Success)
         return rc;
 
+    auto start_time = std::chrono::steady_clock::now();
+
     arguments_t args;
     assert(g_context == nullptr);
     rc = create_hostpolicy_context(g_init, argc, argv, true /* breadcrumbs_enabled */, &args);
     if (rc != StatusCode::Success)
         return rc;
 
+    auto context_time = std::chrono::steady_clock::now();
+
     rc = create_coreclr();
     if (rc != StatusCode::Success)
         return rc;
 
+    // Startup phases are reported in a single line so they can be tracked without verbose tracing
+    // (COREHOST_TRACE_VERBOSITY=3). The end timestamp is monotonic and can be correlated with other
+    // components' timings in the same process.
+    auto coreclr_time = std::chrono::steady_clock::now();
+    trace::info(_X("Startup timing: resolve dependencies %.3f ms, initialize runtime %.3f ms, done @ %lld us monotonic"),
+        elapsed_ms(start_time, context_time),
+        elapsed_ms(context_time, coreclr_time),
+        (long long)std::chrono::duration_cast<std::chrono::microseconds>(coreclr_time.time_since_epoch()).count());
+
     return run_app(args.app_argc, args.app_argv);
 }
 
@@ -904,6 +904,14 @@ CompareString
 int32_t GlobalizationNative_CompareString(
     SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
 {
+    // Identical code units compare equal under every collator and set of options, so there's no need to
+    // go through ICU (or create the collator for these options) when the strings are the same.
+    if (cwStr1Length == cwStr2Length && cwStr1Length >= 0 &&
+        (cwStr1Length == 0 || lpStr1 == lpStr2 || memcmp(lpStr1, lpStr2, (size_t)cwStr1Length * sizeof(UChar)) == 0))
+    {
+        return UCOL_EQUAL;
+    }
+
     UCollationResult result = UCOL_EQUAL;
     UErrorCode err = U_ZERO_ERROR;
     const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
@@ -17,6 +17,7 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliDecoderDecompressStream)
     DllImportEntry(BrotliDecoderDestroyInstance)
     DllImportEntry(BrotliDecoderIsFinished)
+    DllImportEntry(BrotliDecoderSetParameter)
     DllImportEntry(BrotliEncoderCompress)
     DllImportEntry(BrotliEncoderCompressStream)
     DllImportEntry(BrotliEncoderCreateInstance)
@@ -24,9 +25,11 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliEncoderHasMoreOutput)
     DllImportEntry(BrotliEncoderSetParameter)
     DllImportEntry(CompressionNative_Crc32)
+    DllImportEntry(CompressionNative_Crc32Combine)
     DllImportEntry(CompressionNative_Deflate)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateReset)
+    DllImportEntry(CompressionNative_DeflateSetDictionary)
     DllImportEntry(CompressionNative_DeflateInit2_)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
@@ -16,6 +16,8 @@
 #endif
 
 c_static_assert(PAL_Z_NOFLUSH == Z_NO_FLUSH);
+c_static_assert(PAL_Z_SYNCFLUSH == Z_SYNC_FLUSH);
+c_static_assert(PAL_Z_FULLFLUSH == Z_FULL_FLUSH);
 c_static_assert(PAL_Z_FINISH == Z_FINISH);
 
 c_static_assert(PAL_Z_OK == Z_OK);
@@ -137,6 +139,18 @@ int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush)
     return result;
 }
 
+int32_t CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL || dictionaryLength == 0);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateSetDictionary(zStream, dictionary, dictionaryLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_DeflateReset(PAL_ZStream* stream)
 {
     assert(stream != NULL);
@@ -215,3 +229,25 @@ uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
     assert(result <= UINT32_MAX);
     return (uint32_t)result;
 }
+
+uint32_t CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2)
+{
+    assert(len2 >= 0);
+
+    // z_off_t is a long, so 32 bits on Windows and 32-bit Unix, and crc32_combine64 is only
+    // declared when zlib is built with large file support. Combining with len2 zero bytes and
+    // then with crc2 gives the same result, so longer lengths are applied in pieces that fit.
+    unsigned long result = crc1;
+    if (sizeof(z_off_t) < sizeof(int64_t))
+    {
+        while (len2 > INT32_MAX)
+        {
+            result = crc32_combine(result, 0, (z_off_t)INT32_MAX);
+            len2 -= INT32_MAX;
+        }
+    }
+
+    result = crc32_combine(result, crc2, (z_off_t)len2);
+    assert(result <= UINT32_MAX);
+    return (uint32_t)result;
+}
@@ -36,6 +36,8 @@ Allowed flush values for the Deflate and Inflate functions.
 enum PAL_FlushCode
 {
     PAL_Z_NOFLUSH = 0,
+    PAL_Z_SYNCFLUSH = 2,
+    PAL_Z_FULLFLUSH = 3,
     PAL_Z_FINISH = 4,
 };
 
@@ -95,6 +97,16 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush);
 
+/*
+Primes the compression dictionary of the PAL_ZStream, e.g. with the last 32 KB of the previous block
+when the input is split into blocks that are compressed independently. Must be called after DeflateInit2_
+or DeflateReset and before the first call to Deflate.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateSetDictionary(
+    PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictionaryLength);
+
 /*
 This function is equivalent to DeflateEnd followed by DeflateInit, but does not free and reallocate
 the internal compression state. The stream will leave the compression level and any other attributes that may have been set unchanged.
@@ -147,3 +159,11 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+Combine the CRC-32 crc1 of a first block with the CRC-32 crc2 of a second block
+of len2 bytes, so blocks can be checksummed independently.
+
+Returns the CRC-32 of the two blocks concatenated.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2);
@@ -63,6 +63,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_GetReadDirRBufferSize)
     DllImportEntry(SystemNative_ReadDirR)
+    DllImportEntry(SystemNative_ReadDirEntries)
+    DllImportEntry(SystemNative_FStatAt)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -145,6 +147,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetIPv6Address)
     DllImportEntry(SystemNative_GetControlMessageBufferSize)
     DllImportEntry(SystemNative_TryGetIPPacketInformation)
+    DllImportEntry(SystemNative_TryGetUdpGroSegmentSize)
     DllImportEntry(SystemNative_GetIPv4MulticastOption)
     DllImportEntry(SystemNative_SetIPv4MulticastOption)
     DllImportEntry(SystemNative_GetIPv6MulticastOption)
@@ -155,8 +158,13 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetSendTimeout)
     DllImportEntry(SystemNative_Receive)
     DllImportEntry(SystemNative_ReceiveMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_SendMessages)
+    DllImportEntry(SystemNative_EnableZeroCopySend)
+    DllImportEntry(SystemNative_SendMessageZeroCopy)
+    DllImportEntry(SystemNative_GetZeroCopySendCompletions)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -178,12 +186,15 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_CreateSocketEventBuffer)
     DllImportEntry(SystemNative_FreeSocketEventBuffer)
     DllImportEntry(SystemNative_TryChangeSocketEventRegistration)
+    DllImportEntry(SystemNative_TryChangeSocketEventRegistrations)
     DllImportEntry(SystemNative_WaitForSocketEvents)
     DllImportEntry(SystemNative_PlatformSupportsDualModeIPv4PacketInfo)
     DllImportEntry(SystemNative_GetPeerUserName)
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_Splice)
+    DllImportEntry(SystemNative_Tee)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
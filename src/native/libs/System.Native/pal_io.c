@@ -97,10 +97,12 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 #define stat_ stat64
 #define fstat_ fstat64
 #define lstat_ lstat64
+#define fstatat_ fstatat64
 #else
 #define stat_ stat
 #define fstat_ fstat
 #define lstat_ lstat
+#define fstatat_ fstatat
 #endif
 
 // These numeric values are specified by POSIX.
@@ -436,29 +438,12 @@ int32_t SystemNative_GetReadDirRBufferSize(void)
 #endif
 }
 
-// To reduce the number of string copies, the caller of this function is responsible to ensure the memory
-// referenced by outputEntry remains valid until it is read.
-// If the platform supports readdir_r, the caller provides a buffer into which the data is read.
-// If the platform uses readdir, the caller must ensure no calls are made to readdir/closedir since those will invalidate
-// the current dirent. We assume the platform supports concurrent readdir calls to different DIRs.
-int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry)
+// Reads the next dirent from dir. With readdir_r the entry is read into storage, otherwise storage is unused and
+// the entry is owned by the directory stream until the next readdir/closedir call on it.
+// Returns 0 when an entry is read, -1 at end-of-stream, or an error code on failure.
+static int32_t ReadNextDirent(DIR* dir, struct dirent* storage, struct dirent** outputEntry)
 {
-    assert(dir != NULL);
-    assert(outputEntry != NULL);
-
 #if HAVE_READDIR_R
-    assert(buffer != NULL);
-
-    // align to dirent
-    struct dirent* entry = (struct dirent*)((size_t)(buffer + dirent_alignment - 1) & ~(dirent_alignment - 1));
-
-    // check there is dirent size available at entry
-    if ((buffer + bufferSize) < ((uint8_t*)entry + sizeof(struct dirent)))
-    {
-        assert(false && "Buffer size too small; use GetReadDirRBufferSize to get required buffer size");
-        return ERANGE;
-    }
-
     struct dirent* result = NULL;
 #ifdef _AIX
     // AIX returns 0 on success, but bizarrely, it returns 9 for both error and
@@ -469,48 +454,43 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
     // https://www.ibm.com/support/knowledgecenter/ssw_aix_71/com.ibm.aix.basetrf2/readdir_r.htm
 
     errno = 0; // create a success condition for the API to clobber
-    int error = readdir_r(dir, entry, &result);
+    int error = readdir_r(dir, storage, &result);
 
     if (error == 9)
     {
-        memset(outputEntry, 0, sizeof(*outputEntry)); // managed out param must be initialized
         return errno == 0 ? -1 : errno;
     }
 #else
     int error;
 
     // EINTR isn't documented, happens in practice on macOS.
-    while ((error = readdir_r(dir, entry, &result)) && errno == EINTR);
+    while ((error = readdir_r(dir, storage, &result)) && errno == EINTR);
 
     // positive error number returned -> failure
     if (error != 0)
     {
         assert(error > 0);
-        memset(outputEntry, 0, sizeof(*outputEntry)); // managed out param must be initialized
         return error;
     }
 
     // 0 returned with null result -> end-of-stream
     if (result == NULL)
     {
-        memset(outputEntry, 0, sizeof(*outputEntry)); // managed out param must be initialized
         return -1;         // shim convention for end-of-stream
     }
 #endif
 
-    // 0 returned with non-null result (guaranteed to be set to entry arg) -> success
-    assert(result == entry);
+    // 0 returned with non-null result (guaranteed to be set to storage arg) -> success
+    assert(result == storage);
+    *outputEntry = result;
 #else
-    (void)buffer;     // unused
-    (void)bufferSize; // unused
+    (void)storage; // unused
     errno = 0;
     struct dirent* entry = readdir(dir);
 
     // 0 returned with null result -> end-of-stream
     if (entry == NULL)
     {
-        memset(outputEntry, 0, sizeof(*outputEntry)); // managed out param must be initialized
-
         //  kernel set errno -> failure
         if (errno != 0)
         {
@@ -519,11 +499,148 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
         }
         return -1;
     }
+
+    *outputEntry = entry;
 #endif
+    return 0;
+}
+
+#if HAVE_READDIR_R
+// Returns the dirent aligned location in buffer, or NULL if buffer can't hold a dirent.
+static struct dirent* GetDirentStorage(uint8_t* buffer, int32_t bufferSize)
+{
+    assert(buffer != NULL);
+
+    // align to dirent
+    struct dirent* entry = (struct dirent*)((size_t)(buffer + dirent_alignment - 1) & ~(dirent_alignment - 1));
+
+    // check there is dirent size available at entry
+    if ((buffer + bufferSize) < ((uint8_t*)entry + sizeof(struct dirent)))
+    {
+        return NULL;
+    }
+
+    return entry;
+}
+#endif
+
+// To reduce the number of string copies, the caller of this function is responsible to ensure the memory
+// referenced by outputEntry remains valid until it is read.
+// If the platform supports readdir_r, the caller provides a buffer into which the data is read.
+// If the platform uses readdir, the caller must ensure no calls are made to readdir/closedir since those will invalidate
+// the current dirent. We assume the platform supports concurrent readdir calls to different DIRs.
+int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry)
+{
+    assert(dir != NULL);
+    assert(outputEntry != NULL);
+
+    struct dirent* storage = NULL;
+#if HAVE_READDIR_R
+    storage = GetDirentStorage(buffer, bufferSize);
+    if (storage == NULL)
+    {
+        assert(false && "Buffer size too small; use GetReadDirRBufferSize to get required buffer size");
+        return ERANGE;
+    }
+#else
+    (void)buffer;     // unused
+    (void)bufferSize; // unused
+#endif
+
+    struct dirent* entry = NULL;
+    int32_t result = ReadNextDirent(dir, storage, &entry);
+    if (result != 0)
+    {
+        memset(outputEntry, 0, sizeof(*outputEntry)); // managed out param must be initialized
+        return result;
+    }
+
     ConvertDirent(entry, outputEntry);
     return 0;
 }
 
+// Reads up to entryCount entries in one call, so enumerating a large directory doesn't cost a P/Invoke
+// transition per entry; readdir itself already fetches the entries from the kernel in large getdents batches.
+// The names are copied into buffer, after the dirent storage when the platform uses readdir_r. When the
+// next name doesn't fit, it is returned as the last entry pointing to the dirent instead, with the same
+// lifetime rules as SystemNative_ReadDirR.
+int32_t SystemNative_ReadDirEntries(
+    DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entryCount, int32_t* entriesRead)
+{
+    assert(dir != NULL);
+    assert(buffer != NULL || bufferSize == 0);
+    assert(entries != NULL);
+    assert(entryCount > 0);
+    assert(entriesRead != NULL);
+
+    *entriesRead = 0;
+
+    struct dirent* storage = NULL;
+    uint8_t* names = buffer;
+#if HAVE_READDIR_R
+    storage = GetDirentStorage(buffer, bufferSize);
+    if (storage == NULL)
+    {
+        return ERANGE;
+    }
+    names = (uint8_t*)storage + sizeof(struct dirent);
+#endif
+    uint8_t* namesEnd = buffer + bufferSize;
+
+    int32_t count = 0;
+    while (count < entryCount)
+    {
+        struct dirent* entry = NULL;
+        int32_t result = ReadNextDirent(dir, storage, &entry);
+        if (result != 0)
+        {
+            if (count == 0)
+            {
+                return result;
+            }
+
+            // Return what has been read, end-of-stream or the error is reported by the next call.
+            break;
+        }
+
+        DirectoryEntry* outputEntry = &entries[count++];
+        ConvertDirent(entry, outputEntry);
+
+        size_t nameLength = strlen(entry->d_name);
+        if ((size_t)(namesEnd - names) <= nameLength)
+        {
+            // The entry still points to the dirent, which stays valid until the next read.
+            break;
+        }
+
+        memcpy(names, entry->d_name, nameLength + 1);
+        outputEntry->Name = (const char*)names;
+        outputEntry->NameLength = (int32_t)nameLength;
+        names += nameLength + 1;
+    }
+
+    *entriesRead = count;
+    return 0;
+}
+
+int32_t SystemNative_FStatAt(DIR* dir, const char* name, int32_t followLinks, FileStatus* output)
+{
+    assert(dir != NULL);
+    assert(name != NULL);
+
+    struct stat_ result;
+    int flags = followLinks ? 0 : AT_SYMLINK_NOFOLLOW;
+    int ret;
+    while ((ret = fstatat_(dirfd(dir), name, &result, flags)) < 0 && errno == EINTR);
+
+    if (ret == 0)
+    {
+        ConvertFileStatus(&result, output);
+    }
+
+    return ret;
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
@@ -864,7 +981,7 @@ static int32_t ConvertMMapProtection(int32_t protection)
 
 static int32_t ConvertMMapFlags(int32_t flags)
 {
-    if (flags & ~(PAL_MAP_SHARED | PAL_MAP_PRIVATE | PAL_MAP_ANONYMOUS))
+    if (flags & ~(PAL_MAP_SHARED | PAL_MAP_PRIVATE | PAL_MAP_ANONYMOUS | PAL_MAP_POPULATE | PAL_MAP_HUGETLB))
     {
         assert_msg(false, "Unknown MMap flag", (int)flags);
         return -1;
@@ -877,6 +994,17 @@ static int32_t ConvertMMapFlags(int32_t flags)
         ret |= MAP_SHARED;
     if (flags & PAL_MAP_ANONYMOUS)
         ret |= MAP_ANON;
+#if defined(MAP_POPULATE)
+    if (flags & PAL_MAP_POPULATE)
+        ret |= MAP_POPULATE;
+#elif defined(MAP_PREFAULT_READ)
+    if (flags & PAL_MAP_POPULATE)
+        ret |= MAP_PREFAULT_READ;
+#endif
+#ifdef MAP_HUGETLB
+    if (flags & PAL_MAP_HUGETLB)
+        ret |= MAP_HUGETLB;
+#endif
 
     assert(ret != -1);
     return ret;
@@ -915,6 +1043,14 @@ void* SystemNative_MMap(void* address,
         return NULL;
     }
 
+#ifndef MAP_HUGETLB
+    if (flags & PAL_MAP_HUGETLB)
+    {
+        errno = ENOTSUP;
+        return NULL;
+    }
+#endif
+
     protection = ConvertMMapProtection(protection);
     flags = ConvertMMapFlags(flags);
 
@@ -972,14 +1108,45 @@ int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice)
 #ifdef MADV_DONTFORK
             return madvise(address, (size_t)length, MADV_DONTFORK);
 #else
-            (void)address, (void)length, (void)advice;
-            errno = ENOTSUP;
-            return -1;
+            break;
+#endif
+
+        case PAL_MADV_SEQUENTIAL:
+            return madvise(address, (size_t)length, MADV_SEQUENTIAL);
+
+        case PAL_MADV_WILLNEED:
+            return madvise(address, (size_t)length, MADV_WILLNEED);
+
+        case PAL_MADV_HUGEPAGE:
+#ifdef MADV_HUGEPAGE
+            return madvise(address, (size_t)length, MADV_HUGEPAGE);
+#else
+            break;
+#endif
+
+        case PAL_MADV_POPULATE_READ:
+#ifdef MADV_POPULATE_READ
+            return madvise(address, (size_t)length, MADV_POPULATE_READ);
+#else
+            break;
+#endif
+
+        case PAL_MADV_POPULATE_WRITE:
+#ifdef MADV_POPULATE_WRITE
+            return madvise(address, (size_t)length, MADV_POPULATE_WRITE);
+#else
+            break;
 #endif
+
+        default:
+            assert_msg(false, "Unknown MemoryAdvice", (int)advice);
+            errno = EINVAL;
+            return -1;
     }
 
-    assert_msg(false, "Unknown MemoryAdvice", (int)advice);
-    errno = EINVAL;
+    // The advice is known but not supported on this platform.
+    (void)address, (void)length;
+    errno = ENOTSUP;
     return -1;
 }
 
@@ -244,6 +244,8 @@ enum
     PAL_MAP_PRIVATE = 0x02, // private copy-on-write-mapping
 
     PAL_MAP_ANONYMOUS = 0x10, // mapping is not backed by any file
+    PAL_MAP_POPULATE = 0x20,  // prefault the mapping; ignored where not supported
+    PAL_MAP_HUGETLB = 0x40,   // back the mapping with huge pages
 };
 
 /**
@@ -263,7 +265,12 @@ enum
  */
 typedef enum
 {
-    PAL_MADV_DONTFORK = 1, // don't map pages in to forked process
+    PAL_MADV_DONTFORK = 1,       // don't map pages in to forked process
+    PAL_MADV_SEQUENTIAL = 2,     // expect sequential access, read ahead aggressively
+    PAL_MADV_WILLNEED = 3,       // expect access in the near future, start reading the pages in
+    PAL_MADV_HUGEPAGE = 4,       // back the range with transparent huge pages
+    PAL_MADV_POPULATE_READ = 5,  // prefault the range readable
+    PAL_MADV_POPULATE_WRITE = 6, // prefault the range writable
 } MemmoryAdvice;
 
 /**
@@ -394,6 +401,23 @@ PALEXPORT int32_t SystemNative_GetReadDirRBufferSize(void);
  */
 PALEXPORT int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry);
 
+/**
+ * Reads up to entryCount entries from the directory stream pointed to by dir, copying their names into buffer.
+ * With readdir_r the buffer must also have room for the dirent (see GetReadDirRBufferSize) ahead of the names.
+ *
+ * Returns 0 and sets entriesRead when entries are retrieved; returns -1 when end-of-stream is reached;
+ * returns an error code on failure
+ */
+PALEXPORT int32_t SystemNative_ReadDirEntries(
+    DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entryCount, int32_t* entriesRead);
+
+/**
+ * Gets file status of an entry of the directory stream pointed to by dir, without resolving the full path.
+ *
+ * Returns 0 for success, -1 for failure. Sets errno on failure.
+ */
+PALEXPORT int32_t SystemNative_FStatAt(DIR* dir, const char* name, int32_t followLinks, FileStatus* output);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -59,6 +59,28 @@ Error SystemNative_CreateNetworkChangeListenerSocket(intptr_t* retSocket)
     return Error_SUCCESS;
 }
 
+#if HAVE_LINUX_RTNETLINK_H || HAVE_RT_MSGHDR
+#define NETWORK_CHANGE_FLAG(kind) (1u << (kind))
+
+// A single read can return many messages, e.g. one per address when a batch of interfaces is created.
+// They are coalesced so that each kind of change is reported at most once per read.
+static void ReportNetworkChanges(intptr_t sock, NetworkChangeEvent onNetworkChange, uint32_t changes)
+{
+    if (changes & NETWORK_CHANGE_FLAG(AddressAdded))
+    {
+        onNetworkChange(sock, AddressAdded);
+    }
+    if (changes & NETWORK_CHANGE_FLAG(AddressRemoved))
+    {
+        onNetworkChange(sock, AddressRemoved);
+    }
+    if (changes & NETWORK_CHANGE_FLAG(AvailabilityChanged))
+    {
+        onNetworkChange(sock, AvailabilityChanged);
+    }
+}
+#endif
+
 #if HAVE_LINUX_RTNETLINK_H
 static NetworkChangeKind ReadNewLinkMessage(struct nlmsghdr* hdr)
 {
@@ -92,31 +114,41 @@ Error SystemNative_ReadEvents(intptr_t sock, NetworkChangeEvent onNetworkChange)
     }
 
     assert(len >= 0);
-    for (struct nlmsghdr* hdr = (struct nlmsghdr*)buffer; NLMSG_OK(hdr, (size_t)len); NLMSG_NEXT(hdr, len))
+    uint32_t changes = 0;
+    bool done = false;
+    for (struct nlmsghdr* hdr = (struct nlmsghdr*)buffer; !done && NLMSG_OK(hdr, (size_t)len); NLMSG_NEXT(hdr, len))
     {
         switch (hdr->nlmsg_type)
         {
             case NLMSG_DONE:
-                return Error_SUCCESS; // End of a multi-part message; stop reading.
+                done = true; // End of a multi-part message; stop reading.
+                break;
             case NLMSG_ERROR:
-                return Error_SUCCESS;
+                done = true;
+                break;
             case RTM_NEWADDR:
-                onNetworkChange(sock, AddressAdded);
+                changes |= NETWORK_CHANGE_FLAG(AddressAdded);
                 break;
             case RTM_DELADDR:
-                onNetworkChange(sock, AddressRemoved);
+                changes |= NETWORK_CHANGE_FLAG(AddressRemoved);
                 break;
             case RTM_NEWLINK:
-                onNetworkChange(sock, ReadNewLinkMessage(hdr));
+            {
+                NetworkChangeKind kind = ReadNewLinkMessage(hdr);
+                if (kind != None)
+                {
+                    changes |= NETWORK_CHANGE_FLAG(kind);
+                }
                 break;
+            }
             case RTM_NEWROUTE:
             case RTM_DELROUTE:
             {
                 struct rtmsg* dataAsRtMsg = (struct rtmsg*)NLMSG_DATA(hdr);
                 if (dataAsRtMsg->rtm_table == RT_TABLE_MAIN)
                 {
-                    onNetworkChange(sock, AvailabilityChanged);
-                    return Error_SUCCESS;
+                    changes |= NETWORK_CHANGE_FLAG(AvailabilityChanged);
+                    done = true;
                 }
                 break;
             }
@@ -124,6 +156,8 @@ Error SystemNative_ReadEvents(intptr_t sock, NetworkChangeEvent onNetworkChange)
                 break;
         }
     }
+
+    ReportNetworkChanges(sock, onNetworkChange, changes);
     return Error_SUCCESS;
 }
 #elif HAVE_RT_MSGHDR
@@ -142,32 +176,37 @@ Error SystemNative_ReadEvents(intptr_t sock, NetworkChangeEvent onNetworkChange)
     }
 
     struct rt_msghdr msghdr;
-    for (char *ptr = buffer; (ptr + sizeof(struct rt_msghdr)) <= (buffer + count); ptr += msghdr.rtm_msglen)
+    uint32_t changes = 0;
+    bool done = false;
+    for (char *ptr = buffer; !done && (ptr + sizeof(struct rt_msghdr)) <= (buffer + count); ptr += msghdr.rtm_msglen)
     {
         memcpy(&msghdr, ptr, sizeof(msghdr));
         if (msghdr.rtm_version != RTM_VERSION)
         {
             // version mismatch
-            return Error_SUCCESS;
+            break;
         }
 
         switch (msghdr.rtm_type)
         {
             case RTM_NEWADDR:
-                onNetworkChange(sock, AddressAdded);
+                changes |= NETWORK_CHANGE_FLAG(AddressAdded);
                 break;
             case RTM_DELADDR:
-                onNetworkChange(sock, AddressRemoved);
+                changes |= NETWORK_CHANGE_FLAG(AddressRemoved);
                 break;
             case RTM_ADD:
             case RTM_DELETE:
             case RTM_REDIRECT:
-                onNetworkChange(sock, AvailabilityChanged);
-                return Error_SUCCESS;
+                changes |= NETWORK_CHANGE_FLAG(AvailabilityChanged);
+                done = true;
+                break;
             default:
                 break;
         }
     }
+
+    ReportNetworkChanges(sock, onNetworkChange, changes);
     return Error_SUCCESS;
 }
 #else
@@ -30,7 +30,11 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <net/if.h>
+#if defined(__linux__)
+#include <linux/errqueue.h>
+#endif
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
@@ -1049,6 +1053,34 @@ SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isI
     return 0;
 }
 
+int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    if (messageHeader == NULL || segmentSize == NULL)
+    {
+        return 0;
+    }
+
+#ifdef UDP_GRO
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_GRO &&
+            controlMessage->cmsg_len >= CMSG_LEN(sizeof(int)))
+        {
+            int value;
+            memcpy(&value, CMSG_DATA(controlMessage), sizeof(int));
+            *segmentSize = value;
+            return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 static int8_t GetMulticastOptionName(int32_t multicastOption, int8_t isIPv6, int* optionName)
 {
     switch (multicastOption)
@@ -1379,6 +1411,20 @@ int32_t SystemNative_Receive(intptr_t socket, void* buffer, int32_t bufferLen, i
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+static void UpdateMessageHeaderFromMsghdr(MessageHeader* messageHeader, const struct msghdr* header)
+{
+    assert(header->msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
+    assert(header->msg_control == messageHeader->ControlBuffer);
+
+    assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+    messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+    assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+    messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+}
+
 int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received)
 {
     if (messageHeader == NULL || received == NULL || messageHeader->SocketAddressLen < 0 ||
@@ -1401,16 +1447,7 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     ssize_t res;
     while ((res = recvmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
 
-    assert(header.msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
-    assert(header.msg_control == messageHeader->ControlBuffer);
-
-    assert((int32_t)header.msg_namelen <= messageHeader->SocketAddressLen);
-    messageHeader->SocketAddressLen = Min((int32_t)header.msg_namelen, messageHeader->SocketAddressLen);
-
-    assert(header.msg_controllen <= (size_t)messageHeader->ControlBufferLen);
-    messageHeader->ControlBufferLen = Min((int32_t)header.msg_controllen, messageHeader->ControlBufferLen);
-
-    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header.msg_flags);
+    UpdateMessageHeaderFromMsghdr(messageHeader, &header);
 
     if (res != -1)
     {
@@ -1422,6 +1459,99 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// recvmmsg and sendmmsg reject more than UIO_MAXIOV messages, larger batches are truncated to this.
+#define MAX_MESSAGES_PER_BATCH 64
+
+static int32_t ValidateMessageHeaders(const MessageHeader* messageHeaders, int32_t messageCount)
+{
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 ||
+            messageHeaders[i].IOVectorCount < 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* messagesReceived)
+{
+    if (messageHeaders == NULL || received == NULL || messagesReceived == NULL || messageCount <= 0 ||
+        !ValidateMessageHeaders(messageHeaders, messageCount))
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesReceived = 0;
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    messageCount = Min(messageCount, MAX_MESSAGES_PER_BATCH);
+
+#if HAVE_SENDMMSG
+    struct mmsghdr headers[MAX_MESSAGES_PER_BATCH];
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    // Only wait for the first message, return whatever else is already queued with it.
+    int res;
+    while ((res = recvmmsg(fd, headers, (unsigned int)messageCount, socketFlags | MSG_WAITFORONE, NULL)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &headers[i].msg_hdr);
+        received[i] = headers[i].msg_len;
+    }
+
+    *messagesReceived = res;
+#else
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        // Like recvmmsg with MSG_WAITFORONE, only the first receive may block.
+        int receiveFlags = (i == 0) ? socketFlags : (socketFlags | MSG_DONTWAIT);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, receiveFlags)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (i == 0)
+            {
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            break;
+        }
+
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &header);
+        received[i] = res;
+        *messagesReceived = i + 1;
+    }
+#endif
+
+    return Error_SUCCESS;
+}
+
 int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
 {
     if (buffer == NULL || bufferLen < 0 || sent == NULL)
@@ -1496,6 +1626,193 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* messagesSent)
+{
+    if (messageHeaders == NULL || sent == NULL || messagesSent == NULL || messageCount <= 0 ||
+        !ValidateMessageHeaders(messageHeaders, messageCount))
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesSent = 0;
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    messageCount = Min(messageCount, MAX_MESSAGES_PER_BATCH);
+
+#if HAVE_SENDMMSG
+    struct mmsghdr headers[MAX_MESSAGES_PER_BATCH];
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, headers, (unsigned int)messageCount, socketFlags)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        sent[i] = headers[i].msg_len;
+    }
+
+    *messagesSent = res;
+#else
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        ssize_t res;
+        while ((res = sendmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            // Like sendmmsg, an error is only reported if no message was sent.
+            if (i == 0)
+            {
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            break;
+        }
+
+        sent[i] = res;
+        *messagesSent = i + 1;
+    }
+#endif
+
+    return Error_SUCCESS;
+}
+
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HAVE_ZEROCOPY_SEND 1
+#else
+#define HAVE_ZEROCOPY_SEND 0
+#endif
+
+int32_t SystemNative_EnableZeroCopySend(intptr_t socket)
+{
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+    int value = 1;
+    return setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SendMessageZeroCopy(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent)
+{
+    if (messageHeader == NULL || sent == NULL || messageHeader->SocketAddressLen < 0 ||
+        messageHeader->ControlBufferLen < 0 || messageHeader->IOVectorCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, fd);
+
+    // The buffers must stay untouched until SystemNative_GetZeroCopySendCompletions has
+    // reported this send as completed. The kernel counts the sends of a socket from 0.
+    ssize_t res;
+    while ((res = sendmsg(fd, &header, socketFlags | MSG_ZEROCOPY)) < 0 && errno == EINTR);
+
+    if (res != -1)
+    {
+        *sent = res;
+        return Error_SUCCESS;
+    }
+
+    *sent = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)flags;
+    *sent = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_GetZeroCopySendCompletions(intptr_t socket, uint32_t* firstSend, uint32_t* lastSend, int32_t* copied)
+{
+    if (firstSend == NULL || lastSend == NULL || copied == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+
+    // The completions are queued on the socket error queue, which is also what makes
+    // the socket report SocketEvents_SA_ERROR while any are pending.
+    uint8_t controlBuffer[CMSG_SPACE(sizeof(struct sock_extended_err)) + CMSG_SPACE(sizeof(struct sockaddr_in6))];
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_control = controlBuffer;
+    header.msg_controllen = sizeof(controlBuffer);
+
+    ssize_t res;
+    while ((res = recvmsg(fd, &header, MSG_ERRQUEUE | MSG_DONTWAIT)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (!((controlMessage->cmsg_level == IPPROTO_IP && controlMessage->cmsg_type == IP_RECVERR) ||
+              (controlMessage->cmsg_level == IPPROTO_IPV6 && controlMessage->cmsg_type == IPV6_RECVERR)))
+        {
+            continue;
+        }
+
+        struct sock_extended_err extendedError;
+        memcpy(&extendedError, CMSG_DATA(controlMessage), sizeof(extendedError));
+
+        if (extendedError.ee_errno == 0 && extendedError.ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+        {
+            // [ee_info, ee_data] is the range of completed sends. If the kernel had to copy
+            // the data anyway, zero-copy sends are not paying off for this socket.
+            *firstSend = extendedError.ee_info;
+            *lastSend = extendedError.ee_data;
+            *copied = (extendedError.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+            return Error_SUCCESS;
+        }
+    }
+
+    // The error queue held something other than a zero-copy completion.
+    return Error_ENOMSG;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -2989,10 +3306,9 @@ int32_t SystemNative_FreeSocketEventBuffer(SocketEvent* buffer)
     return Error_SUCCESS;
 }
 
-int32_t
-SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data)
+static int32_t TryChangeSocketEventRegistrationChecked(
+    int32_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data)
 {
-    int portFd = ToFileDescriptor(port);
     int socketFd = ToFileDescriptor(socket);
 
     const int32_t SupportedEvents = SocketEvents_SA_READ | SocketEvents_SA_WRITE | SocketEvents_SA_READCLOSE | SocketEvents_SA_CLOSE | SocketEvents_SA_ERROR;
@@ -3008,7 +3324,35 @@ SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, in
     }
 
     return TryChangeSocketEventRegistrationInner(
-        portFd, socketFd, (SocketEvents)currentEvents, (SocketEvents)newEvents, data);
+        port, socketFd, (SocketEvents)currentEvents, (SocketEvents)newEvents, data);
+}
+
+int32_t
+SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data)
+{
+    return TryChangeSocketEventRegistrationChecked(ToFileDescriptor(port), socket, currentEvents, newEvents, data);
+}
+
+int32_t SystemNative_TryChangeSocketEventRegistrations(intptr_t port, SocketEventRegistration* registrations, int32_t count)
+{
+    if (registrations == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    int portFd = ToFileDescriptor(port);
+
+    // Neither epoll_ctl nor kevent can report per-change errors for a whole batch on every platform
+    // (EV_RECEIPT is not universal), so the changes are applied one by one; the batch saves the managed
+    // to native transition per socket, which dominates when many connections are accepted at once.
+    for (int32_t i = 0; i < count; i++)
+    {
+        SocketEventRegistration* registration = &registrations[i];
+        registration->Error = TryChangeSocketEventRegistrationChecked(
+            portFd, registration->Socket, registration->CurrentEvents, registration->NewEvents, registration->Data);
+    }
+
+    return Error_SUCCESS;
 }
 
 int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count)
@@ -3259,6 +3603,63 @@ error:
 #endif
 }
 
+int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int32_t moreData, int64_t* transferred)
+{
+    assert(transferred != NULL);
+
+#if defined(__linux__)
+    // One of the descriptors must be a pipe. The pipe end is never waited on, so a
+    // relay can splice socket -> pipe -> socket driven by the socket event port alone.
+    unsigned int spliceFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK | (moreData != 0 ? SPLICE_F_MORE : 0);
+
+    int infd = ToFileDescriptor(in_fd);
+    int outfd = ToFileDescriptor(out_fd);
+
+    ssize_t res;
+    while ((res = splice(infd, NULL, outfd, NULL, (size_t)count, spliceFlags)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *transferred = res;
+        return Error_SUCCESS;
+    }
+
+    *transferred = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)in_fd;
+    (void)out_fd;
+    (void)count;
+    (void)moreData;
+    *transferred = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_Tee(intptr_t in_fd, intptr_t out_fd, int64_t count, int64_t* duplicated)
+{
+    assert(duplicated != NULL);
+
+#if defined(__linux__)
+    // Both descriptors must be pipes, the data stays in the input pipe.
+    ssize_t res;
+    while ((res = tee(ToFileDescriptor(in_fd), ToFileDescriptor(out_fd), (size_t)count, SPLICE_F_NONBLOCK)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *duplicated = res;
+        return Error_SUCCESS;
+    }
+
+    *duplicated = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)in_fd;
+    (void)out_fd;
+    (void)count;
+    *duplicated = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
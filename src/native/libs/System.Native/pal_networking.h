@@ -294,6 +294,16 @@ typedef struct
     uint32_t Padding;    // Pad out to 8-byte alignment
 } SocketEvent;
 
+typedef struct
+{
+    intptr_t Socket;       // Socket whose registration changes
+    uintptr_t Data;        // User data for the socket's events
+    int32_t CurrentEvents; // Currently registered event flags
+    int32_t NewEvents;     // Event flags to register
+    int32_t Error;         // Result of the change, set on return
+    uint32_t Padding;      // Pad out to 8-byte alignment
+} SocketEventRegistration;
+
 PALEXPORT int32_t SystemNative_GetHostEntryForName(const uint8_t* address, int32_t addressFamily, HostEntry* entry);
 
 PALEXPORT void SystemNative_FreeHostEntry(HostEntry* entry);
@@ -336,6 +346,8 @@ PALEXPORT int32_t SystemNative_GetControlMessageBufferSize(int32_t isIPv4, int32
 
 PALEXPORT int32_t SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isIPv4, IPPacketInformation* packetInfo);
 
+PALEXPORT int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize);
+
 PALEXPORT int32_t SystemNative_GetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
 
 PALEXPORT int32_t SystemNative_SetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
@@ -356,10 +368,22 @@ PALEXPORT int32_t SystemNative_Receive(intptr_t socket, void* buffer, int32_t bu
 
 PALEXPORT int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received);
 
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t messageCount, int32_t flags, int32_t* messagesReceived);
+
 PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t messageCount, int32_t flags, int32_t* messagesSent);
+
+PALEXPORT int32_t SystemNative_EnableZeroCopySend(intptr_t socket);
+
+PALEXPORT int32_t SystemNative_SendMessageZeroCopy(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
+
+PALEXPORT int32_t SystemNative_GetZeroCopySendCompletions(intptr_t socket, uint32_t* firstSend, uint32_t* lastSend, int32_t* copied);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -407,6 +431,14 @@ PALEXPORT int32_t SystemNative_FreeSocketEventBuffer(SocketEvent* buffer);
 PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistration(
     intptr_t port, intptr_t socket, int32_t currentEvents, int32_t newEvents, uintptr_t data);
 
+/**
+ * Applies a batch of registration changes in one call. The result of each change is stored in its Error field.
+ *
+ * Returns Error_SUCCESS when the batch was processed, or an error if the arguments are invalid.
+ */
+PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistrations(
+    intptr_t port, SocketEventRegistration* registrations, int32_t count);
+
 PALEXPORT int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count);
 
 PALEXPORT int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void);
@@ -419,6 +451,10 @@ PALEXPORT int32_t SystemNative_GetMaximumAddressSize(void);
 
 PALEXPORT int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent);
 
+PALEXPORT int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int32_t moreData, int64_t* transferred);
+
+PALEXPORT int32_t SystemNative_Tee(intptr_t in_fd, intptr_t out_fd, int64_t count, int64_t* duplicated);
+
 PALEXPORT int32_t SystemNative_Disconnect(intptr_t socket);
 
 PALEXPORT uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName);
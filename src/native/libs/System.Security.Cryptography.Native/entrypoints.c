@@ -112,6 +112,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpAes256Ecb)
     DllImportEntry(CryptoNative_EvpAes256Gcm)
     DllImportEntry(CryptoNative_EvpChaCha20Poly1305)
+    DllImportEntry(CryptoNative_EvpAeadCipherMessages)
     DllImportEntry(CryptoNative_EvpCipherCreate2)
     DllImportEntry(CryptoNative_EvpCipherCreatePartial)
     DllImportEntry(CryptoNative_EvpCipherCtxSetPadding)
@@ -205,6 +206,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_HmacDestroy)
     DllImportEntry(CryptoNative_HmacFinal)
     DllImportEntry(CryptoNative_HmacOneShot)
+    DllImportEntry(CryptoNative_HmacOneShotWithContext)
     DllImportEntry(CryptoNative_HmacReset)
     DllImportEntry(CryptoNative_HmacUpdate)
     DllImportEntry(CryptoNative_LookupFriendlyNameByOid)
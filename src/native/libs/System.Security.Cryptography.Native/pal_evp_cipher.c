@@ -233,6 +233,86 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 #endif
 }
 
+static int32_t AeadCipherMessage(EVP_CIPHER_CTX* ctx, int32_t enc, AeadMessage* message)
+{
+    int outLength;
+
+    // Only the nonce changes between messages, the key schedule in ctx is kept.
+    if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, message->Nonce, enc))
+    {
+        return 0;
+    }
+
+    // EVP_CTRL_GCM_SET_TAG and EVP_CTRL_GCM_GET_TAG are the EVP_CTRL_AEAD_* values ChaCha20-Poly1305 expects.
+    if (!enc && EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, message->TagLength, message->Tag) <= 0)
+    {
+        return 0;
+    }
+
+    if (message->AssociatedDataLength > 0 &&
+        !EVP_CipherUpdate(ctx, NULL, &outLength, message->AssociatedData, message->AssociatedDataLength))
+    {
+        return 0;
+    }
+
+    int written = 0;
+    if (message->InputLength > 0)
+    {
+        if (!EVP_CipherUpdate(ctx, message->Output, &outLength, message->Input, message->InputLength))
+        {
+            return 0;
+        }
+
+        written = outLength;
+    }
+
+    // Stream modes produce no output here, but a failure is how a tag mismatch is reported.
+    if (!EVP_CipherFinal_ex(ctx, message->Output + written, &outLength))
+    {
+        return 0;
+    }
+
+    if (enc && EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, message->TagLength, message->Tag) <= 0)
+    {
+        return 0;
+    }
+
+    return SUCCESS;
+}
+
+int32_t CryptoNative_EvpAeadCipherMessages(EVP_CIPHER_CTX* ctx, int32_t enc, AeadMessage* messages, int32_t count)
+{
+    if (ctx == NULL || messages == NULL || count < 0 || (enc != 0 && enc != 1))
+    {
+        return 0;
+    }
+
+    ERR_clear_error();
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        AeadMessage* message = &messages[i];
+        assert(message->Nonce != NULL && message->Tag != NULL);
+        assert(message->InputLength >= 0 && (message->Input != NULL || message->InputLength == 0));
+        assert(message->AssociatedDataLength >= 0 && (message->AssociatedData != NULL || message->AssociatedDataLength == 0));
+
+        message->Result = AeadCipherMessage(ctx, enc, message);
+        if (message->Result != SUCCESS)
+        {
+            // Decryption writes the plaintext before the tag is checked, don't leave it behind unauthenticated.
+            if (message->InputLength > 0)
+            {
+                OPENSSL_cleanse(message->Output, (size_t)message->InputLength);
+            }
+
+            // The failure is reported through Result, don't leave its errors to the next message or caller.
+            ERR_clear_error();
+        }
+    }
+
+    return SUCCESS;
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb()
 {
     // No error queue impact.
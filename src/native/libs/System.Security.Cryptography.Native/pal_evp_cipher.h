@@ -110,6 +110,34 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+A message for EvpAeadCipherMessages.
+*/
+typedef struct
+{
+    uint8_t* Nonce;          // nonce of the length the context was initialized for
+    uint8_t* AssociatedData; // may be NULL if AssociatedDataLength is 0
+    uint8_t* Input;          // plaintext when encrypting, ciphertext when decrypting
+    uint8_t* Output;         // receives InputLength bytes
+    uint8_t* Tag;            // receives the tag when encrypting, holds the expected tag when decrypting
+    int32_t AssociatedDataLength;
+    int32_t InputLength;
+    int32_t TagLength;
+    int32_t Result;          // set to 1 on success, 0 on failure (including a tag mismatch)
+} AeadMessage;
+
+/*
+Function:
+EvpAeadCipherMessages
+
+Encrypts or decrypts a batch of AES-GCM or ChaCha20-Poly1305 messages with an EVP_CIPHER_CTX that already has
+its key and nonce length set, resetting only the nonce between messages. Each message reports its own Result.
+The Output of a message that fails, for example on a tag mismatch, is zeroed.
+
+Returns 1 if the batch was processed, 0 if the arguments are invalid.
+*/
+PALEXPORT int32_t CryptoNative_EvpAeadCipherMessages(EVP_CIPHER_CTX* ctx, int32_t enc, AeadMessage* messages, int32_t count);
+
 /*
 Function:
 EvpAes128Ecb
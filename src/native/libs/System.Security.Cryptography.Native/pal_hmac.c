@@ -150,6 +150,32 @@ int32_t CryptoNative_HmacCurrent(const HMAC_CTX* ctx, uint8_t* md, int32_t* len)
     return 0;
 }
 
+int32_t CryptoNative_HmacOneShotWithContext(
+    HMAC_CTX* ctx, const uint8_t* source, int32_t sourceSize, uint8_t* md, int32_t* mdSize)
+{
+    assert(ctx != NULL && md != NULL && mdSize != NULL);
+    assert(*mdSize >= 0);
+    assert(source != NULL || sourceSize == 0);
+
+    ERR_clear_error();
+
+    if (sourceSize < 0 || *mdSize < 0)
+    {
+        return -1;
+    }
+
+    // HMAC_Init_ex without a key restores the inner pad state computed when the key was set.
+    if (!HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) || !HMAC_Update(ctx, source, Int32ToSizeT(sourceSize)))
+    {
+        return 0;
+    }
+
+    unsigned int unsignedSize = Int32ToUint32(*mdSize);
+    int ret = HMAC_Final(ctx, md, &unsignedSize);
+    *mdSize = Uint32ToInt32(unsignedSize);
+    return ret;
+}
+
 int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
                                  const uint8_t* key,
                                  int32_t keySize,
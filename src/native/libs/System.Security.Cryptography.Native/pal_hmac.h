@@ -70,6 +70,16 @@ PALEXPORT int32_t CryptoNative_HmacFinal(HMAC_CTX* ctx, uint8_t* md, int32_t* le
  */
 PALEXPORT int32_t CryptoNative_HmacCurrent(const HMAC_CTX* ctx, uint8_t* md, int32_t* len);
 
+/**
+ * Computes the HMAC of data with the key ctx was created with, in a single call. The key pads hashed by
+ * HmacCreate are reused rather than recomputed, and any state already accumulated in ctx is discarded. A ctx
+ * must not be used by several threads at once; callers computing concurrently keep one ctx per thread.
+ *
+ * Returns -1 on invalid input, 0 on failure, and 1 on success.
+ */
+PALEXPORT int32_t CryptoNative_HmacOneShotWithContext(
+    HMAC_CTX* ctx, const uint8_t* source, int32_t sourceSize, uint8_t* md, int32_t* mdSize);
+
 /**
  * Computes the HMAC of data using a key in a single operation.
  * Returns -1 on invalid input, 0 on failure, and 1 on success.
@@ -0,0 +1,245 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Methods with skewed branches, run with TieredPGO and JitExtTspLayout=1 so
+// that their Tier1 code is laid out from the Tier0 profile. The methods are
+// called until they have tiered up, with inputs that are mostly on the hot
+// paths and sometimes on the cold ones, and their results are compared with
+// unoptimized copies. The methods must not be AggressiveOptimization, which
+// would bypass tiering and so the profile.
+
+public class ExtTspLayout
+{
+    const int Rounds = 40;
+    const int CallsPerRound = 200;
+
+    // Chain of conditions where the last test is the hot one.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Classify(int x)
+    {
+        int result;
+        if (x < 0)
+        {
+            result = -1;
+        }
+        else if (x == 0)
+        {
+            result = 0;
+        }
+        else if (x < 10)
+        {
+            result = x * 3;
+        }
+        else if (x < 100)
+        {
+            result = x + 7;
+        }
+        else
+        {
+            result = x ^ 0x55;
+        }
+
+        return result + 1;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static int ClassifyRef(int x)
+    {
+        int result;
+        if (x < 0)
+        {
+            result = -1;
+        }
+        else if (x == 0)
+        {
+            result = 0;
+        }
+        else if (x < 10)
+        {
+            result = x * 3;
+        }
+        else if (x < 100)
+        {
+            result = x + 7;
+        }
+        else
+        {
+            result = x ^ 0x55;
+        }
+
+        return result + 1;
+    }
+
+    // Loop with a rarely taken early exit and a rarely taken inner branch.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Scan(int[] a, int stop)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            int v = a[i];
+            if (v == stop)
+            {
+                return -sum;
+            }
+
+            if ((v & 0xFF) == 0)
+            {
+                sum += v >> 8;
+            }
+            else
+            {
+                sum += v;
+            }
+        }
+
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static int ScanRef(int[] a, int stop)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            int v = a[i];
+            if (v == stop)
+            {
+                return -sum;
+            }
+
+            if ((v & 0xFF) == 0)
+            {
+                sum += v >> 8;
+            }
+            else
+            {
+                sum += v;
+            }
+        }
+
+        return sum;
+    }
+
+    // Switch with one hot case.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Dispatch(int kind, long x)
+    {
+        switch (kind)
+        {
+            case 0:
+                return x + 1;
+            case 1:
+                return x * 5;
+            case 2:
+                return x - 9;
+            case 3:
+                return x << 3;
+            default:
+                return ~x;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static long DispatchRef(int kind, long x)
+    {
+        switch (kind)
+        {
+            case 0:
+                return x + 1;
+            case 1:
+                return x * 5;
+            case 2:
+                return x - 9;
+            case 3:
+                return x << 3;
+            default:
+                return ~x;
+        }
+    }
+
+    // Methods with EH are left alone by the layout.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Checked(int x, int y)
+    {
+        try
+        {
+            if (x > 1000)
+            {
+                return checked(x * y);
+            }
+
+            return x + y;
+        }
+        catch (OverflowException)
+        {
+            return -1;
+        }
+    }
+
+    static int Input(int call)
+    {
+        // One input in sixteen is on a cold path.
+        if ((call & 15) == 15)
+        {
+            return ((call >> 4) % 4 == 0) ? -call : (call >> 4) % 101;
+        }
+
+        return 200 + call;
+    }
+
+    public static int Main()
+    {
+        int[] data = new int[64];
+        for (int i = 0; i < data.Length; i++)
+        {
+            data[i] = (i * 37 + 1) << ((i % 5 == 0) ? 8 : 0);
+        }
+
+        for (int round = 0; round < Rounds; round++)
+        {
+            for (int call = 0; call < CallsPerRound; call++)
+            {
+                int x = Input(round * CallsPerRound + call);
+
+                if (Classify(x) != ClassifyRef(x))
+                {
+                    Console.WriteLine($"Classify({x}) mismatch");
+                    return 101;
+                }
+
+                int stop = ((call & 31) == 31) ? data[call % data.Length] : -1;
+                if (Scan(data, stop) != ScanRef(data, stop))
+                {
+                    Console.WriteLine($"Scan({stop}) mismatch");
+                    return 102;
+                }
+
+                int kind = ((call & 15) == 15) ? (call >> 4) % 6 : 1;
+                if (Dispatch(kind, x) != DispatchRef(kind, x))
+                {
+                    Console.WriteLine($"Dispatch({kind}, {x}) mismatch");
+                    return 103;
+                }
+
+                int y = ((call & 15) == 15) ? int.MaxValue : 3;
+                int expected = (x > 1000) ? ((y == 3) ? x * 3 : -1) : x + y;
+                if (Checked(x, y) != expected)
+                {
+                    Console.WriteLine($"Checked({x}, {y}) mismatch");
+                    return 104;
+                }
+            }
+
+            // Give the tiering background work a chance to install the
+            // optimized code.
+            Thread.Sleep(5);
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,128 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Delegates to static methods that are closed over their first argument,
+// run with TieredPGO so that the delegate calls in the Invoke methods are
+// guarded devirtualized at Tier1. The devirtualized call has to pass the
+// delegate's target as the first argument of the static method, after the
+// return buffer when there is one. The Invoke methods are called until they
+// have tiered up and their results are checked on every call, including calls
+// with a delegate other than the profiled one, which take the fallback.
+
+public class Box
+{
+    public int Value;
+
+    public Box(int value)
+    {
+        Value = value;
+    }
+}
+
+public struct Large
+{
+    public long A;
+    public long B;
+    public long C;
+    public long D;
+}
+
+public static class BoxExtensions
+{
+    public static int Add(this Box box, int x) => box.Value + x;
+
+    public static int Sub(this Box box, int x) => box.Value - x;
+
+    public static Large Spread(this Box box, int x)
+    {
+        Large result;
+        result.A = box.Value;
+        result.B = x;
+        result.C = (long)box.Value * x;
+        result.D = box.Value - x;
+        return result;
+    }
+
+    // Target of a delegate closed over null.
+    public static int OrDefault(Box box, int x) => box == null ? -x : box.Value * x;
+}
+
+public class ClosedStaticDelegate
+{
+    const int Rounds = 40;
+    const int CallsPerRound = 200;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Invoke(Func<int, int> f, int x) => f(x);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Large InvokeLarge(Func<int, Large> f, int x) => f(x);
+
+    static bool Check(Large l, int value, int x)
+    {
+        return (l.A == value) && (l.B == x) && (l.C == (long)value * x) && (l.D == value - x);
+    }
+
+    public static int Main()
+    {
+        Box box = new Box(17);
+        Func<int, int> add = box.Add;
+        Func<int, int> sub = box.Sub;
+        Func<int, Large> spread = box.Spread;
+        MethodInfo orDefaultMethod = typeof(BoxExtensions).GetMethod(nameof(BoxExtensions.OrDefault));
+        Func<int, int> orDefault = (Func<int, int>)Delegate.CreateDelegate(typeof(Func<int, int>), null, orDefaultMethod);
+        Func<int, Large> open = x => new Large { A = 1, B = 2, C = 3, D = 4 };
+
+        for (int round = 0; round < Rounds; round++)
+        {
+            for (int i = 0; i < CallsPerRound; i++)
+            {
+                int x = round * CallsPerRound + i;
+
+                if (Invoke(add, x) != box.Value + x)
+                {
+                    Console.WriteLine($"add({x}) mismatch");
+                    return 101;
+                }
+
+                if (!Check(InvokeLarge(spread, x), box.Value, x))
+                {
+                    Console.WriteLine($"spread({x}) mismatch");
+                    return 102;
+                }
+
+                // Rarely, delegates the profile has not seen.
+                if ((i % 50) == 0)
+                {
+                    if (Invoke(sub, x) != box.Value - x)
+                    {
+                        Console.WriteLine($"sub({x}) mismatch");
+                        return 103;
+                    }
+
+                    if (Invoke(orDefault, x) != -x)
+                    {
+                        Console.WriteLine($"orDefault({x}) mismatch");
+                        return 104;
+                    }
+
+                    Large l = InvokeLarge(open, x);
+                    if ((l.A != 1) || (l.B != 2) || (l.C != 3) || (l.D != 4))
+                    {
+                        Console.WriteLine($"open({x}) mismatch");
+                        return 105;
+                    }
+                }
+            }
+
+            Thread.Sleep(5);
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,147 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Branches that if conversion turns into conditional selects. The test runs with
+// JitDoIfConversion=2 so that they are converted without profile data, and covers
+// each of the recognized shapes with int and long locals, constants and compares.
+
+public class IfConversion
+{
+    // Triangle where the false successor is the middle block.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int MinInt(int a, int b)
+    {
+        int r = a;
+        if (b < a)
+        {
+            r = b;
+        }
+        return r;
+    }
+
+    // Diamond of two constants.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int Sign(int a)
+    {
+        int r;
+        if (a >= 0)
+        {
+            r = 1;
+        }
+        else
+        {
+            r = -1;
+        }
+        return r;
+    }
+
+    // Diamond of two locals, on longs.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static long MaxLong(long a, long b)
+    {
+        long r;
+        if (a > b)
+        {
+            r = a;
+        }
+        else
+        {
+            r = b;
+        }
+        return r;
+    }
+
+    // Unsigned compare.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static uint ClampUnsigned(uint a, uint limit)
+    {
+        uint r = a;
+        if (a > limit)
+        {
+            r = limit;
+        }
+        return r;
+    }
+
+    // Equality compare selecting between a constant and a local.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int ZeroToDefault(int a, int d)
+    {
+        int r = a;
+        if (a == 0)
+        {
+            r = d;
+        }
+        return r;
+    }
+
+    // Compare of longs producing an int.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int CompareLong(long a, long b)
+    {
+        int r = 0;
+        if (a != b)
+        {
+            r = 7;
+        }
+        return r;
+    }
+
+    // A branch within a loop is not converted without profile data, it must still be correct.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int CountNegative(int[] values)
+    {
+        int count = 0;
+        foreach (int v in values)
+        {
+            int d = 0;
+            if (v < 0)
+            {
+                d = 1;
+            }
+            count += d;
+        }
+        return count;
+    }
+
+    static int s_failures;
+
+    static void Check<T>(T actual, T expected, string what) where T : IEquatable<T>
+    {
+        if (!actual.Equals(expected))
+        {
+            Console.WriteLine($"{what}: expected {expected}, got {actual}");
+            s_failures++;
+        }
+    }
+
+    public static int Main()
+    {
+        Check(MinInt(3, 5), 3, "MinInt(3, 5)");
+        Check(MinInt(5, 3), 3, "MinInt(5, 3)");
+        Check(MinInt(int.MinValue, int.MaxValue), int.MinValue, "MinInt(MinValue, MaxValue)");
+
+        Check(Sign(0), 1, "Sign(0)");
+        Check(Sign(42), 1, "Sign(42)");
+        Check(Sign(-42), -1, "Sign(-42)");
+
+        Check(MaxLong(long.MaxValue, 0), long.MaxValue, "MaxLong(MaxValue, 0)");
+        Check(MaxLong(-1, 1L << 40), 1L << 40, "MaxLong(-1, 2^40)");
+
+        Check(ClampUnsigned(0xFFFFFFFF, 10), 10u, "ClampUnsigned(0xFFFFFFFF, 10)");
+        Check(ClampUnsigned(5, 10), 5u, "ClampUnsigned(5, 10)");
+
+        Check(ZeroToDefault(0, 9), 9, "ZeroToDefault(0, 9)");
+        Check(ZeroToDefault(4, 9), 4, "ZeroToDefault(4, 9)");
+
+        Check(CompareLong(1L << 33, 0), 7, "CompareLong(2^33, 0)");
+        Check(CompareLong(-5, -5), 0, "CompareLong(-5, -5)");
+
+        Check(CountNegative(new int[] { -1, 2, -3, 0, int.MinValue }), 3, "CountNegative");
+
+        return (s_failures == 0) ? 100 : 101;
+    }
+}
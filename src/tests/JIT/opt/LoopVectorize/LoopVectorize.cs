@@ -0,0 +1,401 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Array loops run with JitVectorizeLoops=1. The results of loops the
+// vectorizer handles are compared with unoptimized reference loops for every
+// length up to a few vectors, so that both the vector body and the scalar
+// remainder run. Loops the vectorizer must leave alone (reductions, calls,
+// non-unit steps, other element types, shifted indices) are checked as well.
+
+public class LoopVectorize
+{
+    const int MaxLength = 67;
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void AddInt(int[] a, int[] b, int[] c)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = b[i] + c[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void AddIntRef(int[] a, int[] b, int[] c)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = b[i] + c[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void MulSubInt(int[] a, int[] b, int x, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = b[i] * x - 3;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void MulSubIntRef(int[] a, int[] b, int x, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = b[i] * x - 3;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void XorLong(long[] a, long[] b, long x)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (b[i] ^ x) & 0x0F0F0F0F0F0F0F0FL;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void XorLongRef(long[] a, long[] b, long x)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (b[i] ^ x) & 0x0F0F0F0F0F0F0F0FL;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void MulDivFloat(float[] a, float[] b, float[] c, float x)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = b[i] * c[i] / x;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void MulDivFloatRef(float[] a, float[] b, float[] c, float x)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = b[i] * c[i] / x;
+        }
+    }
+
+    // Two stores in one loop.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void SumDiffDouble(double[] s, double[] d, double[] b, double[] c)
+    {
+        for (int i = 0; i < s.Length; i++)
+        {
+            s[i] = b[i] + c[i];
+            d[i] = b[i] - c[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void SumDiffDoubleRef(double[] s, double[] d, double[] b, double[] c)
+    {
+        for (int i = 0; i < s.Length; i++)
+        {
+            s[i] = b[i] + c[i];
+            d[i] = b[i] - c[i];
+        }
+    }
+
+    // Non-zero start; the destination is also a source.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void AccumulateInt(int[] a, int[] b, int start)
+    {
+        for (int i = start; i < a.Length; i++)
+        {
+            a[i] = a[i] + b[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void AccumulateIntRef(int[] a, int[] b, int start)
+    {
+        for (int i = start; i < a.Length; i++)
+        {
+            a[i] = a[i] + b[i];
+        }
+    }
+
+    // Not vectorized: reduction.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int SumInt(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    // Not vectorized: the value read depends on a previous store.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void PrefixInt(int[] a)
+    {
+        for (int i = 1; i < a.Length; i++)
+        {
+            a[i] = a[i - 1] + a[i];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void PrefixIntRef(int[] a)
+    {
+        for (int i = 1; i < a.Length; i++)
+        {
+            a[i] = a[i - 1] + a[i];
+        }
+    }
+
+    // Not vectorized: non-unit step.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void StepInt(int[] a, int[] b)
+    {
+        for (int i = 0; i < a.Length; i += 2)
+        {
+            a[i] = b[i] + 1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static void StepIntRef(int[] a, int[] b)
+    {
+        for (int i = 0; i < a.Length; i += 2)
+        {
+            a[i] = b[i] + 1;
+        }
+    }
+
+    // Not vectorized: call in the loop body.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Twice(int x) => x * 2;
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void CallInt(int[] a, int[] b)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = Twice(b[i]);
+        }
+    }
+
+    // Not vectorized: unsupported element type and integer division.
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void AddShort(short[] a, short[] b)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = (short)(a[i] + b[i]);
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void DivInt(int[] a, int[] b, int x)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = b[i] / x;
+        }
+    }
+
+    static int[] Ints(int n, int seed)
+    {
+        int[] a = new int[n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = (i * 7919 + seed) ^ (i << 20);
+        }
+        return a;
+    }
+
+    static bool Same<T>(T[] x, T[] y) where T : IEquatable<T>
+    {
+        if (x.Length != y.Length)
+        {
+            return false;
+        }
+        for (int i = 0; i < x.Length; i++)
+        {
+            if (!x[i].Equals(y[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static int TestSupported()
+    {
+        for (int n = 0; n <= MaxLength; n++)
+        {
+            int[] b = Ints(n, 1);
+            int[] c = Ints(n, 2);
+
+            int[] a = new int[n];
+            int[] r = new int[n];
+            AddInt(a, b, c);
+            AddIntRef(r, b, c);
+            if (!Same(a, r)) return 101;
+
+            a = new int[n];
+            r = new int[n];
+            MulSubInt(a, b, -5, n);
+            MulSubIntRef(r, b, -5, n);
+            if (!Same(a, r)) return 102;
+
+            long[] lb = new long[n];
+            for (int i = 0; i < n; i++) lb[i] = ((long)b[i] << 32) | (uint)c[i];
+            long[] la = new long[n];
+            long[] lr = new long[n];
+            XorLong(la, lb, 0x123456789ABCDEFL);
+            XorLongRef(lr, lb, 0x123456789ABCDEFL);
+            if (!Same(la, lr)) return 103;
+
+            float[] fb = new float[n];
+            float[] fc = new float[n];
+            for (int i = 0; i < n; i++)
+            {
+                fb[i] = b[i] / 1000.0f;
+                fc[i] = i - 10.5f;
+            }
+            float[] fa = new float[n];
+            float[] fr = new float[n];
+            MulDivFloat(fa, fb, fc, 3.0f);
+            MulDivFloatRef(fr, fb, fc, 3.0f);
+            if (!Same(fa, fr)) return 104;
+
+            double[] db = new double[n];
+            double[] dc = new double[n];
+            for (int i = 0; i < n; i++)
+            {
+                db[i] = b[i] * 0.25;
+                dc[i] = c[i] * -0.5;
+            }
+            double[] ds = new double[n];
+            double[] dd = new double[n];
+            double[] rs = new double[n];
+            double[] rd = new double[n];
+            SumDiffDouble(ds, dd, db, dc);
+            SumDiffDoubleRef(rs, rd, db, dc);
+            if (!Same(ds, rs) || !Same(dd, rd)) return 105;
+
+            for (int start = 0; start <= Math.Min(n, 9); start++)
+            {
+                a = Ints(n, 3);
+                r = Ints(n, 3);
+                AccumulateInt(a, b, start);
+                AccumulateIntRef(r, b, start);
+                if (!Same(a, r)) return 106;
+            }
+
+            // Destination and source are the same array.
+            a = Ints(n, 4);
+            r = Ints(n, 4);
+            AddInt(a, a, c);
+            AddIntRef(r, r, c);
+            if (!Same(a, r)) return 107;
+        }
+
+        // Fewer iterations than the array length.
+        int[] big = Ints(MaxLength, 5);
+        int[] dst = new int[MaxLength];
+        MulSubInt(dst, big, 9, 13);
+        for (int i = 0; i < MaxLength; i++)
+        {
+            if (dst[i] != ((i < 13) ? (big[i] * 9 - 3) : 0)) return 108;
+        }
+
+        return 100;
+    }
+
+    static int TestRejected()
+    {
+        for (int n = 0; n <= MaxLength; n++)
+        {
+            int[] b = Ints(n, 6);
+
+            int expected = 0;
+            for (int i = 0; i < n; i++) expected += b[i];
+            if (SumInt(b) != expected) return 201;
+
+            int[] a = Ints(n, 7);
+            int[] r = Ints(n, 7);
+            PrefixInt(a);
+            PrefixIntRef(r);
+            if (!Same(a, r)) return 202;
+
+            a = new int[n];
+            r = new int[n];
+            StepInt(a, b);
+            StepIntRef(r, b);
+            if (!Same(a, r)) return 203;
+
+            a = new int[n];
+            CallInt(a, b);
+            for (int i = 0; i < n; i++)
+            {
+                if (a[i] != b[i] * 2) return 204;
+            }
+
+            short[] sa = new short[n];
+            short[] sb = new short[n];
+            for (int i = 0; i < n; i++)
+            {
+                sa[i] = (short)b[i];
+                sb[i] = short.MaxValue;
+            }
+            AddShort(sa, sb);
+            for (int i = 0; i < n; i++)
+            {
+                if (sa[i] != (short)((short)b[i] + short.MaxValue)) return 205;
+            }
+
+            a = new int[n];
+            DivInt(a, b, -7);
+            for (int i = 0; i < n; i++)
+            {
+                if (a[i] != b[i] / -7) return 206;
+            }
+        }
+
+        try
+        {
+            DivInt(new int[4], new int[4], 0);
+            return 207;
+        }
+        catch (DivideByZeroException)
+        {
+        }
+
+        return 100;
+    }
+
+    public static int Main()
+    {
+        int result = TestSupported();
+        if (result != 100)
+        {
+            Console.WriteLine($"Vectorized loop mismatch: {result}");
+            return result;
+        }
+
+        result = TestRejected();
+        if (result != 100)
+        {
+            Console.WriteLine($"Rejected loop mismatch: {result}");
+            return result;
+        }
+
+        return 100;
+    }
+}
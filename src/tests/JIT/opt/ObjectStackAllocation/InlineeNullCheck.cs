@@ -0,0 +1,136 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Objects that are only used by inlined instance methods. The null check the inliner
+// puts on 'this' does not make them escape, so with JitObjectStackAllocation=1 they
+// are allocated on the stack. Objects that do escape must stay on the heap. Which
+// one happened is checked with the bytes the thread allocated around each call.
+
+public class InlineeNullCheck
+{
+    enum AllocationKind
+    {
+        Heap,
+        Stack,
+        Undefined
+    }
+
+    delegate int Test();
+
+    class Point
+    {
+        public int X;
+        public int Y;
+
+        public Point(int x, int y)
+        {
+            X = x;
+            Y = y;
+        }
+
+        public int LengthSquared() => X * X + Y * Y;
+
+        public void Scale(int factor)
+        {
+            X *= factor;
+            Y *= factor;
+        }
+    }
+
+    static Point s_escaped;
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int NotEscaping(int x, int y)
+    {
+        Point p = new Point(x, y);
+        p.Scale(2);
+        return p.LengthSquared();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int Escaping(int x, int y)
+    {
+        Point p = new Point(x, y);
+        p.Scale(3);
+        s_escaped = p;
+        return p.LengthSquared();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static bool NullCompare(int x)
+    {
+        Point p = new Point(x, x);
+        return p != null && p.LengthSquared() == 2 * x * x;
+    }
+
+    static bool GCStressEnabled()
+    {
+        return (Environment.GetEnvironmentVariable("DOTNET_GCStress") != null) ||
+               (Environment.GetEnvironmentVariable("COMPlus_GCStress") != null);
+    }
+
+    static bool CallTestAndVerifyAllocation(Test test, int expectedResult, AllocationKind expectedAllocationKind, string name)
+    {
+        long allocatedBytesBefore = GC.GetAllocatedBytesForCurrentThread();
+        int testResult = test();
+        long allocatedBytesAfter = GC.GetAllocatedBytesForCurrentThread();
+
+        if (testResult != expectedResult)
+        {
+            Console.WriteLine($"{name} failed: expected {expectedResult}, got {testResult}");
+            return false;
+        }
+
+        if ((expectedAllocationKind == AllocationKind.Stack) && (allocatedBytesBefore != allocatedBytesAfter))
+        {
+            Console.WriteLine($"{name} failed: unexpected heap allocation of {allocatedBytesAfter - allocatedBytesBefore} bytes");
+            return false;
+        }
+
+        if ((expectedAllocationKind == AllocationKind.Heap) && (allocatedBytesBefore == allocatedBytesAfter))
+        {
+            Console.WriteLine($"{name} failed: no heap allocation");
+            return false;
+        }
+
+        return true;
+    }
+
+    public static int Main()
+    {
+        AllocationKind expectedAllocationKind = AllocationKind.Stack;
+        if (GCStressEnabled())
+        {
+            Console.WriteLine("GCStress is enabled");
+            expectedAllocationKind = AllocationKind.Undefined;
+        }
+
+        if (!CallTestAndVerifyAllocation(() => NotEscaping(3, 4), 100, expectedAllocationKind, "NotEscaping"))
+        {
+            return 101;
+        }
+
+        if (!CallTestAndVerifyAllocation(() => Escaping(1, 2), 45, AllocationKind.Heap, "Escaping"))
+        {
+            return 102;
+        }
+
+        GC.Collect();
+
+        if (s_escaped.X != 3 || s_escaped.Y != 6)
+        {
+            Console.WriteLine("Escaped object was corrupted");
+            return 103;
+        }
+
+        if (!CallTestAndVerifyAllocation(() => NullCompare(5) ? 1 : 0, 1, expectedAllocationKind, "NullCompare"))
+        {
+            return 104;
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,134 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Struct locals that struct promotion leaves in memory, run with
+// JitEnablePhysicalPromotion=1 so that their hot fields get replacement locals.
+// Covers read back and write back around whole struct uses, block copies and
+// zero inits of structs with replacements, and accesses within EH regions.
+
+public class PhysicalPromotion
+{
+    // More fields than struct promotion handles.
+    struct Big
+    {
+        public int A;
+        public long B;
+        public double C;
+        public int D;
+        public object E;
+        public float F;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static long Accumulate(int n)
+    {
+        Big b = default;
+        for (int i = 0; i < n; i++)
+        {
+            b.A += i;
+            b.B += (long)i * i;
+            b.C += 0.5;
+        }
+        return b.A + b.B + (long)b.C;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Observe(Big b) => b.A + b.B + b.D + (b.E == null ? 0 : 1);
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static long WholeStructUses(int n)
+    {
+        Big b = default;
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            b.A++;
+            b.B += 2;
+            // The callee must see the current field values.
+            sum += Observe(b);
+            b.D = b.A;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static long CopiesAndZeroInits(int n, object o)
+    {
+        Big b = default;
+        Big c = default;
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            b.A = i;
+            b.E = o;
+            c = b;
+            c.B = c.A * 3;
+            sum += c.A + c.B + (c.E == o ? 1 : 0);
+            if ((i & 3) == 0)
+            {
+                c = default;
+                sum += c.A + c.B;
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static long InTry(int n)
+    {
+        Big b = default;
+        try
+        {
+            for (int i = 0; i < n; i++)
+            {
+                b.A += 1;
+                b.B += b.A;
+                if (i == n - 1)
+                {
+                    throw new InvalidOperationException();
+                }
+            }
+        }
+        catch (InvalidOperationException)
+        {
+            // The struct memory must be up to date when the exception is thrown.
+            return b.A + b.B;
+        }
+        return -1;
+    }
+
+    public static int Main()
+    {
+        if (Accumulate(100) != 4950 + 328350 + 50)
+        {
+            Console.WriteLine("Accumulate failed");
+            return 101;
+        }
+
+        // sum over i = 1..10 of (i + 2i + (i - 1) + 0)
+        if (WholeStructUses(10) != 210)
+        {
+            Console.WriteLine("WholeStructUses failed");
+            return 102;
+        }
+
+        // sum over i = 0..7 of (4i + 1)
+        if (CopiesAndZeroInits(8, new object()) != 120)
+        {
+            Console.WriteLine("CopiesAndZeroInits failed");
+            return 103;
+        }
+
+        // A = 10, B = 1 + 2 + ... + 10
+        if (InTry(10) != 65)
+        {
+            Console.WriteLine("InTry failed");
+            return 104;
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,77 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Bounds checks against a bound that is itself compared against the array length.
+// The compared bound may be negative, so it must not be used to widen the range of
+// a phi that also merges a non-negative constant.
+
+public class ComparedCheckedBound
+{
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int SumBelow(int[] a, int n)
+    {
+        int sum = 0;
+        if (n <= a.Length)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                sum += a[i];
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void StoreAfter(int[] a, int n, int k)
+    {
+        if (n < a.Length)
+        {
+            int j = 0;
+            if (k >= 0 && k < n)
+            {
+                j = k + 1;
+            }
+            a[j] = 1;
+        }
+    }
+
+    public static int Main()
+    {
+        int[] a = new int[] { 1, 2, 3, 4 };
+
+        if (SumBelow(a, 4) != 10 || SumBelow(a, 2) != 3 || SumBelow(a, -1) != 0 || SumBelow(a, 5) != 0)
+        {
+            Console.WriteLine("SumBelow failed");
+            return 101;
+        }
+
+        StoreAfter(a, 3, 2);
+        if (a[3] != 1)
+        {
+            Console.WriteLine("StoreAfter failed");
+            return 102;
+        }
+
+        // a.Length == 0 and n == -1: j stays 0, which is out of range.
+        bool threw = false;
+        try
+        {
+            StoreAfter(new int[0], -1, 0);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            threw = true;
+        }
+
+        if (!threw)
+        {
+            Console.WriteLine("StoreAfter did not throw for a negative bound");
+            return 103;
+        }
+
+        return 100;
+    }
+}
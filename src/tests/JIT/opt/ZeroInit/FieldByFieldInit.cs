@@ -0,0 +1,85 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Struct locals that are not promoted and are defined field by field can skip prolog
+// zeroing. A leading zero store that is removed because the prolog zeroes the local
+// must not count towards the fields that are defined.
+
+public class FieldByFieldInit
+{
+    // More fields than the JIT promotes, so the local stays on the frame.
+    struct S
+    {
+        public int A;
+        public int B;
+        public int C;
+        public int D;
+        public int E;
+        public int F;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int Dirty()
+    {
+        Span<int> junk = stackalloc int[64];
+        junk.Fill(-1);
+        int sum = 0;
+        foreach (int j in junk)
+        {
+            sum += j;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int ReadAfterRemovedZero()
+    {
+        S s;
+        s.A = 0;
+        int x = s.A;
+        s.B = 1;
+        s.C = 2;
+        s.D = 3;
+        s.E = 4;
+        s.F = 5;
+        return x + Consume(ref s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int AllFields()
+    {
+        S s;
+        s.A = 1;
+        s.B = 2;
+        s.C = 3;
+        s.D = 4;
+        s.E = 5;
+        s.F = 6;
+        return Consume(ref s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int Consume(ref S s) => s.A + s.B + s.C + s.D + s.E + s.F;
+
+    public static int Main()
+    {
+        Dirty();
+        if (ReadAfterRemovedZero() != 15)
+        {
+            Console.WriteLine("ReadAfterRemovedZero failed");
+            return 101;
+        }
+
+        Dirty();
+        if (AllFields() != 21)
+        {
+            Console.WriteLine("AllFields failed");
+            return 102;
+        }
+
+        return 100;
+    }
+}
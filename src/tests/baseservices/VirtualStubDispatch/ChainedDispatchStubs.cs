@@ -0,0 +1,164 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+// Interface call sites that see a few receiver types get dispatch stubs
+// for the new types chained in front of their current one, and go through
+// the resolve stub once the chain is full. Each call site below is fed a
+// growing set of types, revisits types already in its chain, and is shared
+// between threads, and every call must still reach the right method.
+
+interface IShape
+{
+    int Sides();
+}
+
+interface IValue<T>
+{
+    T Get();
+}
+
+class Triangle : IShape { public int Sides() => 3; }
+class Square : IShape { public int Sides() => 4; }
+class Pentagon : IShape { public int Sides() => 5; }
+class Hexagon : IShape { public int Sides() => 6; }
+class Heptagon : IShape { public int Sides() => 7; }
+class Octagon : IShape { public int Sides() => 8; }
+
+// Different method table, inherited implementation.
+class Rectangle : Square { }
+
+// Different method table, overridden implementation.
+class Polygon : Octagon, IShape { public new int Sides() => 100; }
+
+class IntValue : IValue<int> { public int Get() => 11; }
+class OtherIntValue : IValue<int> { public int Get() => 12; }
+class GenericValue<T> : IValue<int> { public int Get() => 13 + typeof(T).Name.Length; }
+
+public class ChainedDispatchStubs
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallSides(IShape shape) => shape.Sides();
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallSidesThreaded(IShape shape) => shape.Sides();
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallGet(IValue<int> value) => value.Get();
+
+    static readonly IShape[] s_shapes =
+    {
+        new Triangle(), new Square(), new Pentagon(), new Hexagon(),
+        new Heptagon(), new Octagon(), new Rectangle(), new Polygon()
+    };
+
+    static readonly int[] s_sides = { 3, 4, 5, 6, 7, 8, 4, 100 };
+
+    // Feeds the call site one more type at a time, going back over all the
+    // types seen so far each time.
+    static bool GrowingSet()
+    {
+        for (int count = 1; count <= s_shapes.Length; count++)
+        {
+            for (int repeat = 0; repeat < 50; repeat++)
+            {
+                for (int i = count - 1; i >= 0; i--)
+                {
+                    if (CallSides(s_shapes[i]) != s_sides[i])
+                    {
+                        Console.WriteLine($"CallSides({s_shapes[i].GetType().Name}) failed with {count} types");
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    static bool GenericTypes()
+    {
+        IValue<int>[] values =
+        {
+            new IntValue(), new OtherIntValue(), new GenericValue<string>(),
+            new GenericValue<object>(), new GenericValue<ChainedDispatchStubs>()
+        };
+
+        int[] expected = { 11, 12, 13 + 6, 13 + 6, 13 + 20 };
+
+        for (int repeat = 0; repeat < 100; repeat++)
+        {
+            int count = Math.Min(values.Length, 1 + repeat / 20);
+            for (int i = 0; i < count; i++)
+            {
+                if (CallGet(values[i]) != expected[i])
+                {
+                    Console.WriteLine($"CallGet({values[i].GetType().Name}) failed");
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Threads race to patch the same call site with different types.
+    static bool Threaded()
+    {
+        int failures = 0;
+        using var start = new ManualResetEventSlim(false);
+
+        Task[] tasks = new Task[Environment.ProcessorCount < 4 ? 4 : Environment.ProcessorCount];
+        for (int t = 0; t < tasks.Length; t++)
+        {
+            int first = t;
+            tasks[t] = Task.Factory.StartNew(() =>
+            {
+                start.Wait();
+                for (int i = 0; i < 20000; i++)
+                {
+                    int index = (first + i / 1000) % s_shapes.Length;
+                    if (CallSidesThreaded(s_shapes[index]) != s_sides[index])
+                    {
+                        Interlocked.Increment(ref failures);
+                    }
+                }
+            }, TaskCreationOptions.LongRunning);
+        }
+
+        start.Set();
+        Task.WaitAll(tasks);
+
+        if (failures != 0)
+        {
+            Console.WriteLine($"CallSidesThreaded failed {failures} times");
+            return false;
+        }
+
+        return true;
+    }
+
+    public static int Main()
+    {
+        if (!GrowingSet())
+        {
+            return 101;
+        }
+
+        if (!GenericTypes())
+        {
+            return 102;
+        }
+
+        if (!Threaded())
+        {
+            return 103;
+        }
+
+        return 100;
+    }
+}
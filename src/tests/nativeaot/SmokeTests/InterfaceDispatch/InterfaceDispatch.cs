@@ -0,0 +1,154 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+// Interface call sites that see more types than their dispatch cache can
+// hold record the rest in a shared overflow table. Here 16 call sites see
+// 128 types each, so many of those mappings collide in the table and keep
+// displacing each other. The loop below does not allocate, so no GC
+// recycles the displaced entries, and the memory used for them must stay
+// bounded anyway.
+
+interface IValue
+{
+    int Get();
+}
+
+class A0 { }
+class A1 { }
+class A2 { }
+class A3 { }
+class A4 { }
+class A5 { }
+class A6 { }
+class A7 { }
+
+struct S0 { }
+struct S1 { }
+struct S2 { }
+struct S3 { }
+struct S4 { }
+struct S5 { }
+struct S6 { }
+struct S7 { }
+struct S8 { }
+struct S9 { }
+struct S10 { }
+struct S11 { }
+struct S12 { }
+struct S13 { }
+struct S14 { }
+struct S15 { }
+
+class Pair<T1, T2> : IValue
+{
+    private readonly int _id;
+
+    public Pair(int id) => _id = id;
+
+    public int Get() => _id;
+}
+
+public class InterfaceDispatch
+{
+    const int Passes = 5000;
+
+    // Each instantiation over a struct has its own code, and so its own
+    // dispatch cell.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Call<TSite>(IValue value) where TSite : struct => value.Get();
+
+    static void AddPairs<T1>(IValue[] values, ref int count)
+    {
+        values[count] = new Pair<T1, S0>(count++);
+        values[count] = new Pair<T1, S1>(count++);
+        values[count] = new Pair<T1, S2>(count++);
+        values[count] = new Pair<T1, S3>(count++);
+        values[count] = new Pair<T1, S4>(count++);
+        values[count] = new Pair<T1, S5>(count++);
+        values[count] = new Pair<T1, S6>(count++);
+        values[count] = new Pair<T1, S7>(count++);
+        values[count] = new Pair<T1, S8>(count++);
+        values[count] = new Pair<T1, S9>(count++);
+        values[count] = new Pair<T1, S10>(count++);
+        values[count] = new Pair<T1, S11>(count++);
+        values[count] = new Pair<T1, S12>(count++);
+        values[count] = new Pair<T1, S13>(count++);
+        values[count] = new Pair<T1, S14>(count++);
+        values[count] = new Pair<T1, S15>(count++);
+    }
+
+    static bool RunPass(IValue[] values)
+    {
+        for (int i = 0; i < values.Length; i++)
+        {
+            IValue value = values[i];
+            int sum = Call<S0>(value) + Call<S1>(value) + Call<S2>(value) + Call<S3>(value) +
+                      Call<S4>(value) + Call<S5>(value) + Call<S6>(value) + Call<S7>(value) +
+                      Call<S8>(value) + Call<S9>(value) + Call<S10>(value) + Call<S11>(value) +
+                      Call<S12>(value) + Call<S13>(value) + Call<S14>(value) + Call<S15>(value);
+            if (sum != 16 * i)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static long PrivateMemory()
+    {
+        using Process process = Process.GetCurrentProcess();
+        return process.PrivateMemorySize64;
+    }
+
+    public static int Main()
+    {
+        IValue[] values = new IValue[128];
+        int count = 0;
+        AddPairs<A0>(values, ref count);
+        AddPairs<A1>(values, ref count);
+        AddPairs<A2>(values, ref count);
+        AddPairs<A3>(values, ref count);
+        AddPairs<A4>(values, ref count);
+        AddPairs<A5>(values, ref count);
+        AddPairs<A6>(values, ref count);
+        AddPairs<A7>(values, ref count);
+
+        // Fill the caches and the overflow table.
+        for (int pass = 0; pass < 10; pass++)
+        {
+            if (!RunPass(values))
+            {
+                Console.WriteLine("Wrong dispatch target while warming up");
+                return 101;
+            }
+        }
+
+        long before = PrivateMemory();
+
+        for (int pass = 0; pass < Passes; pass++)
+        {
+            if (!RunPass(values))
+            {
+                Console.WriteLine($"Wrong dispatch target in pass {pass}");
+                return 102;
+            }
+        }
+
+        long growth = PrivateMemory() - before;
+        Console.WriteLine($"Private memory grew by {growth} bytes");
+
+        // Unbounded growth would be tens of bytes for each of the millions
+        // of misses above.
+        if (growth > 16 * 1024 * 1024)
+        {
+            return 103;
+        }
+
+        return 100;
+    }
+}